@@ -454,10 +454,12 @@ int ObSimpleLogServer::init_log_service_(const bool is_bootstrap)
     opts.disk_options_.log_disk_throttling_percentage_ = 100;
     opts.disk_options_.log_disk_throttling_maximum_duration_ = 2 * 3600 * 1000 * 1000L;
     opts.disk_options_.log_writer_parallelism_ = 2;
+    opts.disk_options_.log_writer_io_depth_ = 2;
     disk_opts_ = opts.disk_options_;
     inner_table_disk_opts_ = disk_opts_;
     opts.enable_log_cache_ = true;
   }
+  opts.log_cache_read_ahead_size_ = 1024 * 1024;
   std::string clog_dir = clog_dir_ + "/tenant_" + std::to_string(tenant_id_);
   // 内存分配器仍使用不同的tenant_id
   allocator_ = OB_NEW(ObTenantMutilAllocator, "TestBase", node_id_);
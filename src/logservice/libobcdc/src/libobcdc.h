@@ -52,6 +52,51 @@ struct ObCDCError
 
 typedef void (* ERROR_CALLBACK) (const ObCDCError &err);
 
+/*
+ * Column type of ObCDCColumnVector
+ * Values are taken from the datums of the row instead of the text of ICDCRecord: integer, float and
+ * string values keep their native layout, the other types keep the ObObj decoded from the datum.
+ */
+enum ObCDCColumnType
+{
+  OB_CDC_COLUMN_TYPE_UNKNOWN = 0,   ///< all values of the column are NULL or NOP
+  OB_CDC_COLUMN_TYPE_INT64,         ///< values_ is int64_t array
+  OB_CDC_COLUMN_TYPE_UINT64,        ///< values_ is uint64_t array
+  OB_CDC_COLUMN_TYPE_FLOAT,         ///< values_ is float array
+  OB_CDC_COLUMN_TYPE_DOUBLE,        ///< values_ is double array
+  OB_CDC_COLUMN_TYPE_BINARY,        ///< raw bytes of char/varchar/binary/raw/text/blob in data_, indexed by offsets_
+  OB_CDC_COLUMN_TYPE_OBJ,           ///< ObObj of the other types serialized by ObObj::serialize in data_, indexed by offsets_
+};
+
+struct ObCDCColumnVector
+{
+  uint64_t        column_id_;
+  ObCDCColumnType type_;
+  const uint8_t   *null_bitmap_;    ///< bit i is set if the value of row i is NULL
+  const uint8_t   *nop_bitmap_;     ///< bit i is set if row i doesn't carry the column, e.g. not updated in minimal mode
+  const void      *values_;         ///< fixed width values, one for each row
+  const int64_t   *offsets_;        ///< value of row i is [offsets_[i], offsets_[i + 1]) of data_
+  const char      *data_;
+};
+
+/*
+ * Columnar batch of DML rows of one table in one redo log
+ * INSERT and UPDATE rows carry new values, DELETE rows carry old values.
+ */
+class IObCDCColumnarBatch
+{
+public:
+  virtual ~IObCDCColumnarBatch() {}
+public:
+  virtual uint64_t get_tenant_id() const = 0;
+  virtual uint64_t get_table_id() const = 0;
+  virtual int64_t get_row_count() const = 0;
+  /// record type of each row derived from the DML flag: EINSERT, EUPDATE, EDELETE or EPUT
+  virtual const int32_t *get_record_types() const = 0;
+  virtual int64_t get_column_count() const = 0;
+  virtual const ObCDCColumnVector *get_column(const int64_t column_idx) const = 0;
+};
+
 class IObCDCInstance
 {
 public:
@@ -138,6 +183,22 @@ public:
   /// @retval OB_SUCCESS      success
   /// @retval other value     fail
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids) = 0;
+
+  /*
+   * get columnar batch of the DML record, require enable_output_columnar_batch=1 and memory working mode
+   * records of the same table in the same redo log share one batch, which is valid until all of them are released
+   * @param [in]  record            DML record returned by next_record
+   * @param [out] batch             columnar batch the record belongs to
+   * @param [out] row_idx           row index of the record in batch
+   *
+   * @retval OB_SUCCESS             success
+   * @retval OB_ENTRY_NOT_EXIST     not DML record or batch is not built for the record
+   * @retval OB_NOT_SUPPORTED       not memory working mode
+   * @retval other error code       fail
+   */
+  virtual int get_columnar_batch(ICDCRecord *record,
+      const IObCDCColumnarBatch *&batch,
+      int64_t &row_idx) = 0;
 };
 
 class ObCDCFactory
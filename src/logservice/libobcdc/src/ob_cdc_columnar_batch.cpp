@@ -0,0 +1,533 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX OBLOG_FORMATTER
+
+#include "ob_cdc_columnar_batch.h"
+#include "ob_log_part_trans_task.h"     // ColValue
+#include "ob_cdc_lob_ctx.h"             // ObLobDataOutRowCtxList
+
+namespace oceanbase
+{
+using namespace common;
+
+namespace libobcdc
+{
+static const int64_t COLUMNAR_BUF_MIN_SIZE = 64;
+
+int ObCDCColumnarBuf::reserve(ObIAllocator &allocator, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(size < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), K(size));
+  } else if (len_ + size > cap_) {
+    const int64_t new_cap = MAX(MAX(cap_ * 2, len_ + size), COLUMNAR_BUF_MIN_SIZE);
+    char *new_ptr = NULL;
+
+    if (OB_ISNULL(new_ptr = static_cast<char *>(allocator.alloc(new_cap)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_ERROR("alloc columnar buffer failed", KR(ret), K(new_cap), KPC(this));
+    } else {
+      if (len_ > 0) {
+        MEMCPY(new_ptr, ptr_, len_);
+      }
+      MEMSET(new_ptr + len_, 0, new_cap - len_);
+      // the old buffer is released together with the allocator
+      ptr_ = new_ptr;
+      cap_ = new_cap;
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarBuf::append(ObIAllocator &allocator, const void *data, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_FAIL(reserve(allocator, size))) {
+    LOG_ERROR("reserve columnar buffer failed", KR(ret), K(size));
+  } else {
+    if (size > 0 && OB_NOT_NULL(data)) {
+      MEMCPY(ptr_ + len_, data, size);
+    }
+    len_ += size;
+  }
+
+  return ret;
+}
+
+///////////////////////////////////// ObCDCColumnarColumn /////////////////////////////////////
+
+ObCDCColumnarColumn::ObCDCColumnarColumn(ObIAllocator &allocator, const uint64_t column_id) :
+    allocator_(allocator),
+    column_id_(column_id),
+    type_(OB_CDC_COLUMN_TYPE_UNKNOWN),
+    row_count_(0),
+    null_bitmap_(),
+    nop_bitmap_(),
+    values_(),
+    offsets_(),
+    data_()
+{
+}
+
+ObCDCColumnType ObCDCColumnarColumn::get_column_type_(const ColValue &cv)
+{
+  ObCDCColumnType type = OB_CDC_COLUMN_TYPE_OBJ;
+
+  switch (cv.value_.get_type_class()) {
+    case ObIntTC:
+      type = OB_CDC_COLUMN_TYPE_INT64;
+      break;
+    case ObUIntTC:
+      type = OB_CDC_COLUMN_TYPE_UINT64;
+      break;
+    case ObFloatTC:
+      type = OB_CDC_COLUMN_TYPE_FLOAT;
+      break;
+    case ObDoubleTC:
+      type = OB_CDC_COLUMN_TYPE_DOUBLE;
+      break;
+    case ObStringTC:
+    case ObRawTC:
+    case ObTextTC:
+    case ObLobTC:
+      type = OB_CDC_COLUMN_TYPE_BINARY;
+      break;
+    default:
+      // number, datetime, json and the other types keep the ObObj decoded from the datum
+      type = OB_CDC_COLUMN_TYPE_OBJ;
+      break;
+  }
+
+  return type;
+}
+
+int64_t ObCDCColumnarColumn::get_fixed_width_(const ObCDCColumnType type)
+{
+  int64_t width = 0;
+
+  switch (type) {
+    case OB_CDC_COLUMN_TYPE_INT64:
+      width = sizeof(int64_t);
+      break;
+    case OB_CDC_COLUMN_TYPE_UINT64:
+      width = sizeof(uint64_t);
+      break;
+    case OB_CDC_COLUMN_TYPE_FLOAT:
+      width = sizeof(float);
+      break;
+    case OB_CDC_COLUMN_TYPE_DOUBLE:
+      width = sizeof(double);
+      break;
+    default:
+      width = 0;
+      break;
+  }
+
+  return width;
+}
+
+int ObCDCColumnarColumn::set_bit_(ObCDCColumnarBuf &bitmap, const int64_t row_idx, const bool is_set)
+{
+  int ret = OB_SUCCESS;
+  const int64_t byte_idx = row_idx / 8;
+
+  if (byte_idx >= bitmap.len_
+      && OB_FAIL(bitmap.reserve(allocator_, byte_idx + 1 - bitmap.len_))) {
+    LOG_ERROR("reserve bitmap failed", KR(ret), K(row_idx), K(bitmap));
+  } else {
+    bitmap.len_ = MAX(bitmap.len_, byte_idx + 1);
+    if (is_set) {
+      reinterpret_cast<uint8_t *>(bitmap.ptr_)[byte_idx] |= static_cast<uint8_t>(1 << (row_idx % 8));
+    }
+  }
+
+  return ret;
+}
+
+// value of a NULL or NOP row: zero for fixed width type, empty string for var length type
+int ObCDCColumnarColumn::append_placeholder_()
+{
+  int ret = OB_SUCCESS;
+
+  if (is_var_len_type_(type_)) {
+    const int64_t offset = data_.len_;
+    if (OB_FAIL(offsets_.append(allocator_, &offset, sizeof(offset)))) {
+      LOG_ERROR("append offset failed", KR(ret), K_(column_id));
+    }
+  } else if (OB_CDC_COLUMN_TYPE_UNKNOWN != type_) {
+    const int64_t width = get_fixed_width_(type_);
+    if (OB_FAIL(values_.reserve(allocator_, width))) {
+      LOG_ERROR("reserve values failed", KR(ret), K_(column_id), K(width));
+    } else {
+      values_.len_ += width;
+    }
+  } else {
+    // type is decided by the first not NULL value, placeholders are filled then
+  }
+
+  return ret;
+}
+
+// The rows before the first not NULL value are all NULL or NOP, fill their placeholders once the type is known
+int ObCDCColumnarColumn::set_type_(const ObCDCColumnType type)
+{
+  int ret = OB_SUCCESS;
+  type_ = type;
+
+  if (is_var_len_type_(type_)) {
+    const int64_t offset = 0;
+    if (OB_FAIL(offsets_.append(allocator_, &offset, sizeof(offset)))) {
+      LOG_ERROR("append first offset failed", KR(ret), K_(column_id));
+    }
+  }
+
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < row_count_; idx++) {
+    if (OB_FAIL(append_placeholder_())) {
+      LOG_ERROR("append placeholder failed", KR(ret), K(idx), KPC(this));
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarColumn::append_absent_(const bool is_nop)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_FAIL(set_bit_(null_bitmap_, row_count_, ! is_nop))) {
+    LOG_ERROR("set null bit failed", KR(ret), KPC(this));
+  } else if (OB_FAIL(set_bit_(nop_bitmap_, row_count_, is_nop))) {
+    LOG_ERROR("set nop bit failed", KR(ret), KPC(this));
+  } else if (OB_FAIL(append_placeholder_())) {
+    LOG_ERROR("append placeholder failed", KR(ret), KPC(this));
+  } else {
+    row_count_++;
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarColumn::append_null()
+{
+  return append_absent_(false/*is_nop*/);
+}
+
+int ObCDCColumnarColumn::append_nop()
+{
+  return append_absent_(true/*is_nop*/);
+}
+
+int ObCDCColumnarColumn::append_obj_(const ObObj &obj)
+{
+  int ret = OB_SUCCESS;
+  const int64_t size = obj.get_serialize_size();
+  int64_t pos = 0;
+
+  if (OB_FAIL(data_.reserve(allocator_, size))) {
+    LOG_ERROR("reserve data failed", KR(ret), K(size), KPC(this));
+  } else if (OB_FAIL(obj.serialize(data_.ptr_ + data_.len_, size, pos))) {
+    LOG_ERROR("serialize obj failed", KR(ret), K(obj), K(size), KPC(this));
+  } else {
+    data_.len_ += pos;
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarColumn::append(const ColValue &cv, const ObString *lob_value)
+{
+  int ret = OB_SUCCESS;
+  const ObObj &obj = cv.value_;
+
+  if (cv.is_col_nop_) {
+    if (OB_FAIL(append_nop())) {
+      LOG_ERROR("append nop failed", KR(ret), KPC(this));
+    }
+  } else if (obj.is_null() || (cv.is_out_row_ && OB_ISNULL(lob_value))) {
+    if (OB_FAIL(append_null())) {
+      LOG_ERROR("append null failed", KR(ret), KPC(this));
+    }
+  } else {
+    const ObCDCColumnType type = get_column_type_(cv);
+
+    if (OB_CDC_COLUMN_TYPE_UNKNOWN == type_ && OB_FAIL(set_type_(type))) {
+      LOG_ERROR("set column type failed", KR(ret), K(type), KPC(this));
+    } else if (OB_UNLIKELY(type != type_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("column type changed in one batch", KR(ret), K(type), KPC(this), K(cv));
+    } else if (OB_FAIL(set_bit_(null_bitmap_, row_count_, false))) {
+      LOG_ERROR("set null bit failed", KR(ret), KPC(this));
+    } else if (OB_FAIL(set_bit_(nop_bitmap_, row_count_, false))) {
+      LOG_ERROR("set nop bit failed", KR(ret), KPC(this));
+    } else {
+      switch (type_) {
+        case OB_CDC_COLUMN_TYPE_INT64: {
+          const int64_t v = obj.get_int();
+          ret = values_.append(allocator_, &v, sizeof(v));
+          break;
+        }
+        case OB_CDC_COLUMN_TYPE_UINT64: {
+          const uint64_t v = obj.get_uint64();
+          ret = values_.append(allocator_, &v, sizeof(v));
+          break;
+        }
+        case OB_CDC_COLUMN_TYPE_FLOAT: {
+          const float v = obj.get_float();
+          ret = values_.append(allocator_, &v, sizeof(v));
+          break;
+        }
+        case OB_CDC_COLUMN_TYPE_DOUBLE: {
+          const double v = obj.get_double();
+          ret = values_.append(allocator_, &v, sizeof(v));
+          break;
+        }
+        case OB_CDC_COLUMN_TYPE_BINARY: {
+          // in row lob datum is already stripped to the inrow data when the row is parsed
+          const ObString str = cv.is_out_row_ ? *lob_value : obj.get_string();
+          ret = data_.append(allocator_, str.ptr(), str.length());
+          break;
+        }
+        case OB_CDC_COLUMN_TYPE_OBJ: {
+          ObObj value = obj;
+          if (value.is_lob_storage()) {
+            // json, gis and the other lob types carry the merged or inrow data without lob header
+            if (cv.is_out_row_) {
+              value.set_string(obj.get_type(), *lob_value);
+            }
+            value.set_inrow();
+          }
+          ret = append_obj_(value);
+          break;
+        }
+        default:
+          ret = OB_ERR_UNEXPECTED;
+          break;
+      }
+
+      if (OB_SUCC(ret) && is_var_len_type_(type_)) {
+        const int64_t offset = data_.len_;
+        ret = offsets_.append(allocator_, &offset, sizeof(offset));
+      }
+
+      if (OB_SUCC(ret)) {
+        row_count_++;
+      } else {
+        LOG_ERROR("append column value failed", KR(ret), KPC(this), K(cv));
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarColumn::pad(const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+
+  while (OB_SUCC(ret) && row_count_ < row_count) {
+    if (OB_FAIL(append_nop())) {
+      LOG_ERROR("append nop failed", KR(ret), K(row_count), KPC(this));
+    }
+  }
+
+  return ret;
+}
+
+void ObCDCColumnarColumn::fill_vector(ObCDCColumnVector &vector) const
+{
+  vector.column_id_ = column_id_;
+  vector.type_ = type_;
+  vector.null_bitmap_ = reinterpret_cast<const uint8_t *>(null_bitmap_.ptr_);
+  vector.nop_bitmap_ = reinterpret_cast<const uint8_t *>(nop_bitmap_.ptr_);
+  vector.values_ = is_var_len_type_(type_) ? NULL : values_.ptr_;
+  vector.offsets_ = is_var_len_type_(type_) ? reinterpret_cast<const int64_t *>(offsets_.ptr_) : NULL;
+  vector.data_ = is_var_len_type_(type_) ? data_.ptr_ : NULL;
+}
+
+///////////////////////////////////// ObCDCColumnarBatch /////////////////////////////////////
+
+ObCDCColumnarBatch::ObCDCColumnarBatch(ObIAllocator &allocator) :
+    allocator_(allocator),
+    tenant_id_(OB_INVALID_TENANT_ID),
+    table_id_(OB_INVALID_ID),
+    row_count_(0),
+    record_types_(),
+    columns_(),
+    column_count_(0),
+    vectors_(NULL),
+    is_finished_(false),
+    next_(NULL)
+{
+}
+
+int ObCDCColumnarBatch::init(const uint64_t tenant_id, const uint64_t table_id)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(OB_INVALID_TENANT_ID == tenant_id || OB_INVALID_ID == table_id)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), K(tenant_id), K(table_id));
+  } else {
+    tenant_id_ = tenant_id;
+    table_id_ = table_id;
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarBatch::get_or_add_column_(
+    const uint64_t column_id,
+    const int64_t hint_idx,
+    ObCDCColumnarColumn *&column)
+{
+  int ret = OB_SUCCESS;
+  ObCDCColumnarColumn **columns = reinterpret_cast<ObCDCColumnarColumn **>(columns_.ptr_);
+  column = NULL;
+
+  if (hint_idx < column_count_ && columns[hint_idx]->get_column_id() == column_id) {
+    column = columns[hint_idx];
+  } else {
+    for (int64_t idx = 0; OB_ISNULL(column) && idx < column_count_; idx++) {
+      if (columns[idx]->get_column_id() == column_id) {
+        column = columns[idx];
+      }
+    }
+  }
+
+  if (OB_ISNULL(column)) {
+    void *buf = NULL;
+
+    if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObCDCColumnarColumn)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_ERROR("alloc columnar column failed", KR(ret), K(column_id), KPC(this));
+    } else if (FALSE_IT(column = new (buf) ObCDCColumnarColumn(allocator_, column_id))) {
+    } else if (OB_FAIL(column->pad(row_count_))) {
+      // previous rows don't carry the column
+      LOG_ERROR("pad new column failed", KR(ret), K(column_id), KPC(this));
+    } else if (OB_FAIL(columns_.append(allocator_, &column, sizeof(column)))) {
+      LOG_ERROR("append column failed", KR(ret), K(column_id), KPC(this));
+    } else {
+      column_count_++;
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarBatch::append_row(
+    const int32_t record_type,
+    const ColValue *cv_head,
+    ObLobDataOutRowCtxList &lob_ctx_cols,
+    int64_t &row_idx)
+{
+  int ret = OB_SUCCESS;
+  const ColValue *cv = cv_head;
+  int64_t col_idx = 0;
+  row_idx = row_count_;
+
+  if (OB_UNLIKELY(is_finished_)) {
+    ret = OB_STATE_NOT_MATCH;
+    LOG_ERROR("columnar batch is finished", KR(ret), KPC(this));
+  }
+
+  while (OB_SUCC(ret) && OB_NOT_NULL(cv)) {
+    ObCDCColumnarColumn *column = NULL;
+    const ObString *lob_value = NULL;
+
+    if (cv->is_out_row_) {
+      ObLobDataGetCtx *lob_data_get_ctx = NULL;
+      if (OB_FAIL(lob_ctx_cols.get_lob_data_get_ctx(cv->column_id_, lob_data_get_ctx))) {
+        if (OB_ENTRY_NOT_EXIST == ret) {
+          // lob value not recorded, treat as NULL
+          ret = OB_SUCCESS;
+        } else {
+          LOG_ERROR("get_lob_data_get_ctx failed", KR(ret), K(cv->column_id_));
+        }
+      } else {
+        lob_value = &lob_data_get_ctx->get_new_lob_column_value();
+      }
+    }
+
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(get_or_add_column_(cv->column_id_, col_idx, column))) {
+      LOG_ERROR("get_or_add_column_ failed", KR(ret), K(cv->column_id_), K(col_idx));
+    } else if (OB_UNLIKELY(column->get_row_count() != row_count_)) {
+      // duplicate column in one row
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected column row count", KR(ret), KPC(column), KPC(this));
+    } else if (OB_FAIL(column->append(*cv, lob_value))) {
+      LOG_WARN("append column value failed", KR(ret), KPC(column), KPC(cv));
+    } else {
+      cv = cv->next_;
+      col_idx++;
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(record_types_.append(allocator_, &record_type, sizeof(record_type)))) {
+      LOG_ERROR("append record type failed", KR(ret), K(record_type), KPC(this));
+    } else {
+      row_count_++;
+    }
+  }
+
+  return ret;
+}
+
+int ObCDCColumnarBatch::finish()
+{
+  int ret = OB_SUCCESS;
+  ObCDCColumnarColumn **columns = reinterpret_cast<ObCDCColumnarColumn **>(columns_.ptr_);
+
+  if (OB_UNLIKELY(is_finished_)) {
+    ret = OB_STATE_NOT_MATCH;
+    LOG_ERROR("columnar batch is finished", KR(ret), KPC(this));
+  } else if (column_count_ > 0
+      && OB_ISNULL(vectors_ = static_cast<ObCDCColumnVector *>(
+          allocator_.alloc(sizeof(ObCDCColumnVector) * column_count_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("alloc column vectors failed", KR(ret), KPC(this));
+  } else {
+    for (int64_t idx = 0; OB_SUCC(ret) && idx < column_count_; idx++) {
+      if (OB_FAIL(columns[idx]->pad(row_count_))) {
+        LOG_ERROR("pad column failed", KR(ret), K(idx), KPC(this));
+      } else {
+        columns[idx]->fill_vector(vectors_[idx]);
+      }
+    }
+
+    if (OB_SUCC(ret)) {
+      is_finished_ = true;
+    }
+  }
+
+  return ret;
+}
+
+const ObCDCColumnVector *ObCDCColumnarBatch::get_column(const int64_t column_idx) const
+{
+  const ObCDCColumnVector *vector = NULL;
+
+  if (is_finished_ && column_idx >= 0 && column_idx < column_count_) {
+    vector = vectors_ + column_idx;
+  }
+
+  return vector;
+}
+
+} // namespace libobcdc
+} // namespace oceanbase
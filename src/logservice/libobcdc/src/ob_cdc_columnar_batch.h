@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Columnar batch of DML rows, built from the formatted statements of a redo log
+ */
+
+#ifndef OCEANBASE_LIBOBCDC_COLUMNAR_BATCH_H_
+#define OCEANBASE_LIBOBCDC_COLUMNAR_BATCH_H_
+
+#include "lib/allocator/ob_allocator.h"     // ObIAllocator
+#include "lib/string/ob_string.h"           // ObString
+#include "lib/utility/ob_print_utils.h"     // TO_STRING_KV
+#include "libobcdc.h"                       // IObCDCColumnarBatch
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+struct ColValue;
+class ObLobDataOutRowCtxList;
+
+// Growable buffer allocated from the allocator of ObLogEntryTask, old buffer is released with the allocator
+struct ObCDCColumnarBuf
+{
+  char    *ptr_;
+  int64_t len_;
+  int64_t cap_;
+
+  ObCDCColumnarBuf() { reset(); }
+  void reset()
+  {
+    ptr_ = NULL;
+    len_ = 0;
+    cap_ = 0;
+  }
+
+  // make sure there is enough space for another size bytes, the new space is zeroed
+  int reserve(common::ObIAllocator &allocator, const int64_t size);
+  int append(common::ObIAllocator &allocator, const void *data, const int64_t size);
+
+  TO_STRING_KV(KP_(ptr), K_(len), K_(cap));
+};
+
+class ObCDCColumnarColumn
+{
+public:
+  explicit ObCDCColumnarColumn(common::ObIAllocator &allocator, const uint64_t column_id);
+  ~ObCDCColumnarColumn() {}
+
+public:
+  uint64_t get_column_id() const { return column_id_; }
+  int64_t get_row_count() const { return row_count_; }
+  ObCDCColumnType get_type() const { return type_; }
+
+  int append_null();
+  // the row doesn't carry the column, e.g. the column is not updated in minimal mode
+  int append_nop();
+  // lob_value is the merged value of out row lob column, NULL for in row column
+  int append(const ColValue &cv, const common::ObString *lob_value);
+  // fill NOP until the column has row_count rows
+  int pad(const int64_t row_count);
+  void fill_vector(ObCDCColumnVector &vector) const;
+
+  TO_STRING_KV(K_(column_id), K_(type), K_(row_count), K_(null_bitmap), K_(nop_bitmap), K_(values),
+      K_(offsets), K_(data));
+
+private:
+  static ObCDCColumnType get_column_type_(const ColValue &cv);
+  static int64_t get_fixed_width_(const ObCDCColumnType type);
+  static bool is_var_len_type_(const ObCDCColumnType type)
+  {
+    return OB_CDC_COLUMN_TYPE_BINARY == type || OB_CDC_COLUMN_TYPE_OBJ == type;
+  }
+  int set_type_(const ObCDCColumnType type);
+  int append_placeholder_();
+  int append_absent_(const bool is_nop);
+  int append_obj_(const common::ObObj &obj);
+  int set_bit_(ObCDCColumnarBuf &bitmap, const int64_t row_idx, const bool is_set);
+
+private:
+  common::ObIAllocator &allocator_;
+  uint64_t             column_id_;
+  ObCDCColumnType      type_;
+  int64_t              row_count_;
+  ObCDCColumnarBuf     null_bitmap_;
+  ObCDCColumnarBuf     nop_bitmap_;
+  ObCDCColumnarBuf     values_;
+  ObCDCColumnarBuf     offsets_;
+  ObCDCColumnarBuf     data_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObCDCColumnarColumn);
+};
+
+class ObCDCColumnarBatch : public IObCDCColumnarBatch
+{
+public:
+  explicit ObCDCColumnarBatch(common::ObIAllocator &allocator);
+  virtual ~ObCDCColumnarBatch() {}
+
+public:
+  int init(const uint64_t tenant_id, const uint64_t table_id);
+  // append one row, cv_head is the column list of the row, new values for INSERT/UPDATE/PUT, old values for DELETE
+  int append_row(
+      const int32_t record_type,
+      const ColValue *cv_head,
+      ObLobDataOutRowCtxList &lob_ctx_cols,
+      int64_t &row_idx);
+  // pad all columns to the same row count and build column vectors, no row can be appended after finish
+  int finish();
+
+  ObCDCColumnarBatch *get_next() { return next_; }
+  void set_next(ObCDCColumnarBatch *next) { next_ = next; }
+
+public:
+  virtual uint64_t get_tenant_id() const { return tenant_id_; }
+  virtual uint64_t get_table_id() const { return table_id_; }
+  virtual int64_t get_row_count() const { return row_count_; }
+  virtual const int32_t *get_record_types() const
+  {
+    return reinterpret_cast<const int32_t *>(record_types_.ptr_);
+  }
+  virtual int64_t get_column_count() const { return column_count_; }
+  virtual const ObCDCColumnVector *get_column(const int64_t column_idx) const;
+
+  TO_STRING_KV(K_(tenant_id), K_(table_id), K_(row_count), K_(column_count), K_(is_finished));
+
+private:
+  // columns of a table usually come in the same order in each row, so search from hint_idx first
+  int get_or_add_column_(const uint64_t column_id, const int64_t hint_idx, ObCDCColumnarColumn *&column);
+
+private:
+  common::ObIAllocator &allocator_;
+  uint64_t             tenant_id_;
+  uint64_t             table_id_;
+  int64_t              row_count_;
+  ObCDCColumnarBuf     record_types_;
+  ObCDCColumnarBuf     columns_;        // array of ObCDCColumnarColumn *
+  int64_t              column_count_;
+  ObCDCColumnVector    *vectors_;
+  bool                 is_finished_;
+  ObCDCColumnarBatch   *next_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObCDCColumnarBatch);
+};
+
+} // namespace libobcdc
+} // namespace oceanbase
+
+#endif
@@ -188,6 +188,11 @@ public:
   DEF_INT(binlog_record_prealloc_count, OB_CLUSTER_PARAMETER, "200000", "[1,]", "binlog record pre-alloc count");
 
   DEF_STR(store_service_path, OB_CLUSTER_PARAMETER, "./storage", "store sevice path");
+  // store service of large transaction redo and lob data
+  // rocksdb: RocksDbStoreService
+  // segment: ObLogSegmentStoreService, append-only segment files with in-memory index
+  DEF_STR(store_service_type, OB_CLUSTER_PARAMETER, "rocksdb", "store service type: rocksdb, segment");
+  T_DEF_INT_INFT(segment_store_segment_size, OB_CLUSTER_PARAMETER, 64, 1, "segment file size of segment store[M]");
 
   // Whether to do ob version compatibility check
   // default value '0:not_skip'
@@ -536,6 +541,10 @@ public:
   // 2. Backup is on by default
   T_DEF_BOOL(enable_output_hidden_primary_key, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Whether to build columnar batch of DML rows for IObCDCInstance::get_columnar_batch
+  // only take effect in memory working mode, disabled by default
+  T_DEF_BOOL(enable_output_columnar_batch, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
+
   // Ignore inconsistencies in the number of HBase mode put columns or not
   // Do not skip by default
   T_DEF_BOOL(skip_hbase_mode_put_column_count_not_consistency, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
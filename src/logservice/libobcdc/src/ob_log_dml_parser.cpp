@@ -22,7 +22,9 @@
 #include "ob_ms_queue_thread.h"         // BitSet
 #include "ob_log_resource_collector.h"  // IObLogResourceCollector
 #include "ob_log_trace_id.h"
+#include "ob_log_utils.h"               // get_timestamp
 #include "ob_cdc_auto_config_mgr.h"     // CDC_CFG_MGR
+#include "ob_log_trans_stat_mgr.h"      // IObLogTransStatMgr
 
 using namespace oceanbase::common;
 
@@ -143,6 +145,8 @@ int ObLogDmlParser::push(ObLogEntryTask &task, const int64_t timeout)
     } else {
       if (redo_log_node->is_direct_load_inc_log() && CDC_CFG_MGR.get_direct_load_inc_thread_num() < get_thread_num()) {
         hash_value = hash_value % CDC_CFG_MGR.get_direct_load_inc_thread_num();
+      } else {
+        hash_value = choose_parser_queue_(hash_value);
       }
 
       if (OB_FAIL(DmlParserThread::push(&task, hash_value, timeout))) {
@@ -159,6 +163,30 @@ int ObLogDmlParser::push(ObLogEntryTask &task, const int64_t timeout)
   return ret;
 }
 
+// A big redo may occupy a parser thread for a long time while the redo dispatched to the same
+// queue by round robin wait behind it. Compare the round robin queue with the next one and push
+// to the shorter one, so that idle parser threads take over the backlog of busy ones.
+uint64_t ObLogDmlParser::choose_parser_queue_(const uint64_t hash_value)
+{
+  uint64_t ret_hash_value = hash_value;
+  const int64_t thread_num = get_thread_num();
+
+  if (thread_num > 1) {
+    const int64_t queue_idx = static_cast<int64_t>(hash_value % thread_num);
+    const int64_t next_queue_idx = (queue_idx + 1) % thread_num;
+    int64_t task_num = 0;
+    int64_t next_task_num = 0;
+
+    if (OB_SUCCESS == get_task_num(queue_idx, task_num)
+        && OB_SUCCESS == get_task_num(next_queue_idx, next_task_num)
+        && next_task_num < task_num) {
+      ret_hash_value = static_cast<uint64_t>(next_queue_idx);
+    }
+  }
+
+  return ret_hash_value;
+}
+
 int ObLogDmlParser::get_log_entry_task_count(int64_t &task_num)
 {
   int ret = OB_SUCCESS;
@@ -205,8 +233,11 @@ int ObLogDmlParser::handle(void *data,
     } else {
       lib::CompatModeGuard g(compat_mode);
 
+      const int64_t parse_start_time = get_timestamp();
+
       if (OB_FAIL(part_trans_parser_->parse(*task, stop_flag))) {
         LOG_ERROR("parse task fail", KR(ret), KPC(task), "compat_mode", print_compat_mode(compat_mode));
+      } else if (FALSE_IT(do_parse_stat_(redo_log_node->get_data_len(), get_timestamp() - parse_start_time))) {
       } else if (OB_FAIL(task->set_redo_log_parsed())) {
         LOG_ERROR("failed to set log_entry_task parsed", KR(ret), KP(task), KPC(task));
       } else if (OB_FAIL(dispatch_task_(*task, *part_trans_task, stop_flag))) {
@@ -232,6 +263,15 @@ int ObLogDmlParser::handle(void *data,
 }
 
 
+void ObLogDmlParser::do_parse_stat_(const int64_t redo_size, const int64_t parse_time)
+{
+  IObLogTransStatMgr *trans_stat_mgr = TCTX.trans_stat_mgr_;
+
+  if (OB_NOT_NULL(trans_stat_mgr)) {
+    trans_stat_mgr->do_parse_redo_stat(redo_size, parse_time);
+  }
+}
+
 int ObLogDmlParser::dispatch_task_(ObLogEntryTask &log_entry_task,
     PartTransTask &part_trans_task,
     volatile bool &stop_flag)
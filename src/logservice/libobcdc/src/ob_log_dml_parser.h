@@ -81,6 +81,8 @@ public:
   void destroy();
 
 private:
+  uint64_t choose_parser_queue_(const uint64_t hash_value);
+  void do_parse_stat_(const int64_t redo_size, const int64_t parse_time);
   int dispatch_task_(ObLogEntryTask &log_entry_task, PartTransTask &part_trans_task, volatile bool &stop_flag);
   int handle_empty_stmt_(ObLogEntryTask &log_entry_task, PartTransTask &part_trans_task, volatile bool &stop_flag);
   int push_task_into_formatter_(ObLogEntryTask &log_entry_task, volatile bool &stop_flag);
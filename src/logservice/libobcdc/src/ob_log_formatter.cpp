@@ -38,6 +38,7 @@
 #include "ob_cdc_udt.h"                 // ObCDCUdtValueBuilder
 #include "ob_log_trace_id.h"            // ObLogTraceIdGuard
 #include "ob_log_timezone_info_getter.h"
+#include "ob_log_trans_stat_mgr.h"      // IObLogTransStatMgr
 
 using namespace oceanbase::common;
 using namespace oceanbase::storage;
@@ -323,6 +324,7 @@ int ObLogFormatter::handle(void *data, const int64_t thread_index, volatile bool
   IStmtTask *stmt_task = static_cast<IStmtTask *>(data);
   DmlStmtTask *dml_stmt_task = dynamic_cast<DmlStmtTask *>(stmt_task);
   RowValue *rv = row_value_array_ + thread_index;
+  const int64_t format_start_time = get_timestamp();
 
   if (OB_UNLIKELY(! inited_)) {
     ret = OB_NOT_INIT;
@@ -342,6 +344,8 @@ int ObLogFormatter::handle(void *data, const int64_t thread_index, volatile bool
     if (OB_IN_STOP_STATE != ret) {
       LOG_ERROR("handle_dml_stmt_ failed", KR(ret), KPC(dml_stmt_task), K(cur_stmt_need_callback));
     }
+  } else if (OB_NOT_NULL(TCTX.trans_stat_mgr_)) {
+    TCTX.trans_stat_mgr_->do_format_stmt_stat(get_timestamp() - format_start_time);
   }
   // cur_stmt_need_callback is true, do nothing, wait callback process.
   // Note: You cannot continue to manipulate any data structures afterwards.
@@ -831,9 +835,12 @@ int ObLogFormatter::finish_format_(PartTransTask &part_trans_task,
     const bool is_all_stmt_formatted = formatted_stmt_num >= stmt_num;
     const uint64_t tenant_id = part_trans_task.get_tenant_id();
     int64_t row_ref_cnt = 0;
+    // columnar batch refers to the statements, which are only kept until the records are released in memory working mode
+    const bool need_build_columnar_batch = is_memory_working_mode(working_mode_)
+        && (1 == TCONF.enable_output_columnar_batch);
 
     if (is_all_stmt_formatted) {
-      if (OB_FAIL(redo_log_entry_task.link_row_list(row_ref_cnt))) {
+      if (OB_FAIL(redo_log_entry_task.link_row_list(need_build_columnar_batch, row_ref_cnt))) {
         if (OB_IN_STOP_STATE != ret) {
           LOG_ERROR("redo_log_entry_task link_row_list fail", KR(ret), K(redo_log_entry_task));
         }
@@ -50,6 +50,7 @@
 #include "ob_log_ddl_parser.h"            // ObLogDdlParser
 #include "ob_log_fetcher.h"               // ObLogFetcher
 #include "ob_log_part_trans_task.h"       // PartTransTask
+#include "ob_cdc_columnar_batch.h"       // ObCDCColumnarBatch
 #include "ob_log_table_matcher.h"         // ObLogTableMatcher
 #include "ob_log_trans_ctx_mgr.h"         // ObLogTransCtxMgr
 #include "ob_log_trans_ctx.h"             // TransCtx
@@ -60,6 +61,7 @@
 #include "ob_log_start_schema_matcher.h"  // ObLogStartSchemaMatcher
 #include "ob_log_tenant_mgr.h"            // IObLogTenantMgr
 #include "ob_log_rocksdb_store_service.h" // RocksDbStoreService
+#include "ob_log_segment_store_service.h" // ObLogSegmentStoreService
 #include "ob_cdc_auto_config_mgr.h"       // CDC_CFG_MGR
 #include "ob_cdc_malloc_sample_info.h"    // ObCDCMallocSampleInfo
 
@@ -750,6 +752,8 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   // The starting schema version of the SYS tenant
   const char *data_start_schema_version = TCONF.data_start_schema_version.str();
   const char *store_service_path = TCONF.store_service_path.str();
+  const bool use_segment_store = (0 == strcasecmp(TCONF.store_service_type.str(), "segment"));
+  const int64_t segment_store_segment_size = TCONF.segment_store_segment_size;
   const char *working_mode_str = TCONF.working_mode.str();
   WorkingMode working_mode = get_working_mode(working_mode_str);
   const char *refresh_mode_str = TCONF.meta_data_refresh_mode.str();
@@ -900,7 +904,11 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
 
   INIT(log_entry_task_pool_, ObLogEntryTaskPool, TCONF.log_entry_task_prealloc_count);
 
-  INIT(store_service_, RocksDbStoreService, store_service_path);
+  if (use_segment_store) {
+    INIT(store_service_, ObLogSegmentStoreService, store_service_path, segment_store_segment_size << 20);
+  } else {
+    INIT(store_service_, RocksDbStoreService, store_service_path);
+  }
 
   INIT(br_pool_, ObLogBRPool, TCONF.binlog_record_prealloc_count);
 
@@ -2010,6 +2018,46 @@ void ObLogInstance::release_record(IBinlogRecord *record)
   }
 }
 
+int ObLogInstance::get_columnar_batch(IBinlogRecord *record,
+    const IObCDCColumnarBatch *&batch,
+    int64_t &row_idx)
+{
+  int ret = OB_SUCCESS;
+  batch = NULL;
+  row_idx = OB_INVALID_INDEX;
+
+  if (OB_UNLIKELY(! inited_)) {
+    LOG_ERROR("instance has not been initialized");
+    ret = OB_NOT_INIT;
+  } else if (OB_ISNULL(record)) {
+    LOG_ERROR("invalid argument", K(record));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_UNLIKELY(! is_memory_working_mode(working_mode_))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("columnar batch is only supported in memory working mode", KR(ret),
+        "working_mode", print_working_mode(working_mode_));
+  } else {
+    const int record_type = record->recordType();
+    ObLogBR *br = reinterpret_cast<ObLogBR *>(record->getUserData());
+    DmlStmtTask *stmt_task = NULL;
+
+    if (EDDL == record_type || EBEGIN == record_type || ECOMMIT == record_type || HEARTBEAT == record_type) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else if (OB_ISNULL(br)) {
+      LOG_ERROR("binlog record user data is NULL", K(record));
+      ret = OB_ERR_UNEXPECTED;
+    } else if (OB_ISNULL(stmt_task = static_cast<DmlStmtTask *>(br->get_stmt_task()))
+        || OB_ISNULL(stmt_task->get_columnar_batch())) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      batch = stmt_task->get_columnar_batch();
+      row_idx = stmt_task->get_columnar_row_idx();
+    }
+  }
+
+  return ret;
+}
+
 void ObLogInstance::handle_error(const int err_no, const char *fmt, ...)
 {
   static const int64_t MAX_ERR_MSG_LEN = 1024;
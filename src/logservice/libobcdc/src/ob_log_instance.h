@@ -141,6 +141,9 @@ public:
   virtual int launch();
   virtual void stop();
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids);
+  virtual int get_columnar_batch(IBinlogRecord *record,
+      const IObCDCColumnarBatch *&batch,
+      int64_t &row_idx);
 
 public:
   void mark_stop_flag(const char *stop_reason);
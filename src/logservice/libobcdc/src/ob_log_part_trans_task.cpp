@@ -43,6 +43,7 @@
 #include "ob_log_resource_collector.h"              // IObLogResourceCollector
 #include "ob_cdc_lob_data_merger.h"                 // IObCDCLobDataMerger
 #include "ob_log_schema_cache_info.h"               // ColumnSchemaInfo
+#include "ob_cdc_columnar_batch.h"                  // ObCDCColumnarBatch
 #include "ob_cdc_udt.h"                             // ObCDCUdtValueMap
 
 #define PARSE_INT64(name, obj, val, INVALID_VALUE, check_value) \
@@ -1423,7 +1424,9 @@ DmlStmtTask::DmlStmtTask(
     is_callback_(0),
     log_entry_task_(log_entry_task),
     table_id_(OB_INVALID_ID),
-    row_(row)
+    row_(row),
+    columnar_batch_(NULL),
+    columnar_row_idx_(OB_INVALID_INDEX)
 {
   // set hash value
   IStmtTask::set_hash_value(row_.hash(host.get_tls_id().hash()));
@@ -1437,6 +1440,8 @@ void DmlStmtTask::reset()
   IStmtTask::reset();
   table_id_ = OB_INVALID_ID;
   row_.reset();
+  columnar_batch_ = NULL;
+  columnar_row_idx_ = OB_INVALID_INDEX;
 }
 
 int DmlStmtTask::parse_cols(
@@ -2145,6 +2150,7 @@ ObLogEntryTask::ObLogEntryTask(PartTransTask &host, const bool is_direct_load_in
     stmt_list_(),
     formatted_stmt_num_(0),
     row_ref_cnt_(0),
+    columnar_batch_list_(NULL),
     arena_allocator_(
         host.get_log_entry_task_base_allocator(),
         "LogEntryTask",
@@ -2169,6 +2175,8 @@ void ObLogEntryTask::reset()
   stmt_list_.reset();
   formatted_stmt_num_ = 0;
   row_ref_cnt_ = 0;
+  // columnar batches are allocated by arena_allocator_
+  columnar_batch_list_ = NULL;
 
   arena_allocator_.clear();
 }
@@ -2359,7 +2367,7 @@ int64_t ObLogEntryTask::inc_formatted_stmt_num()
   return ATOMIC_AAF(&formatted_stmt_num_, 1);
 }
 
-int ObLogEntryTask::link_row_list(int64_t &row_ref_cnt)
+int ObLogEntryTask::link_row_list(const bool need_build_columnar_batch, int64_t &row_ref_cnt)
 {
   int ret = OB_SUCCESS;
 
@@ -2413,6 +2421,15 @@ int ObLogEntryTask::link_row_list(int64_t &row_ref_cnt)
       }
     } // while
 
+    // Columnar batch is optional output, failure of building it won't fail the redo
+    if (OB_SUCC(ret) && need_build_columnar_batch) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = build_columnar_batch_())) {
+        LOG_WARN_RET(tmp_ret, "build columnar batch failed, records of the redo won't have columnar batch",
+            K(tmp_ret), K_(tls_id), K_(trans_id));
+      }
+    }
+
     if (OB_SUCC(ret)) {
       // Note: First set ref count before set formatted status, to avoid Sortter has get Dml Stmt
       set_row_ref_cnt(redo_node_->get_valid_row_num());
@@ -2427,6 +2444,95 @@ int ObLogEntryTask::link_row_list(int64_t &row_ref_cnt)
   return ret;
 }
 
+// Build columnar batches from the linked rows, all statements are formatted and no BinlogRecord is
+// output yet, so rows are appended by the only thread in row order.
+// Values are taken from the datums parsed from the mutator rows, not from the formatted BinlogRecord.
+int ObLogEntryTask::build_columnar_batch_()
+{
+  int ret = OB_SUCCESS;
+  ObLink *row = redo_node_->get_row_head();
+
+  while (OB_SUCC(ret) && NULL != row) {
+    DmlStmtTask *stmt_task = static_cast<DmlStmtTask *>(row);
+    if (OB_FAIL(append_columnar_row_(*stmt_task))) {
+      LOG_WARN("append_columnar_row_ failed", KR(ret), KPC(stmt_task));
+    } else {
+      row = row->next_;
+    }
+  }
+
+  for (ObCDCColumnarBatch *batch = columnar_batch_list_; OB_SUCC(ret) && NULL != batch; batch = batch->get_next()) {
+    if (OB_FAIL(batch->finish())) {
+      LOG_WARN("finish columnar batch failed", KR(ret), KPC(batch));
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+    // a batch partially built is not exposed
+    for (row = redo_node_->get_row_head(); NULL != row; row = row->next_) {
+      static_cast<DmlStmtTask *>(row)->set_columnar_batch(NULL, OB_INVALID_INDEX);
+    }
+    columnar_batch_list_ = NULL;
+  }
+
+  return ret;
+}
+
+int ObLogEntryTask::append_columnar_row_(DmlStmtTask &stmt_task)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t table_id = stmt_task.get_table_id();
+  const int32_t record_type = get_record_type(stmt_task.get_dml_flag());
+  ObCDCColumnarBatch *batch = columnar_batch_list_;
+  ColValueList *rowkey_cols = NULL;
+  ColValueList *new_cols = NULL;
+  ColValueList *old_cols = NULL;
+  ObLobDataOutRowCtxList *new_lob_ctx_cols = NULL;
+  int64_t row_idx = OB_INVALID_INDEX;
+
+  while (NULL != batch && batch->get_table_id() != table_id) {
+    batch = batch->get_next();
+  }
+
+  if (OB_UNLIKELY(EUNKNOWN == record_type)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("unknown dml flag for columnar batch", KR(ret), K(stmt_task));
+  } else if (OB_FAIL(stmt_task.get_cols(&rowkey_cols, &new_cols, &old_cols, &new_lob_ctx_cols))) {
+    LOG_ERROR("get_cols failed", KR(ret), K(stmt_task));
+  } else if (OB_ISNULL(rowkey_cols) || OB_ISNULL(new_cols) || OB_ISNULL(old_cols) || OB_ISNULL(new_lob_ctx_cols)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("cols is NULL", KR(ret), K(rowkey_cols), K(new_cols), K(old_cols), K(new_lob_ctx_cols));
+  } else if (NULL == batch) {
+    void *buf = NULL;
+    if (OB_ISNULL(buf = arena_allocator_.alloc(sizeof(ObCDCColumnarBatch)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_ERROR("alloc columnar batch failed", KR(ret), K(table_id));
+    } else if (FALSE_IT(batch = new (buf) ObCDCColumnarBatch(arena_allocator_))) {
+    } else if (OB_FAIL(batch->init(get_tenant_id(), table_id))) {
+      LOG_ERROR("init columnar batch failed", KR(ret), K(table_id));
+    } else {
+      batch->set_next(columnar_batch_list_);
+      columnar_batch_list_ = batch;
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    // DELETE carries old values, old values may only contain rowkey in minimal mode
+    const ColValueList *cols = new_cols;
+    if (EDELETE == record_type) {
+      cols = old_cols->num_ > 0 ? old_cols : rowkey_cols;
+    }
+
+    if (OB_FAIL(batch->append_row(record_type, cols->head_, *new_lob_ctx_cols, row_idx))) {
+      LOG_WARN("append row to columnar batch failed", KR(ret), K(record_type), K(stmt_task));
+    } else {
+      stmt_task.set_columnar_batch(batch, row_idx);
+    }
+  }
+
+  return ret;
+}
+
 int ObLogEntryTask::revert_binlog_record_(ObLogBR *br)
 {
   int ret = OB_SUCCESS;
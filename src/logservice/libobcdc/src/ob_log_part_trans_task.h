@@ -60,6 +60,7 @@ class PartTransTask;
 class ObLogBR;
 class ObLogEntryTask;
 class TableSchemaInfo;
+class ObCDCColumnarBatch;
 class ObCDCUdtValueMap;
 
 class IStmtTask : public ObLink   // Inheritance of ObLink is only used for Sequencer
@@ -567,6 +568,14 @@ public:
   bool is_callback() const { return 1 == is_callback_; }
   void mark_callback() { is_callback_ = 1; }
 
+  ObCDCColumnarBatch *get_columnar_batch() { return columnar_batch_; }
+  int64_t get_columnar_row_idx() const { return columnar_row_idx_; }
+  void set_columnar_batch(ObCDCColumnarBatch *batch, const int64_t row_idx)
+  {
+    columnar_batch_ = batch;
+    columnar_row_idx_ = row_idx;
+  }
+
 public:
   TO_STRING_KV("IStmtTask", static_cast<const IStmtTask &>(*this),
       "is_cb", is_callback_,
@@ -581,6 +590,8 @@ private:
   ObLogEntryTask          &log_entry_task_;
   uint64_t                table_id_;
   MutatorRow              &row_;
+  ObCDCColumnarBatch      *columnar_batch_;   // columnar batch the row belongs to, only in memory working mode
+  int64_t                 columnar_row_idx_;
 private:
   DISALLOW_COPY_AND_ASSIGN(DmlStmtTask);
 };
@@ -792,8 +803,9 @@ public:
 
   // 1. iterate through the formatted DmlStmt, concatenating all DmlStmtTask
   // 2. Recycle directly for invalid binlog records
+  // 3. Build columnar batch of each table if need_build_columnar_batch
   // return row ref cnt
-  int link_row_list(int64_t &row_ref_cnt);
+  int link_row_list(const bool need_build_columnar_batch, int64_t &row_ref_cnt);
 
   int set_redo_log_parsed();
   int set_redo_log_formatted();
@@ -812,6 +824,8 @@ public:
 
 private:
   int revert_binlog_record_(ObLogBR *br);
+  int build_columnar_batch_();
+  int append_columnar_row_(DmlStmtTask &stmt_task);
 
 private:
   void                   *host_;            // PartTransTask host
@@ -827,6 +841,7 @@ private:
   StmtList           stmt_list_;            // statement list
   int64_t            formatted_stmt_num_;   // Number of statements that formatted
   int64_t            row_ref_cnt_;          // reference count
+  ObCDCColumnarBatch *columnar_batch_list_; // columnar batch of each table, allocated by arena_allocator_
 
   // thread safe allocator
   // used for Parser/Formatter/LobDataMerger
@@ -0,0 +1,812 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * OBCDC Storage based on append-only segment files
+ */
+
+#define USING_LOG_PREFIX OBLOG_STORAGER
+
+#include <fcntl.h>
+#include <unistd.h>
+#include "ob_log_segment_store_service.h"
+#include "ob_log_utils.h"
+#include "lib/utility/ob_print_utils.h"     // databuff_printf
+#include "lib/file/file_directory_utils.h"  // FileDirectoryUtils
+#include "lib/oblog/ob_log.h"               // ObLogger
+#include "lib/oblog/ob_log_module.h"        // LOG_*
+#include "lib/ob_errno.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace libobcdc
+{
+ObLogSegmentStoreService::ObLogSegmentStoreService() :
+    is_inited_(false),
+    is_stopped_(true),
+    path_(),
+    segment_size_(DEFAULT_SEGMENT_SIZE),
+    next_cf_id_(0),
+    default_cf_(NULL)
+{
+}
+
+ObLogSegmentStoreService::~ObLogSegmentStoreService()
+{
+  destroy();
+}
+
+int ObLogSegmentStoreService::init(const std::string &path, const int64_t segment_size)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(is_inited_)) {
+    LOG_ERROR("ObLogSegmentStoreService has inited twice");
+    ret = OB_INIT_TWICE;
+  } else if (OB_UNLIKELY(path.empty() || segment_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), "path", path.c_str(), K(segment_size));
+  } else if (OB_FAIL(init_dir_(path.c_str()))) {
+    LOG_ERROR("init_dir_ fail", KR(ret));
+  } else {
+    path_ = path;
+    segment_size_ = segment_size;
+    next_cf_id_ = 0;
+
+    if (OB_FAIL(create_column_family_("default", default_cf_))) {
+      LOG_ERROR("create default column family fail", KR(ret));
+    } else {
+      _LOG_INFO("ObLogSegmentStoreService init success, path:%s, segment_size=%ld", path_.c_str(), segment_size_);
+      is_stopped_ = false;
+      is_inited_ = true;
+    }
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::close()
+{
+  int ret = OB_SUCCESS;
+
+  if (is_inited_) {
+    LOG_INFO("closing segment store ...");
+    mark_stop_flag();
+    // segment files are removed by init_dir_ at next start, nothing need to be persisted
+    LOG_INFO("segment store close succ");
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::init_dir_(const char *dir_path)
+{
+  int ret = OB_SUCCESS;
+  const static int64_t CMD_BUF_SIZE = 1024;
+  static char cmd_buf[CMD_BUF_SIZE];
+  int64_t cmd_pos = 0;
+
+  if (OB_FAIL(common::databuff_printf(cmd_buf, CMD_BUF_SIZE, cmd_pos, "rm -rf %s", dir_path))) {
+    LOG_ERROR("databuff_printf fail", K(ret), K(cmd_buf), K(cmd_pos), K(dir_path));
+  } else {
+    (void)system(cmd_buf);
+    LOG_INFO("system succ", K(cmd_buf), K(cmd_pos), K(dir_path));
+  }
+
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(common::FileDirectoryUtils::create_full_path(dir_path))) {
+      LOG_ERROR("FileDirectoryUtils create_full_path fail", K(ret), K(dir_path));
+    } else {
+      // succ
+    }
+  }
+
+  return ret;
+}
+
+void ObLogSegmentStoreService::destroy()
+{
+  if (is_inited_) {
+    LOG_INFO("segment store service destroy begin");
+    close();
+
+    if (OB_NOT_NULL(default_cf_)) {
+      destroy_column_family_(default_cf_);
+      default_cf_ = NULL;
+    }
+    path_.clear();
+    segment_size_ = DEFAULT_SEGMENT_SIZE;
+    next_cf_id_ = 0;
+    is_inited_ = false;
+    LOG_INFO("segment store service destroy end");
+  }
+}
+
+int ObLogSegmentStoreService::put(const std::string &key, const ObSlice &value)
+{
+  return put(default_cf_, key, value);
+}
+
+int ObLogSegmentStoreService::put(void *cf_handle, const std::string &key, const ObSlice &value)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+
+  if (OB_FAIL(check_state_(cf_handle, cf))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("check_state_ fail", KR(ret), K(cf_handle));
+    }
+  } else if (OB_FAIL(write_values_(*cf, &key, &value, 1))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("write value into segment store fail", KR(ret), "key", key.c_str(), K(value.buf_len_));
+    }
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::batch_write(void *cf_handle,
+    const std::vector<std::string> &keys,
+    const std::vector<ObSlice> &values)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+
+  if (OB_UNLIKELY(keys.size() != values.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("keys and values not match", KR(ret), "key_count", keys.size(), "value_count", values.size());
+  } else if (OB_FAIL(check_state_(cf_handle, cf))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("check_state_ fail", KR(ret), K(cf_handle));
+    }
+  } else if (keys.empty()) {
+    // do nothing
+  } else if (OB_FAIL(write_values_(*cf, &keys[0], &values[0], keys.size()))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("batch write values into segment store fail", KR(ret), "count", keys.size());
+    }
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::get(const std::string &key, std::string &value)
+{
+  return get(default_cf_, key, value);
+}
+
+int ObLogSegmentStoreService::get(void *cf_handle, const std::string &key, std::string &value)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+  ValuePos pos;
+  SegmentArray detached_segments;
+
+  if (OB_FAIL(check_state_(cf_handle, cf))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("check_state_ fail", KR(ret), K(cf_handle));
+    }
+  } else {
+    ObSpinLockGuard guard(cf->lock_);
+    ValueIndex::iterator iter = cf->index_.find(key);
+
+    if (cf->index_.end() == iter) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      pos = iter->second;
+      // pin the segment in case the value is deleted while reading
+      pos.segment_->ref_cnt_++;
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    value.resize(pos.len_);
+
+    if (pos.len_ > 0 && OB_FAIL(pread_(pos.segment_->fd_, &value[0], pos.len_, pos.offset_))) {
+      LOG_ERROR("read value from segment fail", KR(ret), "key", key.c_str(), KPC(pos.segment_),
+          "offset", pos.offset_, "len", pos.len_);
+    }
+
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      dec_ref_(*cf, pos.segment_, detached_segments);
+    }
+    free_segments_(*cf, detached_segments);
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::del(const std::string &key)
+{
+  return del(default_cf_, key);
+}
+
+int ObLogSegmentStoreService::del(void *cf_handle, const std::string &key)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+
+  if (OB_FAIL(check_state_(cf_handle, cf))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("check_state_ fail", KR(ret), K(cf_handle));
+    }
+  } else {
+    SegmentArray detached_segments;
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      ValueIndex::iterator iter = cf->index_.find(key);
+
+      if (cf->index_.end() != iter) {
+        (void)erase_(*cf, iter, detached_segments);
+      }
+    }
+    free_segments_(*cf, detached_segments);
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::del_range(void *cf_handle, const std::string &begin_key, const std::string &end_key)
+{
+  int ret = OB_SUCCESS;
+  int64_t start_ts = get_timestamp();
+  ColumnFamily *cf = NULL;
+  int64_t del_count = 0;
+
+  if (OB_FAIL(check_state_(cf_handle, cf))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("check_state_ fail", KR(ret), K(cf_handle));
+    }
+  } else {
+    SegmentArray detached_segments;
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      ValueIndex::iterator iter = cf->index_.lower_bound(begin_key);
+
+      while (cf->index_.end() != iter && iter->first < end_key) {
+        iter = erase_(*cf, iter, detached_segments);
+        del_count++;
+      }
+    }
+    free_segments_(*cf, detached_segments);
+  }
+
+  if (OB_SUCC(ret)) {
+    // NOTICE invoke this interface lob data clean task interval
+    double time_cost = (get_timestamp() - start_ts)/1000.0;
+    _LOG_INFO("DEL_RANGE time_cost=%.3lfms start_key=%s end_key=%s del_count=%ld",
+        time_cost, begin_key.c_str(), end_key.c_str(), del_count);
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::compact_range(
+    void *cf_handle,
+    const std::string &begin_key,
+    const std::string &end_key,
+    const bool op_entire_cf)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+
+  if (OB_FAIL(check_state_(cf_handle, cf))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("check_state_ fail", KR(ret), K(cf_handle));
+    }
+  } else {
+    // space of deleted values is reclaimed when the whole segment is deleted, nothing to compact
+    _LOG_DEBUG("COMPACT_RANGE [%s - %s] skipped by segment store, op_entire_cf=%d",
+        begin_key.c_str(), end_key.c_str(), op_entire_cf);
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::flush(void *cf_handle)
+{
+  int ret = OB_SUCCESS;
+  int64_t start_ts = get_timestamp();
+  ColumnFamily *cf = NULL;
+  Segment *segment = NULL;
+
+  if (OB_FAIL(check_state_(cf_handle, cf))) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("check_state_ fail", KR(ret), K(cf_handle));
+    }
+  } else {
+    ObSpinLockGuard guard(cf->lock_);
+
+    if (OB_NOT_NULL(segment = cf->active_segment_)) {
+      segment->ref_cnt_++;
+    }
+  }
+
+  // sync the active segment to bound dirty pages, sealed segments are left to the writeback of kernel
+  if (OB_SUCC(ret) && OB_NOT_NULL(segment)) {
+    if (0 != ::fdatasync(segment->fd_)) {
+      _LOG_WARN("SEGMENT STORE FLUSH failed, segment=%ld errno=%d", segment->segment_id_, errno);
+    } else {
+      int64_t time_cost = get_timestamp() - start_ts;
+      _LOG_INFO("SEGMENT STORE FLUSH SUCC, cf=%s segment=%ld time_cost=%s",
+          cf->name_.c_str(), segment->segment_id_, TVAL_TO_STR(time_cost));
+    }
+
+    SegmentArray detached_segments;
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      dec_ref_(*cf, segment, detached_segments);
+    }
+    free_segments_(*cf, detached_segments);
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::create_column_family(const std::string& column_family_name,
+    void *&cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+
+  if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(create_column_family_(column_family_name, cf))) {
+    LOG_ERROR("create column family fail", KR(ret), "column_family_name", column_family_name.c_str());
+  } else {
+    cf_handle = reinterpret_cast<void *>(cf);
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::create_column_family_(const std::string &column_family_name, ColumnFamily *&cf)
+{
+  int ret = OB_SUCCESS;
+  const int64_t cf_id = ATOMIC_FAA(&next_cf_id_, 1);
+  ColumnFamily *tmp_cf = NULL;
+
+  // column family name contains tenant name, use a sequence id as directory name instead
+  if (OB_ISNULL(tmp_cf = new(std::nothrow) ColumnFamily())) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("allocate ColumnFamily fail", KR(ret));
+  } else {
+    tmp_cf->name_ = column_family_name;
+    tmp_cf->dir_ = path_ + "/cf_" + std::to_string(cf_id);
+
+    if (OB_FAIL(FileDirectoryUtils::create_full_path(tmp_cf->dir_.c_str()))) {
+      LOG_ERROR("FileDirectoryUtils create_full_path fail", KR(ret), "dir", tmp_cf->dir_.c_str());
+      delete tmp_cf;
+      tmp_cf = NULL;
+    } else {
+      cf = tmp_cf;
+      LOG_INFO("segment store CreateColumnFamily succ", "column_family_name", column_family_name.c_str(),
+          "dir", cf->dir_.c_str(), K(cf), K_(segment_size));
+    }
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::drop_column_family(void *cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = static_cast<ColumnFamily *>(cf_handle);
+
+  if (OB_ISNULL(cf)) {
+    LOG_ERROR("column_family_handle is NULL");
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    SegmentArray detached_segments;
+    int64_t remain_segment_count = 0;
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      ValueIndex::iterator iter = cf->index_.begin();
+
+      cf->is_dropped_ = true;
+      while (cf->index_.end() != iter) {
+        iter = erase_(*cf, iter, detached_segments);
+      }
+
+      if (OB_NOT_NULL(cf->active_segment_)) {
+        Segment *segment = cf->active_segment_;
+        cf->active_segment_ = NULL;
+        segment->is_sealed_ = true;
+
+        if (0 == segment->ref_cnt_) {
+          detach_segment_(*cf, segment, detached_segments);
+        }
+      }
+      remain_segment_count = cf->segments_.size();
+    }
+    free_segments_(*cf, detached_segments);
+    LOG_INFO("segment store DropColumnFamily succ", "column_family_name", cf->name_.c_str(),
+        K(remain_segment_count));
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::destory_column_family(void *cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = static_cast<ColumnFamily *>(cf_handle);
+
+  if (OB_ISNULL(cf)) {
+    LOG_ERROR("column_family_handle is NULL");
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    destroy_column_family_(cf);
+    LOG_INFO("segment store DestroyColumnFamilyHandle succ");
+  }
+
+  return ret;
+}
+
+void ObLogSegmentStoreService::destroy_column_family_(ColumnFamily *cf)
+{
+  if (OB_NOT_NULL(cf)) {
+    int ret = OB_SUCCESS;
+    SegmentArray detached_segments;
+    cf->index_.clear();
+    cf->active_segment_ = NULL;
+
+    while (! cf->segments_.empty()) {
+      detach_segment_(*cf, cf->segments_.begin()->second, detached_segments);
+    }
+    free_segments_(*cf, detached_segments);
+
+    if (OB_FAIL(FileDirectoryUtils::delete_directory(cf->dir_.c_str()))) {
+      LOG_WARN("delete column family dir fail", KR(ret), "dir", cf->dir_.c_str());
+    }
+    delete cf;
+  }
+}
+
+void ObLogSegmentStoreService::get_mem_usage(const std::vector<uint64_t> ids,
+    const std::vector<void *> cf_handles)
+{
+  int ret = OB_SUCCESS;
+  int64_t total_num_keys = 0;
+  int64_t total_live_size = 0;
+  int64_t total_disk_size = 0;
+
+  for (int64_t idx = 0; OB_SUCC(ret) && !is_stopped() && idx < cf_handles.size(); ++idx) {
+    ColumnFamily *cf = static_cast<ColumnFamily *>(cf_handles[idx]);
+
+    if (OB_ISNULL(cf)) {
+      LOG_ERROR("column_family_handle is NULL");
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      int64_t num_keys = 0;
+      int64_t live_size = 0;
+      int64_t disk_size = 0;
+      int64_t segment_count = 0;
+      {
+        ObSpinLockGuard guard(cf->lock_);
+        num_keys = cf->index_.size();
+        live_size = cf->live_size_;
+        segment_count = cf->segments_.size();
+        for (SegmentMap::const_iterator iter = cf->segments_.begin(); iter != cf->segments_.end(); ++iter) {
+          disk_size += iter->second->write_offset_;
+        }
+      }
+
+      total_num_keys += num_keys;
+      total_live_size += live_size;
+      total_disk_size += disk_size;
+
+      LOG_INFO("[SEGMENT_STORE] [MEM]", "tenant_id", ids[idx],
+          "column_family_name", cf->name_.c_str(),
+          K(num_keys),
+          "live_size", SIZE_TO_STR(live_size),
+          "disk_size", SIZE_TO_STR(disk_size),
+          K(segment_count));
+    }
+  } // for
+
+  LOG_INFO("[SEGMENT_STORE] [TOTAL_MEM]",
+      "num_keys", total_num_keys,
+      "live_size", SIZE_TO_STR(total_live_size),
+      "disk_size", SIZE_TO_STR(total_disk_size));
+}
+
+int ObLogSegmentStoreService::get_mem_usage(void * cf_handle, int64_t &estimate_live_data_size, int64_t &estimate_num_keys)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = static_cast<ColumnFamily *>(cf_handle);
+
+  if (OB_ISNULL(cf)) {
+    LOG_ERROR("column_family_handle is NULL");
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    ObSpinLockGuard guard(cf->lock_);
+    estimate_live_data_size = cf->live_size_;
+    estimate_num_keys = cf->index_.size();
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::check_state_(void *cf_handle, ColumnFamily *&cf) const
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(! is_inited_)) {
+    ret = OB_NOT_INIT;
+  } else if (OB_ISNULL(cf = static_cast<ColumnFamily *>(cf_handle))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("column_family_handle is NULL", KR(ret));
+  } else if (is_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::write_values_(
+    ColumnFamily &cf,
+    const std::string *keys,
+    const ObSlice *values,
+    const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  int64_t data_len = 0;
+  Segment *segment = NULL;
+  int64_t offset = 0;
+
+  for (int64_t idx = 0; idx < count; ++idx) {
+    data_len += values[idx].buf_len_;
+  }
+
+  if (OB_FAIL(reserve_(cf, data_len, count, segment, offset))) {
+    LOG_ERROR("reserve space in segment fail", KR(ret), K(data_len), K(count));
+  } else {
+    int64_t write_offset = offset;
+
+    // values are written without lock, the reserved space is only visible after publish_
+    for (int64_t idx = 0; OB_SUCC(ret) && idx < count; ++idx) {
+      if (is_stopped()) {
+        ret = OB_IN_STOP_STATE;
+      } else if (OB_FAIL(pwrite_(segment->fd_, values[idx].buf_, values[idx].buf_len_, write_offset))) {
+        LOG_ERROR("write value into segment fail", KR(ret), KPC(segment), K(write_offset),
+            "len", values[idx].buf_len_);
+      } else {
+        write_offset += values[idx].buf_len_;
+      }
+    }
+
+    SegmentArray detached_segments;
+    write_offset = offset;
+    {
+      ObSpinLockGuard guard(cf.lock_);
+
+      for (int64_t idx = 0; idx < count; ++idx) {
+        if (OB_SUCC(ret)) {
+          publish_(cf, keys[idx], ValuePos(segment, write_offset, values[idx].buf_len_), detached_segments);
+          write_offset += values[idx].buf_len_;
+        } else {
+          dec_ref_(cf, segment, detached_segments);
+        }
+      }
+    }
+    free_segments_(cf, detached_segments);
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::reserve_(
+    ColumnFamily &cf,
+    const int64_t data_len,
+    const int64_t ref_cnt,
+    Segment *&segment,
+    int64_t &offset)
+{
+  int ret = OB_SUCCESS;
+  SegmentArray detached_segments;
+
+  {
+    ObSpinLockGuard guard(cf.lock_);
+
+    if (OB_UNLIKELY(cf.is_dropped_)) {
+      ret = OB_STATE_NOT_MATCH;
+      LOG_ERROR("column family is dropped", KR(ret), "column_family_name", cf.name_.c_str());
+    } else {
+      Segment *active_segment = cf.active_segment_;
+
+      // data larger than segment_size_ occupies a whole segment
+      if (OB_NOT_NULL(active_segment)
+          && active_segment->write_offset_ > 0
+          && active_segment->write_offset_ + data_len > segment_size_) {
+        cf.active_segment_ = NULL;
+        active_segment->is_sealed_ = true;
+
+        if (0 == active_segment->ref_cnt_) {
+          detach_segment_(cf, active_segment, detached_segments);
+        }
+        active_segment = NULL;
+      }
+
+      if (OB_ISNULL(active_segment)) {
+        if (OB_FAIL(open_segment_(cf, active_segment))) {
+          LOG_ERROR("open segment fail", KR(ret), "column_family_name", cf.name_.c_str());
+        } else {
+          cf.active_segment_ = active_segment;
+        }
+      }
+
+      if (OB_SUCC(ret)) {
+        segment = active_segment;
+        offset = segment->write_offset_;
+        segment->write_offset_ += data_len;
+        segment->ref_cnt_ += ref_cnt;
+      }
+    }
+  }
+  free_segments_(cf, detached_segments);
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::open_segment_(ColumnFamily &cf, Segment *&segment)
+{
+  int ret = OB_SUCCESS;
+  const int64_t segment_id = cf.next_segment_id_++;
+  const std::string segment_path = get_segment_path_(cf, segment_id);
+  int fd = -1;
+
+  if (OB_FAIL(FileDirectoryUtils::open(segment_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644, fd))) {
+    LOG_ERROR("open segment file fail", KR(ret), "segment_path", segment_path.c_str());
+  } else if (OB_ISNULL(segment = new(std::nothrow) Segment())) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("allocate Segment fail", KR(ret));
+    (void)FileDirectoryUtils::close(fd);
+    (void)FileDirectoryUtils::delete_file(segment_path.c_str());
+  } else {
+    segment->segment_id_ = segment_id;
+    segment->fd_ = fd;
+    cf.segments_[segment_id] = segment;
+    LOG_DEBUG("open segment succ", "column_family_name", cf.name_.c_str(), KPC(segment));
+  }
+
+  return ret;
+}
+
+std::string ObLogSegmentStoreService::get_segment_path_(const ColumnFamily &cf, const int64_t segment_id) const
+{
+  return cf.dir_ + "/" + std::to_string(segment_id) + ".seg";
+}
+
+void ObLogSegmentStoreService::publish_(
+    ColumnFamily &cf,
+    const std::string &key,
+    const ValuePos &pos,
+    SegmentArray &detached_segments)
+{
+  if (OB_UNLIKELY(cf.is_dropped_)) {
+    // column family is dropped while writing, discard the value
+    dec_ref_(cf, pos.segment_, detached_segments);
+  } else {
+    std::pair<ValueIndex::iterator, bool> insert_ret = cf.index_.insert(std::make_pair(key, pos));
+
+    if (! insert_ret.second) {
+      // overwrite: release the old value
+      ValuePos &old_pos = insert_ret.first->second;
+      old_pos.segment_->live_size_ -= old_pos.len_;
+      cf.live_size_ -= old_pos.len_;
+      dec_ref_(cf, old_pos.segment_, detached_segments);
+      old_pos = pos;
+    }
+    pos.segment_->live_size_ += pos.len_;
+    cf.live_size_ += pos.len_;
+  }
+}
+
+void ObLogSegmentStoreService::dec_ref_(ColumnFamily &cf, Segment *segment, SegmentArray &detached_segments)
+{
+  if (OB_NOT_NULL(segment)) {
+    if (0 == --segment->ref_cnt_ && segment->is_sealed_) {
+      detach_segment_(cf, segment, detached_segments);
+    }
+  }
+}
+
+ObLogSegmentStoreService::ValueIndex::iterator ObLogSegmentStoreService::erase_(
+    ColumnFamily &cf,
+    ValueIndex::iterator iter,
+    SegmentArray &detached_segments)
+{
+  Segment *segment = iter->second.segment_;
+  segment->live_size_ -= iter->second.len_;
+  cf.live_size_ -= iter->second.len_;
+  dec_ref_(cf, segment, detached_segments);
+  return cf.index_.erase(iter);
+}
+
+void ObLogSegmentStoreService::detach_segment_(
+    ColumnFamily &cf,
+    Segment *segment,
+    SegmentArray &detached_segments)
+{
+  cf.segments_.erase(segment->segment_id_);
+  detached_segments.push_back(segment);
+}
+
+void ObLogSegmentStoreService::free_segments_(const ColumnFamily &cf, SegmentArray &detached_segments)
+{
+  for (int64_t idx = 0; idx < detached_segments.size(); ++idx) {
+    int ret = OB_SUCCESS;
+    Segment *segment = detached_segments[idx];
+    const std::string segment_path = get_segment_path_(cf, segment->segment_id_);
+
+    if (segment->fd_ >= 0 && OB_FAIL(FileDirectoryUtils::close(segment->fd_))) {
+      LOG_WARN("close segment file fail", KR(ret), KPC(segment));
+    }
+
+    if (OB_FAIL(FileDirectoryUtils::delete_file(segment_path.c_str()))) {
+      LOG_WARN("delete segment file fail", KR(ret), "segment_path", segment_path.c_str());
+    } else {
+      LOG_DEBUG("free segment succ", "column_family_name", cf.name_.c_str(), KPC(segment));
+    }
+    delete segment;
+  }
+  detached_segments.clear();
+}
+
+int ObLogSegmentStoreService::pwrite_(const int fd, const char *buf, const int64_t buf_len, const int64_t offset)
+{
+  int ret = OB_SUCCESS;
+  int64_t write_len = 0;
+
+  while (OB_SUCC(ret) && write_len < buf_len) {
+    const ssize_t cur_len = ::pwrite(fd, buf + write_len, buf_len - write_len, offset + write_len);
+
+    if (cur_len < 0) {
+      if (EINTR != errno) {
+        ret = OB_IO_ERROR;
+        LOG_ERROR("pwrite fail", KR(ret), K(fd), K(buf_len), K(offset), K(write_len), K(errno), KERRMSG);
+      }
+    } else {
+      write_len += cur_len;
+    }
+  }
+
+  return ret;
+}
+
+int ObLogSegmentStoreService::pread_(const int fd, char *buf, const int64_t buf_len, const int64_t offset)
+{
+  int ret = OB_SUCCESS;
+  int64_t read_len = 0;
+
+  while (OB_SUCC(ret) && read_len < buf_len) {
+    const ssize_t cur_len = ::pread(fd, buf + read_len, buf_len - read_len, offset + read_len);
+
+    if (cur_len < 0) {
+      if (EINTR != errno) {
+        ret = OB_IO_ERROR;
+        LOG_ERROR("pread fail", KR(ret), K(fd), K(buf_len), K(offset), K(read_len), K(errno), KERRMSG);
+      }
+    } else if (0 == cur_len) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("unexpected end of segment file", KR(ret), K(fd), K(buf_len), K(offset), K(read_len));
+    } else {
+      read_len += cur_len;
+    }
+  }
+
+  return ret;
+}
+
+}
+}
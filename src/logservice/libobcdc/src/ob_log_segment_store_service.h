@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * OBCDC Storage based on append-only segment files
+ *
+ * Redo of large transactions is written once and read once, so values are appended to
+ * sequential segment files of each column family and located by an in-memory index.
+ * Deleted values are never rewritten: a segment file is removed once all values in it
+ * are deleted, which replaces the compaction of LSM tree.
+ */
+
+#ifndef OCEANBASE_LIBOBCDC_OB_LOG_SEGMENT_STORE_SERVICE_H_
+#define OCEANBASE_LIBOBCDC_OB_LOG_SEGMENT_STORE_SERVICE_H_
+
+#include <map>
+#include <vector>
+#include "ob_log_store_service.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/lock/ob_spin_lock.h"          // ObSpinLock
+#include "lib/utility/ob_print_utils.h"     // TO_STRING_KV
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+class ObLogSegmentStoreService : public IObStoreService
+{
+public:
+  static const int64_t DEFAULT_SEGMENT_SIZE = 64L << 20;
+
+public:
+  ObLogSegmentStoreService();
+  virtual ~ObLogSegmentStoreService();
+  // segment_size: size of segment file, a new segment is opened when the active one is full
+  int init(const std::string &path, const int64_t segment_size = DEFAULT_SEGMENT_SIZE);
+  void destroy();
+
+public:
+  // Default ColumnFamily put/get/del
+  // Assign ColumnFamily put/get/del
+  virtual int put(const std::string &key, const ObSlice &value);
+  virtual int put(void *cf_handle, const std::string &key, const ObSlice &value);
+
+  virtual int batch_write(void *cf_handle, const std::vector<std::string> &keys, const std::vector<ObSlice> &values);
+
+  virtual int get(const std::string &key, std::string &value);
+  virtual int get(void *cf_handle, const std::string &key, std::string &value);
+
+  virtual int del(const std::string &key);
+  virtual int del(void *cf_handle, const std::string &key);
+  virtual int del_range(void *cf_handle, const std::string &begin_key, const std::string &end_key);
+  virtual int compact_range(
+      void *cf_handle,
+      const std::string &begin_key,
+      const std::string &end_key,
+      const bool op_entire_cf = false);
+  virtual int flush(void *cf_handle);
+
+  virtual int create_column_family(const std::string& column_family_name,
+      void *&cf_handle);
+  virtual int drop_column_family(void *cf_handle);
+  virtual int destory_column_family(void *cf_handle);
+
+  virtual void mark_stop_flag() override { ATOMIC_SET(&is_stopped_, true); }
+  virtual int close() override;
+  virtual void get_mem_usage(const std::vector<uint64_t> ids,
+      const std::vector<void *> cf_handles);
+  virtual int get_mem_usage(void * cf_handle, int64_t &estimate_live_data_size, int64_t &estimate_num_keys);
+  OB_INLINE bool is_stopped() const { return ATOMIC_LOAD(&is_stopped_); }
+
+private:
+  struct Segment
+  {
+    int64_t segment_id_;
+    int fd_;
+    int64_t write_offset_;
+    // live values and on-going read/write of the segment, the segment file is removed
+    // when it is sealed and ref_cnt_ drops to 0
+    int64_t ref_cnt_;
+    int64_t live_size_;
+    bool is_sealed_;
+
+    Segment() : segment_id_(0), fd_(-1), write_offset_(0), ref_cnt_(0), live_size_(0), is_sealed_(false) {}
+    TO_STRING_KV(K_(segment_id), K_(fd), K_(write_offset), K_(ref_cnt), K_(live_size), K_(is_sealed));
+  };
+
+  struct ValuePos
+  {
+    Segment *segment_;
+    int64_t offset_;
+    int64_t len_;
+
+    ValuePos() : segment_(NULL), offset_(0), len_(0) {}
+    ValuePos(Segment *segment, const int64_t offset, const int64_t len) :
+        segment_(segment), offset_(offset), len_(len) {}
+  };
+
+  typedef std::map<std::string, ValuePos> ValueIndex;
+  typedef std::map<int64_t, Segment *> SegmentMap;
+  // segments detached from column family under lock, whose files are closed and removed after unlock
+  typedef std::vector<Segment *> SegmentArray;
+
+  struct ColumnFamily
+  {
+    std::string name_;
+    std::string dir_;
+    common::ObSpinLock lock_;
+    ValueIndex index_;
+    Segment *active_segment_;
+    SegmentMap segments_;
+    int64_t next_segment_id_;
+    int64_t live_size_;
+    bool is_dropped_;
+
+    ColumnFamily() : name_(), dir_(), lock_(), index_(), active_segment_(NULL), segments_(),
+        next_segment_id_(0), live_size_(0), is_dropped_(false) {}
+  };
+
+private:
+  int init_dir_(const char *dir_path);
+  int create_column_family_(const std::string &column_family_name, ColumnFamily *&cf);
+  void destroy_column_family_(ColumnFamily *cf);
+  int check_state_(void *cf_handle, ColumnFamily *&cf) const;
+  // reserve continuous space of data_len in the active segment and hold ref_cnt refs of the segment,
+  // one for each value to be published
+  int reserve_(ColumnFamily &cf, const int64_t data_len, const int64_t ref_cnt, Segment *&segment, int64_t &offset);
+  int open_segment_(ColumnFamily &cf, Segment *&segment);
+  std::string get_segment_path_(const ColumnFamily &cf, const int64_t segment_id) const;
+  // publish value into index, the ref held by reserve_ is transferred to the index
+  void publish_(ColumnFamily &cf, const std::string &key, const ValuePos &pos, SegmentArray &detached_segments);
+  // release a ref of segment, must be called with lock of cf held
+  void dec_ref_(ColumnFamily &cf, Segment *segment, SegmentArray &detached_segments);
+  // erase value from index and return iterator of the next value
+  ValueIndex::iterator erase_(ColumnFamily &cf, ValueIndex::iterator iter, SegmentArray &detached_segments);
+  // remove segment from cf, must be called with lock of cf held
+  void detach_segment_(ColumnFamily &cf, Segment *segment, SegmentArray &detached_segments);
+  // close and remove files of detached segments, must be called without lock of cf held
+  void free_segments_(const ColumnFamily &cf, SegmentArray &detached_segments);
+  // append values to one segment continuously, and publish them after all of them are written
+  int write_values_(ColumnFamily &cf, const std::string *keys, const ObSlice *values, const int64_t count);
+  int pwrite_(const int fd, const char *buf, const int64_t buf_len, const int64_t offset);
+  int pread_(const int fd, char *buf, const int64_t buf_len, const int64_t offset);
+
+private:
+  bool is_inited_;
+  bool is_stopped_;
+  std::string path_;
+  int64_t segment_size_;
+  int64_t next_cf_id_;
+  ColumnFamily *default_cf_;
+};
+
+}
+}
+
+#endif
@@ -115,6 +115,38 @@ void SorterStatInfo::calc_and_print_stat(int64_t delta_time)
   }
 }
 
+void ParserStatInfo::calc_and_print_stat(int64_t delta_time)
+{
+  int64_t parsed_redo_count = 0;
+  int64_t parsed_redo_size = 0;
+  int64_t parse_time = 0;
+
+  get_and_reset_parser_stat(parsed_redo_count, parsed_redo_size, parse_time);
+
+  if (delta_time > 0) {
+    double parse_redo_tps = (double)(parsed_redo_count) * 1000000.0 / (double)delta_time;
+    int64_t parse_traffic = static_cast<int64_t>((double)(parsed_redo_size) * 1000000.0 / (double)delta_time);
+    double avg_parse_time = (0 == parsed_redo_count) ? 0.0 : (double)parse_time / (double)parsed_redo_count;
+    _ISTAT("[PARSER_STAT] PARSE_REDO_TPS=%.3lf PARSE_TRAFFIC=%s/sec AVG_PARSE_TIME=%.3lfus ",
+      parse_redo_tps, SIZE_TO_STR(parse_traffic), avg_parse_time);
+  }
+}
+
+void FormatterStatInfo::calc_and_print_stat(int64_t delta_time)
+{
+  int64_t formatted_stmt_count = 0;
+  int64_t format_time = 0;
+
+  get_and_reset_formatter_stat(formatted_stmt_count, format_time);
+
+  if (delta_time > 0) {
+    double format_stmt_rps = (double)(formatted_stmt_count) * 1000000.0 / (double)delta_time;
+    double avg_format_time = (0 == formatted_stmt_count) ? 0.0 : (double)format_time / (double)formatted_stmt_count;
+    _ISTAT("[FORMATTER_STAT] FORMAT_STMT_RPS=%.3lf AVG_FORMAT_TIME=%.3lfus ",
+      format_stmt_rps, avg_format_time);
+  }
+}
+
 ///////////////////////////// TransTpsRpsStatInfo ///////////////////////////
 ObLogTransStatMgr::ObLogTransStatMgr() :
     inited_(false),
@@ -127,6 +159,8 @@ ObLogTransStatMgr::ObLogTransStatMgr() :
     release_record_stat_(),
     dispatcher_stat_(),
     sorter_stat_(),
+    parser_stat_(),
+    formatter_stat_(),
     last_stat_time_(0)
 {
 }
@@ -156,6 +190,8 @@ int ObLogTransStatMgr::init()
     release_record_stat_.reset();
     dispatcher_stat_.reset();
     sorter_stat_.reset();
+    parser_stat_.reset();
+    formatter_stat_.reset();
     last_stat_time_ = 0;
     inited_ = true;
   }
@@ -177,6 +213,8 @@ void ObLogTransStatMgr::destroy()
     release_record_stat_.reset();
     dispatcher_stat_.reset();
     sorter_stat_.reset();
+    parser_stat_.reset();
+    formatter_stat_.reset();
     last_stat_time_ = 0;
     inited_ = false;
   }
@@ -237,6 +275,16 @@ void ObLogTransStatMgr::do_sort_br_stat()
   sorter_stat_.inc_sorted_br_count();
 }
 
+void ObLogTransStatMgr::do_parse_redo_stat(const int64_t redo_size, const int64_t parse_time)
+{
+  parser_stat_.inc_parsed_redo(redo_size, parse_time);
+}
+
+void ObLogTransStatMgr::do_format_stmt_stat(const int64_t format_time)
+{
+  formatter_stat_.inc_formatted_stmt(format_time);
+}
+
 void ObLogTransStatMgr::print_stat_info()
 {
   int ret = OB_SUCCESS;
@@ -245,8 +293,10 @@ void ObLogTransStatMgr::print_stat_info()
   int64_t local_last_stat_time = last_stat_time_;
   int64_t delta_time = current_timestamp - local_last_stat_time;
 
-  // calc and print stat info of dispatcher and sorter
+  // calc and print stat info of each stage: dispatcher, parser, formatter and sorter
   dispatcher_stat_.calc_and_print_stat(delta_time);
+  parser_stat_.calc_and_print_stat(delta_time);
+  formatter_stat_.calc_and_print_stat(delta_time);
   sorter_stat_.calc_and_print_stat(delta_time);
 
   double create_tps = tps_stat_info_.calc_tps(delta_time);
@@ -166,6 +166,63 @@ struct SorterStatInfo
   void calc_and_print_stat(int64_t delta_time);
 };
 
+// Redo parse throughput of DML parser, used to locate the bottleneck stage of the pipeline
+struct ParserStatInfo
+{
+  int64_t parsed_redo_count_;
+  int64_t parsed_redo_size_;
+  int64_t parse_time_;
+
+  void reset()
+  {
+    ATOMIC_SET(&parsed_redo_count_, 0);
+    ATOMIC_SET(&parsed_redo_size_, 0);
+    ATOMIC_SET(&parse_time_, 0);
+  }
+
+  void inc_parsed_redo(const int64_t redo_size, const int64_t parse_time)
+  {
+    ATOMIC_INC(&parsed_redo_count_);
+    ATOMIC_AAF(&parsed_redo_size_, redo_size);
+    ATOMIC_AAF(&parse_time_, parse_time);
+  }
+
+  void get_and_reset_parser_stat(int64_t &redo_count, int64_t &redo_size, int64_t &parse_time)
+  {
+    redo_count = ATOMIC_TAS(&parsed_redo_count_, 0);
+    redo_size = ATOMIC_TAS(&parsed_redo_size_, 0);
+    parse_time = ATOMIC_TAS(&parse_time_, 0);
+  }
+
+  void calc_and_print_stat(int64_t delta_time);
+};
+
+struct FormatterStatInfo
+{
+  int64_t formatted_stmt_count_;
+  int64_t format_time_;
+
+  void reset()
+  {
+    ATOMIC_SET(&formatted_stmt_count_, 0);
+    ATOMIC_SET(&format_time_, 0);
+  }
+
+  void inc_formatted_stmt(const int64_t format_time)
+  {
+    ATOMIC_INC(&formatted_stmt_count_);
+    ATOMIC_AAF(&format_time_, format_time);
+  }
+
+  void get_and_reset_formatter_stat(int64_t &stmt_count, int64_t &format_time)
+  {
+    stmt_count = ATOMIC_TAS(&formatted_stmt_count_, 0);
+    format_time = ATOMIC_TAS(&format_time_, 0);
+  }
+
+  void calc_and_print_stat(int64_t delta_time);
+};
+
 class IObLogTransStatMgr
 {
 public:
@@ -198,6 +255,10 @@ public:
   // sorter
   virtual void do_sort_trans_stat() = 0;
   virtual void do_sort_br_stat() = 0;
+  // dml parser
+  virtual void do_parse_redo_stat(const int64_t redo_size, const int64_t parse_time) = 0;
+  // formatter
+  virtual void do_format_stmt_stat(const int64_t format_time) = 0;
 
   // print stat info
   virtual void print_stat_info() = 0;
@@ -231,6 +292,8 @@ public:
   void do_dispatch_redo_stat();
   void do_sort_trans_stat();
   void do_sort_br_stat();
+  void do_parse_redo_stat(const int64_t redo_size, const int64_t parse_time);
+  void do_format_stmt_stat(const int64_t format_time);
 
   void print_stat_info();
 
@@ -375,6 +438,8 @@ private:
   TransTpsRpsStatInfo   release_record_stat_ CACHE_ALIGNED;  // Statistics release_record: tps and rps information
   DispatcherStatInfo    dispatcher_stat_ CACHE_ALIGNED;
   SorterStatInfo        sorter_stat_ CACHE_ALIGNED;
+  ParserStatInfo        parser_stat_ CACHE_ALIGNED;
+  FormatterStatInfo     formatter_stat_ CACHE_ALIGNED;
 
   // 记录统计时间
   int64_t               last_stat_time_ CACHE_ALIGNED;
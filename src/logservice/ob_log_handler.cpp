@@ -60,6 +60,7 @@ ObLogHandler::ObLogHandler() : self_(),
                                is_offline_(false),
 #ifdef OB_BUILD_LOG_STORAGE_COMPRESS
                                compressor_wrapper_(),
+                               compress_cost_stat_("[LOG STORAGE COMPRESS COST TIME]", 10 * 1000 * 1000),
 #endif
                                get_max_decided_scn_debug_time_(OB_INVALID_TIMESTAMP)
 #ifdef OB_BUILD_SHARED_STORAGE
@@ -1487,10 +1488,14 @@ int ObLogHandler::append_(const void *buffer,
   bool log_compressed = false;
 #ifdef OB_BUILD_LOG_STORAGE_COMPRESS
   if (allow_compress) {
+    const int64_t compress_start_ts = ObTimeUtility::fast_current_time();
     if (OB_FAIL(compressor_wrapper_.compress_payload(buffer, nbytes, compression_buf,
                                                      log_compressed, final_buf, final_nbytes))) {
       //compress_payload() always return OB_SUCCESS
     }
+    const int64_t compress_cost = ObTimeUtility::fast_current_time() - compress_start_ts;
+    EVENT_ADD(LOG_STORAGE_COMPRESS_TIME, compress_cost);
+    compress_cost_stat_.stat(1, compress_cost);
   }
 #endif
   const int64_t begin_ts = ObClockGenerator::getClock();
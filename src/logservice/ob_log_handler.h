@@ -895,6 +895,7 @@ private:
   bool is_offline_;
 #ifdef OB_BUILD_LOG_STORAGE_COMPRESS
   ObLogCompressorWrapper compressor_wrapper_;
+  ObMiniStat::ObStatItem compress_cost_stat_;
 #endif
   mutable int64_t get_max_decided_scn_debug_time_;
 #ifdef OB_BUILD_SHARED_STORAGE
@@ -432,7 +432,8 @@ void FillBuf::update_state(const LSN &aligned_lsn, const int64_t flashback_versi
 //============================================= LogColdCache ==========================
 LogColdCache::LogColdCache()
     : palf_id_(INVALID_PALF_ID), palf_env_impl_(NULL), log_reader_(NULL),
-      kv_cache_(NULL), logical_block_size_(0), log_cache_stat_(), is_inited_(false) {}
+      kv_cache_(NULL), logical_block_size_(0), log_cache_stat_(), read_ahead_window_(),
+      is_inited_(false) {}
 
 int LogColdCache::init(const int64_t palf_id,
                        IPalfEnvImpl *palf_env_impl,
@@ -469,6 +470,7 @@ void LogColdCache::destroy()
   log_reader_ = NULL;
   kv_cache_ = NULL;
   log_cache_stat_.reset();
+  read_ahead_window_.reset();
   is_inited_ = false;
 }
 
@@ -501,12 +503,15 @@ int LogColdCache::read(const int64_t flashback_version,
                        const int64_t in_read_size,
                        ReadBuf &read_buf,
                        int64_t &out_read_size,
-                       LogIteratorInfo *iterator_info)
+                       LogIteratorInfo *iterator_info,
+                       const LSN &read_ahead_limit_lsn)
 {
   #define PRINT_INFO K_(palf_id), K_(tenant_id)
 
   int ret = OB_SUCCESS;
   bool enable_fill_cache = false;
+  int64_t read_ahead_size = 0;
+  int64_t read_ahead_bytes = 0;
   int64_t cache_lines_read_size = 0;
   int64_t cache_out_read_size = 0;
   LSN read_lsn = lsn;
@@ -516,8 +521,9 @@ int LogColdCache::read(const int64_t flashback_version,
   // read process:
   // 1. read from kv cache
   // 2. deal with miss if miss happens
-  // 3. read from disk
-  // 4. fill kv cache when it's allowed
+  // 3. extend the disk read to read ahead if the reader is sequential
+  // 4. read from disk
+  // 5. fill kv cache when it's allowed
   if (OB_SUCC(get_cache_lines_(lsn, flashback_version,
                                in_read_size, read_buf.buf_, cache_lines_read_size, iterator_info))) {
     // read all logs from kv cache successfully
@@ -528,12 +534,16 @@ int LogColdCache::read(const int64_t flashback_version,
     if (OB_FAIL(read_from_disk_(lsn, in_read_size, read_buf, out_read_size, iterator_info))) {
       PALF_LOG(WARN, "read_from_disk_ failed", K(ret), K(original_ret), K(lsn), K(in_read_size), K(out_read_size));
     }
-  } else if (OB_FAIL(allow_filling_cache_(iterator_info, enable_fill_cache))) {
+  } else if (OB_FAIL(allow_filling_cache_(flashback_version, lsn, iterator_info,
+                                          enable_fill_cache, read_ahead_size))) {
     PALF_LOG(WARN, "allow_filling_cache failed", K(ret), K(enable_fill_cache), PRINT_INFO);
   } else if (OB_FAIL(deal_with_miss_(enable_fill_cache, cache_lines_read_size, read_buf.buf_len_, read_lsn,
                                      real_read_size, cache_out_read_size, iterator_info))) {
     PALF_LOG(WARN, "fail to deal with miss", K(ret), K(cache_lines_read_size), K(enable_fill_cache),
              K(read_lsn), K(real_read_size), K(out_read_size), K(cache_out_read_size), PRINT_INFO);
+  } else if (FALSE_IT(extend_read_ahead_(lsn + in_read_size, read_ahead_size, read_ahead_limit_lsn,
+                                         read_buf.buf_len_ - cache_out_read_size, read_lsn,
+                                         real_read_size, read_ahead_bytes))) {
   } else if (FALSE_IT(read_buf.buf_ += cache_out_read_size)) {
   } else if (OB_FAIL(read_from_disk_(read_lsn, real_read_size, read_buf,
                                      disk_out_read_size, iterator_info))) {
@@ -552,9 +562,19 @@ int LogColdCache::read(const int64_t flashback_version,
       // so, adjust buf_ to ignore 'diff' part before return
       offset_t diff = lsn - read_lsn;
       out_read_size = out_read_size - diff;
+      out_read_size = (0 < read_ahead_bytes) ? MIN(out_read_size, in_read_size) : out_read_size;
       MEMMOVE(read_buf.buf_, read_buf.buf_ + diff, out_read_size);
       PALF_LOG(TRACE, "ignore redundant logs in read_buf", K(lsn), K(read_lsn), K(diff), K(out_read_size), K(enable_fill_cache));
     }
+
+    if (OB_SUCC(ret) && 0 < read_ahead_bytes) {
+      // logs read ahead are only used to fill cache, return what the reader asked for
+      out_read_size = MIN(out_read_size, in_read_size);
+      read_ahead_window_.update(flashback_version, read_lsn, read_lsn + disk_out_read_size, iterator_info);
+      log_cache_stat_.inc_read_ahead(read_ahead_bytes);
+      PALF_LOG(TRACE, "read ahead successfully", K(lsn), K(in_read_size), K(read_lsn), K(disk_out_read_size),
+               K(read_ahead_bytes), K_(read_ahead_window), PRINT_INFO);
+    }
   }
 
   #undef PRINT_INFO
@@ -577,20 +597,67 @@ int LogColdCache::fill_cache_line(FillBuf &fill_buf)
   return ret;
 }
 
-int LogColdCache::allow_filling_cache_(LogIteratorInfo *iterator_info, bool &enable_fill_cache)
+int LogColdCache::allow_filling_cache_(const int64_t flashback_version,
+                                       const LSN &lsn,
+                                       LogIteratorInfo *iterator_info,
+                                       bool &enable_fill_cache,
+                                       int64_t &read_ahead_size)
 {
   int ret = OB_SUCCESS;
   PalfOptions options;
   enable_fill_cache = false;
+  read_ahead_size = 0;
   if (OB_FAIL(palf_env_impl_->get_options(options))) {
     PALF_LOG(WARN, "get options failed", K(ret));
+  } else if (!options.enable_log_cache_) {
   } else {
-    enable_fill_cache = options.enable_log_cache_ && iterator_info->get_allow_filling_cache();
+    const bool is_following_window = read_ahead_window_.is_following(flashback_version, lsn, iterator_info);
+    if (read_ahead_window_.contains(flashback_version, lsn)) {
+      // logs read ahead have been washed out before being read
+      log_cache_stat_.inc_read_ahead_miss_cnt();
+    }
+    if (iterator_info->get_allow_filling_cache()) {
+      enable_fill_cache = true;
+      if (is_following_window || iterator_info->is_sequential_read(lsn)) {
+        read_ahead_size = options.log_cache_read_ahead_size_;
+      }
+    } else if (is_following_window && 0 < options.log_cache_read_ahead_size_) {
+      // the reader isn't allowed to fill cache by itself, but other readers are reading
+      // the same range, so read ahead on behalf of them.
+      enable_fill_cache = true;
+      read_ahead_size = options.log_cache_read_ahead_size_;
+    }
   }
 
   return ret;
 }
 
+void LogColdCache::extend_read_ahead_(const LSN &read_end_lsn,
+                                      const int64_t read_ahead_size,
+                                      const LSN &read_ahead_limit_lsn,
+                                      const int64_t buf_len,
+                                      const LSN &read_lsn,
+                                      int64_t &read_size,
+                                      int64_t &read_ahead_bytes) const
+{
+  read_ahead_bytes = 0;
+  if (0 >= read_ahead_size || !read_ahead_limit_lsn.is_valid() || read_ahead_limit_lsn <= read_end_lsn) {
+    // no need to read ahead
+  } else {
+    LSN target_end_lsn = MIN(read_end_lsn + read_ahead_size, read_ahead_limit_lsn);
+    // incomplete cache lines are not filled except for the last cache line of the block
+    if (target_end_lsn != LogCacheUtils::next_block_start_lsn(read_lsn)) {
+      target_end_lsn = LogCacheUtils::lower_align_with_start(target_end_lsn, CACHE_LINE_SIZE);
+    }
+    const int64_t target_read_size = (target_end_lsn > read_lsn) ?
+        MIN(static_cast<int64_t>(target_end_lsn - read_lsn), buf_len) : 0;
+    if (target_read_size > read_size) {
+      read_ahead_bytes = target_read_size - read_size;
+      read_size = target_read_size;
+    }
+  }
+}
+
 int LogColdCache::deal_with_miss_(const bool enable_fill_cache,
                                   const int64_t has_read_size,
                                   const int64_t buf_len,
@@ -660,6 +727,9 @@ int LogColdCache::get_cache_lines_(const LSN &lsn,
   if (out_read_size != 0) {
     log_cache_stat_.inc_hit_cnt();
     log_cache_stat_.inc_cache_read_size(out_read_size);
+    if (read_ahead_window_.contains(flashback_version, lsn)) {
+      log_cache_stat_.inc_read_ahead_hit_cnt();
+    }
 
     iterator_info->inc_hit_cnt();
     iterator_info->inc_cache_read_size(out_read_size);
@@ -830,10 +900,62 @@ offset_t LogColdCache::get_phy_offset_(const LSN &lsn) const
   return lsn_2_offset(lsn, logical_block_size_) + MAX_INFO_BLOCK_SIZE;
 }
 
+// =======================================ReadAheadWindow=======================================
+LogColdCache::ReadAheadWindow::ReadAheadWindow()
+    : lock_(), flashback_version_(-1), start_lsn_(), end_lsn_(), opener_(NULL) {}
+
+LogColdCache::ReadAheadWindow::~ReadAheadWindow()
+{
+  reset();
+}
+
+void LogColdCache::ReadAheadWindow::reset()
+{
+  SpinLockGuard guard(lock_);
+  flashback_version_ = -1;
+  start_lsn_.reset();
+  end_lsn_.reset();
+  opener_ = NULL;
+}
+
+void LogColdCache::ReadAheadWindow::update(const int64_t flashback_version,
+                                           const LSN &start_lsn,
+                                           const LSN &end_lsn,
+                                           const LogIteratorInfo *opener)
+{
+  SpinLockGuard guard(lock_);
+  // several readers may read ahead concurrently, keep the window which goes further
+  if (flashback_version != flashback_version_ || !end_lsn_.is_valid() || end_lsn > end_lsn_) {
+    flashback_version_ = flashback_version;
+    start_lsn_ = start_lsn;
+    end_lsn_ = end_lsn;
+    opener_ = opener;
+  }
+}
+
+bool LogColdCache::ReadAheadWindow::contains(const int64_t flashback_version, const LSN &lsn) const
+{
+  SpinLockGuard guard(lock_);
+  return flashback_version == flashback_version_ && start_lsn_.is_valid()
+      && lsn >= start_lsn_ && lsn < end_lsn_;
+}
+
+bool LogColdCache::ReadAheadWindow::is_following(const int64_t flashback_version,
+                                                 const LSN &lsn,
+                                                 const LogIteratorInfo *reader) const
+{
+  SpinLockGuard guard(lock_);
+  // a lone reader extending its own window isn't shared by anyone, otherwise a reader
+  // which isn't allowed to fill cache would keep filling cache by itself
+  return flashback_version == flashback_version_ && start_lsn_.is_valid()
+      && lsn >= start_lsn_ && (lsn < end_lsn_ || (lsn == end_lsn_ && reader != opener_));
+}
+
 // =======================================LogCacheStat=======================================
 LogColdCache::LogCacheStat::LogCacheStat()
-    : hit_cnt_(0), miss_cnt_(0), cache_read_size_(0), cache_fill_amplification_(0), last_print_time_(0),
-      last_record_hit_cnt_(0), last_record_miss_cnt_(0),
+    : hit_cnt_(0), miss_cnt_(0), cache_read_size_(0), cache_fill_amplification_(0),
+      read_ahead_cnt_(0), read_ahead_size_(0), read_ahead_hit_cnt_(0), read_ahead_miss_cnt_(0),
+      last_print_time_(0), last_record_hit_cnt_(0), last_record_miss_cnt_(0),
       last_record_cache_read_size_(0) {}
 
 LogColdCache::LogCacheStat::~LogCacheStat()
@@ -847,6 +969,10 @@ void LogColdCache::LogCacheStat::reset()
   miss_cnt_ = 0;
   cache_read_size_ = 0;
   cache_fill_amplification_ = 0;
+  read_ahead_cnt_ = 0;
+  read_ahead_size_ = 0;
+  read_ahead_hit_cnt_ = 0;
+  read_ahead_miss_cnt_ = 0;
   last_print_time_ = 0;
   last_record_hit_cnt_ = 0;
   last_record_miss_cnt_ = 0;
@@ -875,6 +1001,22 @@ void LogColdCache::LogCacheStat::inc_cache_fill_amplification(int64_t cache_fill
   ATOMIC_AAF(&cache_fill_amplification_, cache_fill_amplification_);
 }
 
+void LogColdCache::LogCacheStat::inc_read_ahead(int64_t read_ahead_size)
+{
+  ATOMIC_INC(&read_ahead_cnt_);
+  ATOMIC_AAF(&read_ahead_size_, read_ahead_size);
+}
+
+void LogColdCache::LogCacheStat::inc_read_ahead_hit_cnt()
+{
+  ATOMIC_INC(&read_ahead_hit_cnt_);
+}
+
+void LogColdCache::LogCacheStat::inc_read_ahead_miss_cnt()
+{
+  ATOMIC_INC(&read_ahead_miss_cnt_);
+}
+
 void LogColdCache::LogCacheStat::print_stat_info(int64_t cache_store_size, int64_t palf_id)
 {
   if (palf_reach_time_interval(PALF_STAT_PRINT_INTERVAL_US, last_print_time_)) {
@@ -886,7 +1028,8 @@ void LogColdCache::LogCacheStat::print_stat_info(int64_t cache_store_size, int64
              "miss_cnt", interval_miss_cnt, "hit_rate",
              interval_hit_cnt * 1.0 / total_cnt,
              "cache_read_size", interval_cache_read_size, K(cache_store_size),
-             K(cache_fill_amplification_), K(palf_id));
+             K(cache_fill_amplification_), K(read_ahead_cnt_), K(read_ahead_size_),
+             K(read_ahead_hit_cnt_), K(read_ahead_miss_cnt_), K(palf_id));
     last_record_hit_cnt_ = hit_cnt_;
     last_record_miss_cnt_ = miss_cnt_;
     last_record_cache_read_size_ = cache_read_size_;
@@ -942,7 +1085,8 @@ int LogCache::read(const int64_t flashback_version,
                    const int64_t in_read_size,
                    ReadBuf &read_buf,
                    int64_t &out_read_size,
-                   LogIteratorInfo *iterator_info)
+                   LogIteratorInfo *iterator_info,
+                   const LSN &read_ahead_limit_lsn)
 {
   int ret = OB_SUCCESS;
   const bool is_cold_cache = false;
@@ -958,12 +1102,17 @@ int LogCache::read(const int64_t flashback_version,
     iterator_info->inc_cache_read_size(out_read_size, is_cold_cache);
   } else if (FALSE_IT(iterator_info->inc_miss_cnt(is_cold_cache))) {
   } else if (OB_FAIL(read_cold_cache_(flashback_version, lsn, in_read_size,
-                                      read_buf, out_read_size, iterator_info))) {
+                                      read_buf, out_read_size, iterator_info,
+                                      read_ahead_limit_lsn))) {
     PALF_LOG(WARN, "fail to read from cold cache", K(ret), K(lsn), K(in_read_size), K(read_buf), K(out_read_size));
   } else {
     // read data from kv cache successfully
   }
 
+  if (OB_SUCC(ret)) {
+    iterator_info->set_last_read_range(lsn, out_read_size);
+  }
+
   return ret;
 }
 
@@ -1055,7 +1204,8 @@ int LogCache::read_cold_cache_(const int64_t flashback_version,
                               const int64_t in_read_size,
                               ReadBuf &read_buf,
                               int64_t &out_read_size,
-                              LogIteratorInfo *iterator_info)
+                              LogIteratorInfo *iterator_info,
+                              const LSN &read_ahead_limit_lsn)
 {
   int ret = OB_SUCCESS;
   if (!lsn.is_valid() || 0 >= in_read_size || !read_buf.is_valid()) {
@@ -1063,7 +1213,7 @@ int LogCache::read_cold_cache_(const int64_t flashback_version,
     PALF_LOG(WARN, "invalid argument", K(ret), K(lsn), K(in_read_size), K(read_buf));
   } else if (OB_FAIL(cold_cache_.read(flashback_version, lsn, in_read_size,
                                       read_buf, out_read_size,
-                                      iterator_info))) {
+                                      iterator_info, read_ahead_limit_lsn))) {
     PALF_LOG(WARN, "read cold cache failed", K(ret), K(lsn), K(in_read_size), K(read_buf), K(out_read_size));
   } else {
     PALF_LOG(TRACE, "read cold cache successfully", K(lsn), K(in_read_size), K(read_buf), K(out_read_size));
@@ -14,6 +14,7 @@
 #define OCEANBASE_PALF_LOG_CACHE_
 
 #include <cstdint>                                       // int64_t
+#include "lib/lock/ob_spin_lock.h"                       // ObSpinLock
 #include "share/cache/ob_kv_storecache.h"                // ObIKVCache
 #include "log_reader_utils.h"                            // ReadBuf
 #include "lsn.h"
@@ -194,6 +195,7 @@ public:
   // @param[out] ReadBuf &read_buf: buf for read logs
   // @param[out] int64_t &out_read_size: actual read size
   // @param[out] LogIteratorInfo *iterator_info: iterator info
+  // @param[in] const LSN &read_ahead_limit_lsn: logs before it are readable, read-ahead never goes beyond it
   // @return
   // - OB_SUCCESS: read logs successfully
   // - OB_INVALID_ARGUEMENTS: invalid arguments
@@ -204,12 +206,31 @@ public:
            const int64_t in_read_size,
            ReadBuf &read_buf,
            int64_t &out_read_size,
-           LogIteratorInfo *iterator_info);
+           LogIteratorInfo *iterator_info,
+           const LSN &read_ahead_limit_lsn);
   int fill_cache_line(FillBuf &fill_buf);
   int alloc_kv_pair(const int64_t flashback_version, const LSN &aligned_lsn, FillBuf &fill_buf);
-  TO_STRING_KV(K_(is_inited), K_(tenant_id), K_(palf_id), K_(log_cache_stat));
+  TO_STRING_KV(K_(is_inited), K_(tenant_id), K_(palf_id), K_(log_cache_stat), K_(read_ahead_window));
 private:
-  int allow_filling_cache_(LogIteratorInfo *iterator_info, bool &enable_fill_cache);
+  // @brief: decide whether the missed logs should be filled into kv cache and how many logs should be read ahead.
+  // Readers which are allowed to fill cache read ahead when they read sequentially. Readers which are not
+  // allowed to fill cache (i.e. fetch_log) only read ahead when they are reading in the read-ahead window
+  // opened by other readers, so that all readers of the same range share one disk read.
+  int allow_filling_cache_(const int64_t flashback_version,
+                           const LSN &lsn,
+                           LogIteratorInfo *iterator_info,
+                           bool &enable_fill_cache,
+                           int64_t &read_ahead_size);
+  // @brief: extend the disk read [read_lsn, read_lsn + read_size) to cover the cache lines after read_end_lsn.
+  // only complete cache lines are read ahead, the last cache line of the block is the exception.
+  // @param[out] int64_t &read_ahead_bytes: the size of extended logs which are only used to fill cache
+  void extend_read_ahead_(const LSN &read_end_lsn,
+                          const int64_t read_ahead_size,
+                          const LSN &read_ahead_limit_lsn,
+                          const int64_t buf_len,
+                          const LSN &read_lsn,
+                          int64_t &read_size,
+                          int64_t &read_ahead_bytes) const;
   /*
   this func is used to adujst read position(lsn) and read size(in_read_size) before reading from the disk:
   1. if read from cache successfully, lsn must be aligned to CACHE_LINE_SIZE in the block.
@@ -252,6 +273,34 @@ private:
                       LogIteratorInfo *iterator_info);
   offset_t get_phy_offset_(const LSN &lsn) const;
 private:
+  // the log range read ahead from disk most recently, shared by all readers of this palf
+  class ReadAheadWindow
+  {
+  public:
+    ReadAheadWindow();
+    ~ReadAheadWindow();
+    void reset();
+    void update(const int64_t flashback_version,
+                const LSN &start_lsn,
+                const LSN &end_lsn,
+                const LogIteratorInfo *opener);
+    bool contains(const int64_t flashback_version, const LSN &lsn) const;
+    // a read starting in the window or right at its end is following the read-ahead window,
+    // except that the reader which opened the window doesn't follow its own end
+    bool is_following(const int64_t flashback_version,
+                      const LSN &lsn,
+                      const LogIteratorInfo *reader) const;
+    TO_STRING_KV(K_(flashback_version), K_(start_lsn), K_(end_lsn), KP_(opener));
+  private:
+    typedef common::ObSpinLock SpinLock;
+    typedef common::ObSpinLockGuard SpinLockGuard;
+    mutable SpinLock lock_;
+    int64_t flashback_version_;
+    LSN start_lsn_;
+    LSN end_lsn_;
+    // only used to identify the reader, never dereferenced
+    const LogIteratorInfo *opener_;
+  };
   class LogCacheStat
   {
   public:
@@ -262,14 +311,23 @@ private:
     void inc_miss_cnt();
     void inc_cache_read_size(int64_t cache_read_size);
     void inc_cache_fill_amplification(int64_t cache_fill_amplification_);
+    void inc_read_ahead(int64_t read_ahead_size);
+    void inc_read_ahead_hit_cnt();
+    void inc_read_ahead_miss_cnt();
     void print_stat_info(int64_t cache_store_size, int64_t palf_id);
-    TO_STRING_KV(K(hit_cnt_), K(miss_cnt_), K(cache_read_size_), K(cache_fill_amplification_));
+    TO_STRING_KV(K(hit_cnt_), K(miss_cnt_), K(cache_read_size_), K(cache_fill_amplification_),
+                 K(read_ahead_cnt_), K(read_ahead_size_), K(read_ahead_hit_cnt_), K(read_ahead_miss_cnt_));
   private:
     // cache stat for accumulate
     int64_t hit_cnt_;
     int64_t miss_cnt_;
     int64_t cache_read_size_;
     int64_t cache_fill_amplification_;
+    // read-ahead stat, hit/miss means reads following the read-ahead window hit/miss cache
+    int64_t read_ahead_cnt_;
+    int64_t read_ahead_size_;
+    int64_t read_ahead_hit_cnt_;
+    int64_t read_ahead_miss_cnt_;
     // cache stat for real time
     int64_t last_print_time_;
     int64_t last_record_hit_cnt_;
@@ -284,6 +342,7 @@ private:
   LogKVCache *kv_cache_;
   int64_t logical_block_size_;
   LogCacheStat log_cache_stat_;
+  ReadAheadWindow read_ahead_window_;
   bool is_inited_;
 };
 
@@ -303,7 +362,8 @@ public:
            const int64_t in_read_size,
            ReadBuf &read_buf,
            int64_t &out_read_size,
-           LogIteratorInfo *iterator_info);
+           LogIteratorInfo *iterator_info,
+           const LSN &read_ahead_limit_lsn);
   int fill_cache_when_slide(const LSN &lsn,
                             const int64_t size,
                             const int64_t flashback_version);
@@ -318,7 +378,8 @@ private:
                        const int64_t in_read_size,
                        ReadBuf &read_buf,
                        int64_t &out_read_size,
-                       LogIteratorInfo *iterator_info);
+                       LogIteratorInfo *iterator_info,
+                       const LSN &read_ahead_limit_lsn);
   int try_update_fill_buf_(const int64_t flashback_version,
                            LSN &fill_lsn,
                            int64_t &fill_size);
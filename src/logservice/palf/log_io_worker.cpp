@@ -29,8 +29,62 @@ using namespace common;
 using namespace share;
 namespace palf
 {
+LogIOWorkerHistogram::LogIOWorkerHistogram(const char *name)
+    : name_(name)
+{
+  reset();
+}
+
+void LogIOWorkerHistogram::reset()
+{
+  MEMSET(buckets_, 0, sizeof(buckets_));
+  total_count_ = 0;
+  total_value_ = 0;
+  max_value_ = 0;
+}
+
+void LogIOWorkerHistogram::stat(const int64_t value)
+{
+  const int64_t bucket_idx = value <= 0 ? 0 : MIN(BUCKET_NUM - 1, 64 - __builtin_clzll(value));
+  buckets_[bucket_idx]++;
+  total_count_++;
+  total_value_ += value;
+  max_value_ = MAX(max_value_, value);
+}
+
+int64_t LogIOWorkerHistogram::to_string(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  J_OBJ_START();
+  J_KV("name", name_, "count", total_count_, "avg", 0 == total_count_ ? 0 : total_value_ / total_count_,
+       "max", max_value_);
+  J_COMMA();
+  J_NAME("buckets");
+  J_COLON();
+  J_ARRAY_START();
+  bool is_first = true;
+  for (int64_t i = 0; i < BUCKET_NUM; i++) {
+    if (0 != buckets_[i]) {
+      if (!is_first) {
+        J_COMMA();
+      }
+      is_first = false;
+      // print the upper bound of each bucket, the last bucket has no upper bound.
+      if (BUCKET_NUM - 1 == i) {
+        BUF_PRINTF("inf:%ld", buckets_[i]);
+      } else {
+        BUF_PRINTF("<%ld:%ld", 1L << i, buckets_[i]);
+      }
+    }
+  }
+  J_ARRAY_END();
+  J_OBJ_END();
+  return pos;
+}
+
 LogIOWorker::LogIOWorker()
     : log_io_worker_num_(-1),
+      worker_idx_(-1),
       cb_thread_pool_tg_id_(-1),
       palf_env_impl_(NULL),
       do_task_used_ts_(0),
@@ -43,6 +97,9 @@ LogIOWorker::LogIOWorker()
       purge_throttling_task_handled_seq_(0),
       need_ignoring_throttling_(false),
       wait_cost_stat_("[PALF STAT IO TASK IN QUEUE TIME]", PALF_STAT_PRINT_INTERVAL_US),
+      flush_latency_hist_("flush_latency_us"),
+      batch_size_hist_("batch_size"),
+      print_hist_interval_(OB_INVALID_TIMESTAMP),
       is_inited_(false)
 {
 }
@@ -54,6 +111,7 @@ LogIOWorker::~LogIOWorker()
 
 int LogIOWorker::init(const LogIOWorkerConfig &config,
                       const int64_t tenant_id,
+                      const int64_t worker_idx,
                       const int cb_thread_pool_tg_id,
                       ObIAllocator *allocator,
                       LogWritingThrottle *throttle,
@@ -64,24 +122,32 @@ int LogIOWorker::init(const LogIOWorkerConfig &config,
   if (IS_INIT) {
     ret = OB_INIT_TWICE;
     PALF_LOG(ERROR, "LogIOWorker has been inited", K(ret));
-  } else if (false == config.is_valid() || 0 >= cb_thread_pool_tg_id || OB_ISNULL(allocator)
+  } else if (false == config.is_valid() || 0 > worker_idx || config.io_worker_num_ <= worker_idx
+      || 0 >= cb_thread_pool_tg_id || OB_ISNULL(allocator)
       || OB_ISNULL(throttle) || OB_ISNULL(palf_env_impl)) {
     ret = OB_INVALID_ARGUMENT;
-    PALF_LOG(ERROR, "invalid argument!!!", K(ret), K(config), K(cb_thread_pool_tg_id), KP(allocator),
+    PALF_LOG(ERROR, "invalid argument!!!", K(ret), K(config), K(worker_idx), K(cb_thread_pool_tg_id), KP(allocator),
         KP(throttle), KP(palf_env_impl));
   } else if (OB_FAIL(queue_.init(config.io_queue_capcity_, "IOWorkerLQ", tenant_id))) {
     PALF_LOG(ERROR, "io task queue init failed", K(ret), K(config));
   } else if (OB_FAIL(batch_io_task_mgr_.init(config.batch_width_,
                                              config.batch_depth_,
+                                             config.io_depth_,
                                              allocator,
-                                             &wait_cost_stat_))) {
+                                             &wait_cost_stat_,
+                                             &flush_latency_hist_,
+                                             &batch_size_hist_))) {
     PALF_LOG(ERROR, "BatchLogIOFlushLogTaskMgr init failed", K(ret), K(config));
+  // NB: the first thread is LogIOWorker itself, others are flush helper threads.
+  } else if (OB_FAIL(share::ObThreadPool::set_thread_count(config.io_depth_))) {
+    PALF_LOG(ERROR, "set_thread_count failed", K(ret), K(config));
   } else {
     share::ObThreadPool::set_run_wrapper(MTL_CTX());
     log_io_worker_num_ = config.io_worker_num_;
+    worker_idx_ = worker_idx;
     cb_thread_pool_tg_id_ = cb_thread_pool_tg_id;
     palf_env_impl_ = palf_env_impl;
-    PALF_REPORT_INFO_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id));
+    PALF_REPORT_INFO_KV(K_(log_io_worker_num), K_(worker_idx), K_(cb_thread_pool_tg_id));
     throttle_ = throttle;
     log_io_worker_queue_size_stat_.set_extra_info(EXTRA_INFOS);
     purge_throttling_task_submitted_seq_ = 0;
@@ -118,6 +184,10 @@ void LogIOWorker::destroy()
   cb_thread_pool_tg_id_ = -1;
   palf_env_impl_ = NULL;
   log_io_worker_num_ = -1;
+  worker_idx_ = -1;
+  print_hist_interval_ = OB_INVALID_TIMESTAMP;
+  flush_latency_hist_.reset();
+  batch_size_hist_.reset();
   queue_.destroy();
   batch_io_task_mgr_.destroy();
 }
@@ -174,19 +244,26 @@ int LogIOWorker::notify_need_writing_throttling(const bool &need_throttling)
 
 void LogIOWorker::run1()
 {
-  lib::set_thread_name("IOWorker");
-  (void) run_loop_();
+  if (0 == get_thread_idx()) {
+    lib::set_thread_name("IOWorker");
+    (void) run_loop_();
+  } else {
+    lib::set_thread_name("IOFlushHelper");
+    (void) run_flush_helper_loop_();
+  }
 }
 
-int LogIOWorker::handle_io_task_with_throttling_(LogIOTask *io_task)
+int LogIOWorker::handle_io_task_with_throttling_(LogIOTask *io_task, int64_t &throttling_cost_ts)
 {
   int ret = OB_SUCCESS;
   const int64_t throttling_size = io_task->get_io_size();
   int tmp_ret = OB_SUCCESS;
+  const int64_t throttling_start_ts = ObTimeUtility::current_time();
   if (!need_ignoring_throttling_
       && OB_SUCCESS != (tmp_ret = throttle_->throttling(throttling_size, need_purging_throttling_func_, palf_env_impl_))) {
     LOG_ERROR_RET(tmp_ret, "failed to do_throttling", K(throttling_size));
   }
+  throttling_cost_ts = ObTimeUtility::current_time() - throttling_start_ts;
   const int64_t submit_seq = io_task->get_submit_seq();
   if (OB_FAIL(io_task->do_task(cb_thread_pool_tg_id_, palf_env_impl_))) {
     PALF_LOG(WARN, "LogIOTask do_task falied");
@@ -215,10 +292,18 @@ int LogIOWorker::handle_io_task_(LogIOTask *io_task)
   int ret = OB_SUCCESS;
 	int64_t start_ts = ObTimeUtility::current_time();
   wait_cost_stat_.stat(start_ts - io_task->get_init_task_ts());
-  if (OB_FAIL(handle_io_task_with_throttling_(io_task))) {
+  // NB: 'io_task' may be freed by callback thread after do_task.
+  const bool is_flush_log_task = (LogIOTaskType::FLUSH_LOG_TYPE == io_task->get_io_task_type());
+  int64_t throttling_cost_ts = 0;
+  if (OB_FAIL(handle_io_task_with_throttling_(io_task, throttling_cost_ts))) {
     io_task->free_this(palf_env_impl_);
   }
 	int64_t cost_ts = ObTimeUtility::current_time() - start_ts;
+  if (is_flush_log_task) {
+    // writing throttling is not a part of flush latency
+    flush_latency_hist_.stat(cost_ts - throttling_cost_ts);
+    batch_size_hist_.stat(1);
+  }
 	do_task_used_ts_ += cost_ts;
 	do_task_count_ ++;
 	if (palf_reach_time_interval(5 * 1000 * 1000, print_log_interval_)) {
@@ -247,6 +332,7 @@ int LogIOWorker::run_loop_()
     if (queue_.size() > 0) {
       log_io_worker_queue_size_stat_.stat(queue_.size());
     }
+    print_histograms_();
   }
 
   // After IOWorker has stopped, need clear queue_.
@@ -265,6 +351,14 @@ int LogIOWorker::run_loop_()
   return ret;
 }
 
+void LogIOWorker::run_flush_helper_loop_()
+{
+  while (false == has_set_stop()
+      && false == (OB_NOT_NULL(&lib::Thread::current()) ? lib::Thread::current().has_set_stop() : false)) {
+    batch_io_task_mgr_.help_handle(QUEUE_WAIT_TIME);
+  }
+}
+
 bool LogIOWorker::need_reduce_(LogIOTask *io_task)
 {
   bool bool_ret = false;
@@ -340,9 +434,23 @@ int LogIOWorker::update_throttling_options_()
   return ret;
 }
 
+void LogIOWorker::print_histograms_()
+{
+  if (palf_reach_time_interval(PALF_STAT_PRINT_INTERVAL_US, print_hist_interval_)) {
+    if (0 < flush_latency_hist_.get_total_count()) {
+      PALF_LOG(INFO, "[PALF STAT IO WORKER HISTOGRAM]", K_(worker_idx), K_(log_io_worker_num),
+               K_(flush_latency_hist), K_(batch_size_hist));
+    }
+    flush_latency_hist_.reset();
+    batch_size_hist_.reset();
+  }
+}
+
 LogIOWorker::BatchLogIOFlushLogTaskMgr::BatchLogIOFlushLogTaskMgr()
-  : handle_count_(0), usable_count_(0), batch_width_(0),
-    wait_cost_stat_(NULL)
+  : handle_count_(0), usable_count_(0), batch_width_(0), io_depth_(1),
+    wait_cost_stat_(NULL), flush_latency_hist_(NULL), batch_size_hist_(NULL),
+    cond_(), round_count_(0), next_idx_(0), finished_count_(0), round_ret_(OB_SUCCESS),
+    round_tg_id_(-1), round_palf_env_impl_(NULL), round_first_handle_ts_(OB_INVALID_TIMESTAMP)
 {}
 
 LogIOWorker::BatchLogIOFlushLogTaskMgr::~BatchLogIOFlushLogTaskMgr()
@@ -352,13 +460,21 @@ LogIOWorker::BatchLogIOFlushLogTaskMgr::~BatchLogIOFlushLogTaskMgr()
 
 int LogIOWorker::BatchLogIOFlushLogTaskMgr::init(int64_t batch_width,
                                                  int64_t batch_depth,
+                                                 int64_t io_depth,
                                                  ObIAllocator *allocator,
-                                                 ObMiniStat::ObStatItem *wait_cost_stat)
+                                                 ObMiniStat::ObStatItem *wait_cost_stat,
+                                                 LogIOWorkerHistogram *flush_latency_hist,
+                                                 LogIOWorkerHistogram *batch_size_hist)
 {
   int ret = OB_SUCCESS;
   batch_io_task_array_.set_allocator(allocator);
+  flush_cost_array_.set_allocator(allocator);
   if (OB_FAIL(batch_io_task_array_.init(batch_width))) {
     PALF_LOG(ERROR, "batch_io_task_array_ init failed", K(ret));
+  } else if (OB_FAIL(flush_cost_array_.prepare_allocate(batch_width))) {
+    PALF_LOG(ERROR, "flush_cost_array_ prepare_allocate failed", K(ret), K(batch_width));
+  } else if (OB_FAIL(cond_.init(ObWaitEventIds::CLOG_WRITER_COND_WAIT))) {
+    PALF_LOG(ERROR, "cond_ init failed", K(ret));
   } else {
     for (int i = 0; i < batch_width  && OB_SUCC(ret); i++) {
       bool last_io_task_push_success = false;
@@ -385,7 +501,10 @@ int LogIOWorker::BatchLogIOFlushLogTaskMgr::init(int64_t batch_width,
       }
     }
     batch_width_ = usable_count_ = batch_width;
+    io_depth_ = io_depth;
     wait_cost_stat_ = wait_cost_stat;
+    flush_latency_hist_ = flush_latency_hist;
+    batch_size_hist_ = batch_size_hist;
   }
   if (OB_FAIL(ret)) {
     destroy();
@@ -405,7 +524,17 @@ void LogIOWorker::BatchLogIOFlushLogTaskMgr::destroy()
     }
   }
   wait_cost_stat_ = NULL;
+  flush_latency_hist_ = NULL;
+  batch_size_hist_ = NULL;
+  io_depth_ = 1;
+  round_count_ = next_idx_ = finished_count_ = 0;
+  round_ret_ = OB_SUCCESS;
+  round_tg_id_ = -1;
+  round_palf_env_impl_ = NULL;
+  round_first_handle_ts_ = OB_INVALID_TIMESTAMP;
   batch_io_task_array_.destroy();
+  flush_cost_array_.destroy();
+  cond_.destroy();
 }
 
 int LogIOWorker::BatchLogIOFlushLogTaskMgr::insert(LogIOFlushLogTask *io_task)
@@ -425,30 +554,34 @@ int LogIOWorker::BatchLogIOFlushLogTaskMgr::insert(LogIOFlushLogTask *io_task)
 int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle(const int64_t tg_id, IPalfEnvImpl *palf_env_impl)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   const int64_t count = batch_io_task_array_.count() - usable_count_;
   // Each BatchLogIOFlushLogTask is a set LogIOFlushLogTask of one palf instance,
   // even if execute 'do_task_' for one of LogIOFlushLogTask failed, we need
   // execute 'do_task_' for next LogIOFlushLogTask.
   const int64_t first_handle_ts = ObTimeUtility::fast_current_time();
-  for (int64_t i = 0; i < count; i++) {
-    BatchLogIOFlushLogTask *io_task = batch_io_task_array_[i];
-    if (OB_ISNULL(io_task)) {
-      ret = OB_ERR_UNEXPECTED;
-      PALF_LOG(ERROR, "BatchLogIOFlushLogTask in batch_io_task_array_ is nullptr, unexpected error!!!",
-               K(ret), KP(io_task), K(i));
-    } else if (OB_FAIL(statistics_wait_cost_(first_handle_ts, io_task))) {
-      PALF_LOG(WARN, "do statistics failed", K(ret));
-    } else if (OB_FAIL(io_task->do_task(tg_id, palf_env_impl))) {
-      PALF_LOG(WARN, "do_task failed", K(ret), KP(io_task));
-    } else {
-      if (OB_NOT_NULL(wait_cost_stat_)) {
-        wait_cost_stat_->stat(io_task->get_count(), io_task->get_accum_in_queue_time());
+  if (1 >= io_depth_ || 1 >= count) {
+    for (int64_t i = 0; i < count; i++) {
+      if (OB_SUCCESS != (tmp_ret = handle_ith_(i, tg_id, palf_env_impl, first_handle_ts))) {
+        ret = tmp_ret;
       }
-      io_task->reset_accum_in_queue_time();
-      PALF_LOG(TRACE, "BatchLogIOFlushLogTaskMgr::handle success", K(ret), K(handle_count_),
-          KP(io_task));
     }
+  } else {
+    ret = handle_concurrently_(count, tg_id, palf_env_impl, first_handle_ts);
+  }
+  // NB: histograms are only updated by LogIOWorker, do statistics after all writes of
+  // this round have finished.
+  for (int64_t i = 0; i < count; i++) {
+    BatchLogIOFlushLogTask *io_task = batch_io_task_array_[i];
     if (OB_NOT_NULL(io_task)) {
+      if (0 <= flush_cost_array_[i]) {
+        if (OB_NOT_NULL(flush_latency_hist_)) {
+          flush_latency_hist_->stat(flush_cost_array_[i]);
+        }
+        if (OB_NOT_NULL(batch_size_hist_)) {
+          batch_size_hist_->stat(io_task->get_count());
+        }
+      }
       // 'handle_count_' used for statistics
       handle_count_ += io_task->get_count();
       io_task->reuse();
@@ -458,6 +591,105 @@ int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle(const int64_t tg_id, IPalfEnv
   return ret;
 }
 
+int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle_ith_(const int64_t idx,
+                                                        const int64_t tg_id,
+                                                        IPalfEnvImpl *palf_env_impl,
+                                                        const int64_t first_handle_ts)
+{
+  int ret = OB_SUCCESS;
+  BatchLogIOFlushLogTask *io_task = batch_io_task_array_[idx];
+  int64_t do_task_start_ts = OB_INVALID_TIMESTAMP;
+  flush_cost_array_[idx] = -1;
+  if (OB_ISNULL(io_task)) {
+    ret = OB_ERR_UNEXPECTED;
+    PALF_LOG(ERROR, "BatchLogIOFlushLogTask in batch_io_task_array_ is nullptr, unexpected error!!!",
+             K(ret), KP(io_task), K(idx));
+  } else if (OB_FAIL(statistics_wait_cost_(first_handle_ts, io_task))) {
+    PALF_LOG(WARN, "do statistics failed", K(ret));
+  } else if (FALSE_IT(do_task_start_ts = ObTimeUtility::current_time())) {
+  } else if (OB_FAIL(io_task->do_task(tg_id, palf_env_impl))) {
+    PALF_LOG(WARN, "do_task failed", K(ret), KP(io_task));
+  } else {
+    flush_cost_array_[idx] = ObTimeUtility::current_time() - do_task_start_ts;
+    if (OB_NOT_NULL(wait_cost_stat_)) {
+      wait_cost_stat_->stat(io_task->get_count(), io_task->get_accum_in_queue_time());
+    }
+    io_task->reset_accum_in_queue_time();
+    PALF_LOG(TRACE, "BatchLogIOFlushLogTaskMgr::handle success", K(ret), K(idx), KP(io_task));
+  }
+  return ret;
+}
+
+int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle_concurrently_(const int64_t count,
+                                                                 const int64_t tg_id,
+                                                                 IPalfEnvImpl *palf_env_impl,
+                                                                 const int64_t first_handle_ts)
+{
+  int ret = OB_SUCCESS;
+  {
+    ObThreadCondGuard guard(cond_);
+    round_tg_id_ = tg_id;
+    round_palf_env_impl_ = palf_env_impl;
+    round_first_handle_ts_ = first_handle_ts;
+    round_ret_ = OB_SUCCESS;
+    finished_count_ = 0;
+    next_idx_ = 0;
+    round_count_ = count;
+    (void)cond_.broadcast();
+  }
+  // LogIOWorker also writes, rather than waiting idly.
+  drain_();
+  {
+    ObThreadCondGuard guard(cond_);
+    while (finished_count_ < round_count_) {
+      (void)cond_.wait_us(QUEUE_WAIT_TIME);
+    }
+    ret = round_ret_;
+    round_count_ = next_idx_ = finished_count_ = 0;
+    round_palf_env_impl_ = NULL;
+  }
+  return ret;
+}
+
+void LogIOWorker::BatchLogIOFlushLogTaskMgr::help_handle(const int64_t wait_time_us)
+{
+  {
+    ObThreadCondGuard guard(cond_);
+    if (next_idx_ >= round_count_) {
+      (void)cond_.wait_us(wait_time_us);
+    }
+  }
+  drain_();
+}
+
+bool LogIOWorker::BatchLogIOFlushLogTaskMgr::claim_(int64_t &idx)
+{
+  bool bool_ret = false;
+  ObThreadCondGuard guard(cond_);
+  if (next_idx_ < round_count_) {
+    idx = next_idx_++;
+    bool_ret = true;
+  }
+  return bool_ret;
+}
+
+void LogIOWorker::BatchLogIOFlushLogTaskMgr::drain_()
+{
+  int64_t idx = -1;
+  while (claim_(idx)) {
+    // NB: the state of current round can not be changed until all claimed
+    // BatchLogIOFlushLogTasks have finished, read it without lock is safe.
+    const int tmp_ret = handle_ith_(idx, round_tg_id_, round_palf_env_impl_, round_first_handle_ts_);
+    ObThreadCondGuard guard(cond_);
+    if (OB_SUCCESS != tmp_ret) {
+      round_ret_ = tmp_ret;
+    }
+    if (++finished_count_ == round_count_) {
+      (void)cond_.broadcast();
+    }
+  }
+}
+
 bool LogIOWorker::BatchLogIOFlushLogTaskMgr::empty()
 {
   return usable_count_ == batch_width_;
@@ -22,6 +22,7 @@
 #include "lib/hash/ob_array_hash_map.h"             // ObArrayHashMap
 #include "lib/atomic/ob_atomic.h"                   // ATOMIC_LOAD
 #include "lib/function/ob_function.h"               // ObFunction
+#include "lib/lock/ob_thread_cond.h"                // ObThreadCond
 #include "share/ob_thread_pool.h"                   // ObThreadPool
 #include "common/ob_clock_generator.h"              // ObClockGenerator
 #include "log_io_task.h"                            // LogBatchIOFlushLogTask
@@ -51,7 +52,8 @@ struct LogIOWorkerConfig
   }
   bool is_valid() const
   {
-    return 0 < io_worker_num_ && 0 < io_queue_capcity_ && 0 <= batch_width_ && 0 <= batch_depth_;
+    return 0 < io_worker_num_ && 0 < io_queue_capcity_ && 0 <= batch_width_ && 0 <= batch_depth_
+        && 0 < io_depth_;
   }
   void reset()
   {
@@ -59,12 +61,38 @@ struct LogIOWorkerConfig
     io_queue_capcity_ = 0;
     batch_width_ = 0;
     batch_depth_ = 0;
+    io_depth_ = 1;
   }
   int64_t io_worker_num_;
   int64_t io_queue_capcity_;
   int64_t batch_width_;
   int64_t batch_depth_;
-  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth));
+  // the max number of BatchLogIOFlushLogTasks which are written concurrently by one LogIOWorker,
+  // 1 means writing them one by one.
+  int64_t io_depth_;
+  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth), K_(io_depth));
+};
+
+// Power-of-two bucketed histogram, bucket i counts values in [2^(i-1), 2^i), bucket 0 counts
+// values less than 1 and the last bucket counts all larger values. It's only updated and
+// printed by the owner LogIOWorker thread, no need to be thread safe.
+class LogIOWorkerHistogram
+{
+public:
+  LogIOWorkerHistogram(const char *name);
+  ~LogIOWorkerHistogram() { reset(); }
+  void reset();
+  void stat(const int64_t value);
+  int64_t get_total_count() const { return total_count_; }
+  int64_t to_string(char *buf, const int64_t buf_len) const;
+private:
+  static constexpr int64_t BUCKET_NUM = 24;
+  const char *name_;
+  int64_t buckets_[BUCKET_NUM];
+  int64_t total_count_;
+  int64_t total_value_;
+  int64_t max_value_;
+  DISALLOW_COPY_AND_ASSIGN(LogIOWorkerHistogram);
 };
 
 class LogIOWorker : public share::ObThreadPool
@@ -74,6 +102,7 @@ public:
   ~LogIOWorker();
   int init(const LogIOWorkerConfig &config,
            const int64_t tenant_id,
+           const int64_t worker_idx,
            const int cb_thread_pool_tg_id,
            ObIAllocator *allocaotr,
            LogWritingThrottle *throttle,
@@ -87,51 +116,93 @@ public:
 
  int notify_need_writing_throttling(const bool &need_throtting);
   static constexpr int64_t MAX_THREAD_NUM = 1;
-  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id), K_(purge_throttling_task_handled_seq), K_(purge_throttling_task_submitted_seq));
+  TO_STRING_KV(K_(log_io_worker_num), K_(worker_idx), K_(cb_thread_pool_tg_id), K_(purge_throttling_task_handled_seq), K_(purge_throttling_task_submitted_seq));
 private:
   bool need_reduce_(LogIOTask *task);
   int reduce_io_task_(void *task);
   int handle_io_task_(LogIOTask *io_task);
-  int handle_io_task_with_throttling_(LogIOTask *io_task);
+  int handle_io_task_with_throttling_(LogIOTask *io_task, int64_t &throttling_cost_ts);
   int update_throttling_options_();
   int run_loop_();
+  void run_flush_helper_loop_();
   int64_t inc_and_fetch_purge_throttling_submitted_seq_();
   void dec_purge_throttling_submitted_seq_();
   bool has_purge_throttling_tasks_() const;
+  void print_histograms_();
 private:
   static constexpr int64_t QUEUE_WAIT_TIME = 100 * 1000;
 private:
 
+  // Each BatchLogIOFlushLogTask in BatchLogIOFlushLogTaskMgr belongs to a different palf
+  // instance, namely a different block file, when 'io_depth' is greater than 1, the
+  // BatchLogIOFlushLogTasks of one round are written concurrently by the LogIOWorker and
+  // its flush helper threads, so that several log group writes are in flight at the same
+  // time. The LogIOWorker waits all of them finished before aggregating next round, the
+  // writes of one palf instance are still serial and in order, and the flush callbacks of
+  // each palf instance are pushed as soon as its own write has finished.
   class BatchLogIOFlushLogTaskMgr {
   public:
     BatchLogIOFlushLogTaskMgr();
     ~BatchLogIOFlushLogTaskMgr();
-    int init(int64_t batch_width, int64_t batch_depth, ObIAllocator *allocator, ObMiniStat::ObStatItem *wait_cost_stat);
+    int init(int64_t batch_width,
+             int64_t batch_depth,
+             int64_t io_depth,
+             ObIAllocator *allocator,
+             ObMiniStat::ObStatItem *wait_cost_stat,
+             LogIOWorkerHistogram *flush_latency_hist,
+             LogIOWorkerHistogram *batch_size_hist);
     void destroy();
     int insert(LogIOFlushLogTask *io_task);
     int handle(const int64_t tg_id, IPalfEnvImpl *palf_env_impl);
+    // called by flush helper threads, wait at most 'wait_time_us' for a round to help.
+    void help_handle(const int64_t wait_time_us);
     bool empty();
-    TO_STRING_KV(K_(batch_io_task_array), K_(usable_count), K_(batch_width));
+    TO_STRING_KV(K_(batch_io_task_array), K_(usable_count), K_(batch_width), K_(io_depth));
   private:
     int find_usable_batch_io_task_(const int64_t palf_id, BatchLogIOFlushLogTask *&batch_io_task);
     int statistics_wait_cost_(int64_t first_handle_time, BatchLogIOFlushLogTask *batch_io_task);
+    int handle_ith_(const int64_t idx, const int64_t tg_id, IPalfEnvImpl *palf_env_impl,
+                    const int64_t first_handle_ts);
+    int handle_concurrently_(const int64_t count, const int64_t tg_id, IPalfEnvImpl *palf_env_impl,
+                             const int64_t first_handle_ts);
+    bool claim_(int64_t &idx);
+    void drain_();
   private:
     typedef ObFixedArray<BatchLogIOFlushLogTask *, common::ObIAllocator> BatchLogIOFlushLogTaskArray;
+    typedef ObFixedArray<int64_t, common::ObIAllocator> FlushCostArray;
     BatchLogIOFlushLogTaskArray batch_io_task_array_;
+    // the cost of writing each BatchLogIOFlushLogTask in current round, -1 means failed.
+    FlushCostArray flush_cost_array_;
     int64_t handle_count_;
     int64_t usable_count_;
     int64_t batch_width_;
+    int64_t io_depth_;
     ObMiniStat::ObStatItem *wait_cost_stat_;
+    LogIOWorkerHistogram *flush_latency_hist_;
+    LogIOWorkerHistogram *batch_size_hist_;
+    // protect the state of current round which is shared with flush helper threads.
+    common::ObThreadCond cond_;
+    int64_t round_count_;
+    int64_t next_idx_;
+    int64_t finished_count_;
+    int round_ret_;
+    int64_t round_tg_id_;
+    IPalfEnvImpl *round_palf_env_impl_;
+    int64_t round_first_handle_ts_;
   };
   typedef common::ObSpinLock SpinLock;
   typedef common::ObSpinLockGuard SpinLockGuard;
 
-  // TODO: io_task_queue used to store all LogIOTask objects, and the LogIOWorker
-  //       will consume it, at nowdays, the io_task_queue is single consumer and mutil
-  //       producers model.
+  // io_task_queue used to store all LogIOTask objects of the palf instances which are
+  // assigned to this LogIOWorker, it's single consumer and mutil producers model, the
+  // parallelism of writing comes from multiple LogIOWorkers partitioned by palf id
+  // (see LogIOWorkerWrapper), so the LogIOTasks of one palf instance are always handled
+  // in order.
 
-  // NB: at nowdays, the default 'log_io_worker_num_' is 1.
+  // NB: the number of LogIOWorkers in the LogIOWorkerWrapper which this LogIOWorker belongs to.
   int64_t log_io_worker_num_;
+  // the index of this LogIOWorker in the LogIOWorkerWrapper.
+  int64_t worker_idx_;
   int cb_thread_pool_tg_id_;
   IPalfEnvImpl *palf_env_impl_;
   ObLightyQueue queue_;
@@ -153,6 +224,11 @@ private:
   NeedPurgingThrottlingFunc need_purging_throttling_func_;
   SpinLock lock_;
   ObMiniStat::ObStatItem wait_cost_stat_;
+  // the cost of each write, in microseconds, a BatchLogIOFlushLogTask counts as one write.
+  LogIOWorkerHistogram flush_latency_hist_;
+  // the number of LogIOFlushLogTasks aggregated in each write.
+  LogIOWorkerHistogram batch_size_hist_;
+  int64_t print_hist_interval_;
   bool is_inited_;
 };
 } // end namespace palf
@@ -26,7 +26,6 @@ LogIOWorkerWrapper::LogIOWorkerWrapper()
       log_writer_parallelism_(-1),
       log_io_workers_(NULL),
       throttle_(),
-      round_robin_idx_(-1),
       is_inited_(false) {}
 
 
@@ -38,7 +37,6 @@ LogIOWorkerWrapper::~LogIOWorkerWrapper()
 void LogIOWorkerWrapper::destroy()
 {
   is_inited_ = false;
-  round_robin_idx_ = -1;
   throttle_.reset();
   destory_and_free_log_io_workers_();
   // reset after destory_and_free_log_io_workers_
@@ -67,7 +65,6 @@ int LogIOWorkerWrapper::init(const LogIOWorkerConfig &config,
     is_user_tenant_ = is_user_tenant(tenant_id);
     log_writer_parallelism_ = config.io_worker_num_;
     throttle_.reset();
-    round_robin_idx_ = 0;
     is_inited_ = true;
     LOG_INFO("success to init LogIOWorkerWrapper", K(config), K(tenant_id), KPC(this));
   }
@@ -157,7 +154,7 @@ int LogIOWorkerWrapper::create_and_init_log_io_workers_(const LogIOWorkerConfig
     iow = new(iow)LogIOWorker();
     // NB:only sys log streams of user tenants need to ignore throtting
     bool need_ignoring_throttling = (i == SYS_LOG_IO_WORKER_INDEX && is_user_tenant(tenant_id));
-    if (OB_FAIL(iow->init(config, tenant_id, cb_thread_pool_tg_id, allocator,
+    if (OB_FAIL(iow->init(config, tenant_id, i, cb_thread_pool_tg_id, allocator,
                           &throttle_, need_ignoring_throttling, palf_env_impl))) {
       PALF_LOG(WARN, "init LogIOWorker failed", K(i), K(config), K(tenant_id),
                K(cb_thread_pool_tg_id), KP(allocator), KP(palf_env_impl));
@@ -219,7 +216,7 @@ void LogIOWorkerWrapper::destory_and_free_log_io_workers_()
   }
 }
 
-int64_t LogIOWorkerWrapper::palf_id_to_index_(const int64_t palf_id)
+int64_t LogIOWorkerWrapper::palf_id_to_index_(const int64_t palf_id) const
 {
   int64_t index = -1;
   // For sys log stream, index set to 0.
@@ -233,7 +230,10 @@ int64_t LogIOWorkerWrapper::palf_id_to_index_(const int64_t palf_id)
       OB_ASSERT(false);
     }
     // NB: SYS_LOG_IO_WORKER_INDEX is 0, others should not use this LogIOWorker.
-    index = (round_robin_idx_++ % hash_factor) + 1;
+    // Partition by palf id rather than by the order of creating, the mapping is stable
+    // across restart and all LogIOTasks of one palf instance are handled by the same
+    // LogIOWorker in order.
+    index = hash_factor <= 0 ? SYS_LOG_IO_WORKER_INDEX : (palf_id % hash_factor) + 1;
     PALF_LOG(INFO, "palf_id_to_index_ success", KPC(this), K(palf_id), K(index));
     OB_ASSERT(index < log_writer_parallelism_);
   }
@@ -23,10 +23,12 @@ class LogIteratorInfo
 public:
   LogIteratorInfo()
       : allow_filling_cache_(true), hot_cache_stat_(), cold_cache_stat_(),
-        read_io_cnt_(0), read_io_size_(0), read_disk_cost_ts_(0) {}
+        read_io_cnt_(0), read_io_size_(0), read_disk_cost_ts_(0),
+        last_read_lsn_(), last_read_end_lsn_() {}
   LogIteratorInfo(bool allow_filling_cache)
       : allow_filling_cache_(allow_filling_cache), hot_cache_stat_(), cold_cache_stat_(),
-        read_io_cnt_(0), read_io_size_(0), read_disk_cost_ts_(0) {}
+        read_io_cnt_(0), read_io_size_(0), read_disk_cost_ts_(0),
+        last_read_lsn_(), last_read_end_lsn_() {}
   ~LogIteratorInfo() {
     reset();
   }
@@ -39,6 +41,8 @@ public:
       this->read_io_cnt_ = iterator_info.read_io_cnt_;
       this->read_io_size_ = iterator_info.read_io_size_;
       this->read_disk_cost_ts_ = iterator_info.read_disk_cost_ts_;
+      this->last_read_lsn_ = iterator_info.last_read_lsn_;
+      this->last_read_end_lsn_ = iterator_info.last_read_end_lsn_;
     }
     return *this;
   }
@@ -49,6 +53,8 @@ public:
     read_io_cnt_ = 0;
     read_io_size_ = 0;
     read_disk_cost_ts_ = 0;
+    last_read_lsn_.reset();
+    last_read_end_lsn_.reset();
   }
   bool get_allow_filling_cache() const {
     return allow_filling_cache_;
@@ -81,8 +87,21 @@ public:
   void inc_read_io_size(int64_t read_io_size) { read_io_size_ += read_io_size; }
   void inc_read_disk_cost_ts(int64_t read_disk_cost_ts) { read_disk_cost_ts_ += read_disk_cost_ts; }
   void set_start_lsn(const LSN &start_lsn) { start_lsn_ = start_lsn; }
+  // record the range returned by the last read, used to detect sequential readers.
+  void set_last_read_range(const LSN &read_lsn, const int64_t read_size)
+  {
+    last_read_lsn_ = read_lsn;
+    last_read_end_lsn_ = read_lsn + read_size;
+  }
+  // iterators re-read the tail of last read buffer which hasn't been consumed,
+  // so any read starting in the last read range is regarded as sequential.
+  bool is_sequential_read(const LSN &read_lsn) const
+  {
+    return last_read_lsn_.is_valid() && read_lsn >= last_read_lsn_ && read_lsn <= last_read_end_lsn_;
+  }
   TO_STRING_KV(K_(allow_filling_cache), K_(hot_cache_stat), K_(cold_cache_stat),
-               K_(read_io_cnt), K_(read_io_size), K_(read_disk_cost_ts), K_(start_lsn));
+               K_(read_io_cnt), K_(read_io_size), K_(read_disk_cost_ts), K_(start_lsn),
+               K_(last_read_lsn), K_(last_read_end_lsn));
 
 private:
   class IteratorCacheStat
@@ -127,6 +146,8 @@ private:
   int64_t read_io_size_;
   int64_t read_disk_cost_ts_;
   LSN start_lsn_;
+  LSN last_read_lsn_;
+  LSN last_read_end_lsn_;
 };
 }
 }
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "share/allocator/ob_tenant_mutil_allocator.h"
 #include "share/allocator/ob_tenant_mutil_allocator_mgr.h"
 #include "share/ob_define.h"
+#include "share/config/ob_server_config.h"
 #include "palf_callback_wrapper.h"
 #include "log_writer_utils.h"
 #include "log_entry_header.h"
@@ -1948,7 +1949,16 @@ bool LogSlidingWindow::need_use_batch_rpc_(const int64_t buf_size,
   const bool need_batch_push_for_fetch_log =
     (is_fetch_log && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_3_3_0)
     ? true : false;
-  return need_batch_push_for_raw_write || need_batch_push_for_fetch_log;
+  // small logs in append mode are coalesced with logs of other palfs to the same server,
+  // acks (buf_size is 0) are batched as well. _log_batch_push_size_threshold is limited to
+  // 64K, which is far smaller than the buffer size of ObBatchRpc.
+  const int64_t batch_push_size_threshold = GCONF._log_batch_push_size_threshold;
+  const bool need_batch_push_for_append =
+    (0 < batch_push_size_threshold
+    && buf_size < batch_push_size_threshold
+    && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_2_1_2)
+    ? true : false;
+  return need_batch_push_for_raw_write || need_batch_push_for_fetch_log || need_batch_push_for_append;
 }
 
 int LogSlidingWindow::try_fetch_log(const FetchTriggerType &fetch_log_type,
@@ -946,7 +946,8 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   } else {
     if (is_log_cache_inited_()) {
       if (OB_FAIL(log_cache_->read(flashback_version, read_lsn, real_in_read_size,
-                                   read_buf, out_read_size, io_ctx.get_iterator_info()))) {
+                                   read_buf, out_read_size, io_ctx.get_iterator_info(),
+                                   max_readable_lsn))) {
         PALF_LOG(WARN, "read log cache failed", K(flashback_version), K(read_lsn),
                  K(real_in_read_size), K(read_buf), K(out_read_size), KPC(this));
       } else {
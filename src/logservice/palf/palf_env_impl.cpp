@@ -194,6 +194,7 @@ PalfEnvImpl::PalfEnvImpl() : palf_meta_lock_(common::ObLatchIds::PALF_ENV_LOCK),
                              last_palf_epoch_(0),
                              rebuild_replica_log_lag_threshold_(0),
                              enable_log_cache_(false),
+                             log_cache_read_ahead_size_(0),
                              diskspace_enough_(true),
                              tenant_id_(0),
                              is_inited_(false),
@@ -234,6 +235,11 @@ int PalfEnvImpl::init(
                                                 tenant_id,
                                                 log_io_worker_config_))) {
     PALF_LOG(WARN, "init_log_io_worker_config_ failed", K(options));
+  } else if (FALSE_IT(log_io_worker_config_.io_depth_ = options.disk_options_.log_writer_io_depth_)) {
+    // NB: at most one BatchLogIOFlushLogTask for each palf instance in one round, make sure there
+    // are enough of them to fill 'io_depth_'.
+  } else if (FALSE_IT(log_io_worker_config_.batch_width_ = MAX(log_io_worker_config_.batch_width_,
+                                                               log_io_worker_config_.io_depth_))) {
   } else if (OB_FAIL(fetch_log_engine_.init(this, log_alloc_mgr))) {
     PALF_LOG(ERROR, "FetchLogEngine init failed", K(ret));
   } else if (OB_FAIL(log_rpc_.init(self, cluster_id, tenant_id, transport, batch_rpc))) {
@@ -279,6 +285,7 @@ int PalfEnvImpl::init(
     is_inited_ = true;
     is_running_ = true;
     enable_log_cache_ = options.enable_log_cache_;
+    log_cache_read_ahead_size_ = options.log_cache_read_ahead_size_;
     PALF_LOG(INFO, "PalfEnvImpl init success", K(ret), K(self_), KPC(this));
   }
   if (OB_FAIL(ret) && OB_INIT_TWICE != ret) {
@@ -369,6 +376,7 @@ void PalfEnvImpl::destroy()
   disk_options_wrapper_.reset();
   rebuild_replica_log_lag_threshold_ = 0;
   enable_log_cache_ = false;
+  log_cache_read_ahead_size_ = 0;
 }
 
 // NB: not thread safe
@@ -942,6 +950,7 @@ int PalfEnvImpl::update_options(const PalfOptions &options)
     PALF_LOG(WARN, "update_disk_options failed", K(ret), K(options));
   } else {
     enable_log_cache_ = options.enable_log_cache_;
+    log_cache_read_ahead_size_ = options.log_cache_read_ahead_size_;
     PALF_LOG(INFO, "update_options successs", K(options), KPC(this));
   }
   return ret;
@@ -957,6 +966,7 @@ int PalfEnvImpl::get_options(PalfOptions &options)
     options.compress_options_ = log_rpc_.get_compress_opts();
     options.rebuild_replica_log_lag_threshold_ = rebuild_replica_log_lag_threshold_;
     options.enable_log_cache_ = enable_log_cache_;
+    options.log_cache_read_ahead_size_ = log_cache_read_ahead_size_;
   }
   return ret;
 }
@@ -392,6 +392,7 @@ private:
   int64_t last_palf_epoch_;
   int64_t rebuild_replica_log_lag_threshold_;//for rebuild test
   bool enable_log_cache_;
+  int64_t log_cache_read_ahead_size_;
 
   LogIOWorkerConfig log_io_worker_config_;
   bool diskspace_enough_;
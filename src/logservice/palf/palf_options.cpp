@@ -26,11 +26,13 @@ void PalfOptions::reset()
   compress_options_.reset();
   rebuild_replica_log_lag_threshold_ = 0;
   enable_log_cache_ = false;
+  log_cache_read_ahead_size_ = 0;
 }
 
 bool PalfOptions::is_valid() const
 {
-  return disk_options_.is_valid() && compress_options_.is_valid() && (rebuild_replica_log_lag_threshold_ >= 0);
+  return disk_options_.is_valid() && compress_options_.is_valid() && (rebuild_replica_log_lag_threshold_ >= 0)
+      && (log_cache_read_ahead_size_ >= 0);
 }
 
 void PalfDiskOptions::reset()
@@ -41,6 +43,7 @@ void PalfDiskOptions::reset()
   log_disk_throttling_percentage_ = -1;
   log_disk_throttling_maximum_duration_ = -1;
   log_writer_parallelism_ = -1;
+  log_writer_io_depth_ = 1;
 }
 
 bool PalfDiskOptions::is_valid() const
@@ -55,7 +58,8 @@ bool PalfDiskOptions::is_valid() const
     && log_disk_throttling_percentage_ <= 100
     && log_disk_throttling_maximum_duration_ >= MIN_DURATION
     && log_disk_throttling_maximum_duration_ <= MAX_DURATION
-    && log_writer_parallelism_ >= 1 && log_writer_parallelism_ <= 8;
+    && log_writer_parallelism_ >= 1 && log_writer_parallelism_ <= 8
+    && log_writer_io_depth_ >= 1 && log_writer_io_depth_ <= 16;
 }
 
 bool PalfDiskOptions::operator==(const PalfDiskOptions &palf_disk_options) const
@@ -65,7 +69,8 @@ bool PalfDiskOptions::operator==(const PalfDiskOptions &palf_disk_options) const
     && log_disk_utilization_limit_threshold_ == palf_disk_options.log_disk_utilization_limit_threshold_
     && log_disk_throttling_percentage_ == palf_disk_options.log_disk_throttling_percentage_
     && log_disk_throttling_maximum_duration_ == palf_disk_options.log_disk_throttling_maximum_duration_
-    && log_writer_parallelism_ == palf_disk_options.log_writer_parallelism_;
+    && log_writer_parallelism_ == palf_disk_options.log_writer_parallelism_
+    && log_writer_io_depth_ == palf_disk_options.log_writer_io_depth_;
 }
 
 bool PalfDiskOptions::operator!=(const PalfDiskOptions &palf_disk_options) const
@@ -81,6 +86,7 @@ PalfDiskOptions &PalfDiskOptions::operator=(const PalfDiskOptions &other)
   log_disk_throttling_percentage_ = other.log_disk_throttling_percentage_;
   log_disk_throttling_maximum_duration_ = other.log_disk_throttling_maximum_duration_;
   log_writer_parallelism_ = other.log_writer_parallelism_;
+  log_writer_io_depth_ = other.log_writer_io_depth_;
   return *this;
 }
 
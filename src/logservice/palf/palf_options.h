@@ -25,6 +25,7 @@ namespace palf
 // 3. log_disk_utilization_limit_threshold_, maximum of log disk usage percentage before stop submitting or receiving logs.
 // 4. log_disk_throttling_percentage_, the threshold of the size of the log disk when writing_limit will be triggered.
 // 5. log_writer_parallelism, the number of parallel log writer processes that can be used to write redo log entries to disk.
+// 6. log_writer_io_depth, the number of log group writes of different palf instances which are in flight at the same time in one log writer.
 struct PalfDiskOptions
 {
   PalfDiskOptions() : log_disk_usage_limit_size_(-1),
@@ -32,7 +33,8 @@ struct PalfDiskOptions
                       log_disk_utilization_limit_threshold_(-1),
                       log_disk_throttling_percentage_(-1),
                       log_disk_throttling_maximum_duration_(-1),
-                      log_writer_parallelism_(-1)
+                      log_writer_parallelism_(-1),
+                      log_writer_io_depth_(1)
   {}
   ~PalfDiskOptions() { reset(); }
   static constexpr int64_t MB = 1024*1024ll;
@@ -47,12 +49,14 @@ struct PalfDiskOptions
   int64_t log_disk_throttling_percentage_;
   int64_t log_disk_throttling_maximum_duration_;
   int log_writer_parallelism_;
+  int log_writer_io_depth_;
   TO_STRING_KV("log_disk_size(MB)", log_disk_usage_limit_size_ / MB,
                "log_disk_utilization_threshold(%)", log_disk_utilization_threshold_,
                "log_disk_utilization_limit_threshold(%)", log_disk_utilization_limit_threshold_,
                "log_disk_throttling_percentage(%)", log_disk_throttling_percentage_,
                "log_disk_throttling_maximum_duration(s)", log_disk_throttling_maximum_duration_ / (1000 * 1000),
-               "log_writer_parallelism", log_writer_parallelism_);
+               "log_writer_parallelism", log_writer_parallelism_,
+               "log_writer_io_depth", log_writer_io_depth_);
 };
 
 
@@ -174,7 +178,8 @@ struct PalfOptions
   PalfOptions() : disk_options_(),
                   compress_options_(),
                   rebuild_replica_log_lag_threshold_(0),
-                  enable_log_cache_(false)
+                  enable_log_cache_(false),
+                  log_cache_read_ahead_size_(0)
   {}
   ~PalfOptions() { reset(); }
   void reset();
@@ -182,12 +187,15 @@ struct PalfOptions
   TO_STRING_KV(K(disk_options_),
                K(compress_options_),
                K(rebuild_replica_log_lag_threshold_),
-               K(enable_log_cache_));
+               K(enable_log_cache_),
+               K(log_cache_read_ahead_size_));
 public:
   PalfDiskOptions disk_options_;
   PalfTransportCompressOptions compress_options_;
   int64_t rebuild_replica_log_lag_threshold_;
   bool enable_log_cache_;
+  // the size of logs read ahead into log kv cache on a sequential miss, 0 means disabled
+  int64_t log_cache_read_ahead_size_;
 };
 
 struct PalfThrottleOptions
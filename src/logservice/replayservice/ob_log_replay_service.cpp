@@ -868,6 +868,11 @@ int64_t ObLogReplayService::get_pending_task_size() const
   return ATOMIC_LOAD(&pending_replay_log_size_);
 }
 
+int64_t ObLogReplayService::get_replay_worker_cnt() const
+{
+  return (IS_NOT_INIT || -1 == tg_id_) ? 0 : TG_GET_THREAD_CNT(tg_id_);
+}
+
 void *ObLogReplayService::alloc_replay_task(const int64_t size)
 {
   return allocator_->alloc_replay_task(size);
@@ -1400,6 +1405,7 @@ int ObLogReplayService::handle_replay_task_(ObReplayServiceReplayTask *task_queu
         }
       }
     } while (OB_SUCC(ret) && (!is_queue_empty) && (!is_timeslice_run_out));
+    replay_status->add_replay_busy_time(ObTimeUtility::fast_current_time() - start_ts);
   }
   return ret;
 }
@@ -1508,6 +1514,7 @@ int ObLogReplayService::transform_replay_task_(ObLogReplayTask *replay_task,
     int64_t original_log_size = 0;
     const int64_t base_header_len = replay_task->base_header_len_;
     const int64_t decompress_log_size = replay_task->decompressed_log_size_;
+    const int64_t decompress_start_ts = ObTimeUtility::fast_current_time();
     if (OB_FAIL(logservice::decompress(static_cast<const char *>(replay_task->read_log_buf_) + base_header_len,
                                        replay_task->read_log_size_ - base_header_len,
                                        static_cast<char *>(decompression_buf) + base_header_len,
@@ -1519,6 +1526,8 @@ int ObLogReplayService::transform_replay_task_(ObLogReplayTask *replay_task,
     } else {
       MEMCPY(decompression_buf, replay_task->read_log_buf_, base_header_len);
       replay_task->has_decompressed_ = true;
+      EVENT_ADD(LOG_STORAGE_DECOMPRESS_SIZE, original_log_size);
+      EVENT_ADD(LOG_STORAGE_DECOMPRESS_TIME, ObTimeUtility::fast_current_time() - decompress_start_ts);
     }
   }
   return ret;
@@ -1671,6 +1680,7 @@ bool ObLogReplayService::StatReplayProcessFunctor::operator()(const share::ObLSI
                                                        replayed_log_size, unreplayed_log_size))){
     CLOG_LOG(WARN, "get_replay_process failed", K(id), KR(ret), KPC(replay_status));
   } else {
+    replay_status->sample_worker_usage();
     submitted_log_size_ += submitted_log_size;
     unsubmitted_log_size_ += unsubmitted_log_size;
     replayed_log_size_ += replayed_log_size;
@@ -173,6 +173,7 @@ public:
   void inc_pending_task_size(const int64_t log_size);
   void dec_pending_task_size(const int64_t log_size);
   int64_t get_pending_task_size() const;
+  int64_t get_replay_worker_cnt() const;
   void *alloc_replay_task(const int64_t size);
   void free_replay_task(ObLogReplayTask *task);
   void free_replay_task_log_buf(ObLogReplayTask *task);
@@ -421,6 +421,20 @@ int ObReplayServiceReplayTask::get_min_unreplayed_log_info(LSN &lsn,
   return ret;
 }
 
+int ObReplayServiceReplayTask::get_min_unreplayed_scn(SCN &scn, bool &is_queue_empty) const
+{
+  int ret = OB_SUCCESS;
+  ObLockGuard<ObSpinLock> guard(lock_);
+  ObLink *top_item = queue_.top();
+  if (NULL != top_item) {
+    scn = static_cast<ObLogReplayTask *>(top_item)->scn_;
+    is_queue_empty = false;
+  } else {
+    is_queue_empty = true;
+  }
+  return ret;
+}
+
 ObLink *ObReplayServiceReplayTask::pop()
 {
   ObLockGuard<ObSpinLock> guard(lock_);
@@ -589,6 +603,10 @@ ObReplayStatus::ObReplayStatus():
     post_barrier_lsn_(),
     err_info_(),
     pending_task_count_(0),
+    replay_busy_time_(0),
+    last_stat_ts_(OB_INVALID_TIMESTAMP),
+    last_stat_busy_time_(0),
+    worker_usage_(0),
     last_check_memstore_lsn_(),
     rwlock_(common::ObLatchIds::REPLAY_STATUS_LOCK),
     rolelock_(common::ObLatchIds::REPLAY_STATUS_LOCK),
@@ -672,6 +690,10 @@ void ObReplayStatus::destroy()
     err_info_.reset();
     last_check_memstore_lsn_.reset();
     pending_task_count_ = 0;
+    replay_busy_time_ = 0;
+    last_stat_ts_ = OB_INVALID_TIMESTAMP;
+    last_stat_busy_time_ = 0;
+    worker_usage_ = 0;
     fs_cb_.destroy();
     get_log_info_debug_time_ = OB_INVALID_TIMESTAMP;
     try_wrlock_debug_time_ = OB_INVALID_TIMESTAMP;
@@ -1375,11 +1397,51 @@ int ObReplayStatus::stat(LSReplayStat &stat) const
       CLOG_LOG(WARN, "get_next_to_submit_log_info failed", KPC(this), K(ret));
     } else if (OB_FAIL(palf_handle_.get_end_lsn(stat.end_lsn_))) {
       CLOG_LOG(WARN, "get_end_lsn from palf failed", KPC(this), K(ret));
+    } else {
+      (void)stat_replay_parallelism_(stat);
     }
   }
   return ret;
 }
 
+void ObReplayStatus::stat_replay_parallelism_(LSReplayStat &stat) const
+{
+  const int64_t now = ObTimeUtility::current_time();
+  SCN min_unreplayed_scn = SCN::max_scn();
+  SCN queue_scn;
+  bool is_queue_empty = true;
+  stat.active_queue_cnt_ = 0;
+  for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+    if (OB_SUCCESS == task_queues_[i].get_min_unreplayed_scn(queue_scn, is_queue_empty)
+        && !is_queue_empty) {
+      stat.active_queue_cnt_++;
+      min_unreplayed_scn = MIN(min_unreplayed_scn, queue_scn);
+    }
+  }
+  // the logs which have not been submitted are newer than the logs in task queues
+  if (0 == stat.active_queue_cnt_ && stat.unsubmitted_lsn_ < stat.end_lsn_
+      && stat.unsubmitted_scn_.is_valid()) {
+    min_unreplayed_scn = stat.unsubmitted_scn_;
+  }
+  stat.replay_lag_ = (!is_enabled_ || LEADER == role_ || SCN::max_scn() == min_unreplayed_scn) ?
+      0 : MAX(0, now - min_unreplayed_scn.convert_to_ts());
+  stat.worker_usage_ = ATOMIC_LOAD(&worker_usage_);
+  stat.replay_worker_cnt_ = OB_ISNULL(rp_sv_) ? 0 : rp_sv_->get_replay_worker_cnt();
+}
+
+// called by ReplayProcessStat periodically, so that the worker usage is always computed
+// over the same window no matter how often the virtual table is queried
+void ObReplayStatus::sample_worker_usage()
+{
+  const int64_t now = ObTimeUtility::current_time();
+  const int64_t busy_time = ATOMIC_LOAD(&replay_busy_time_);
+  if (OB_INVALID_TIMESTAMP != last_stat_ts_ && now > last_stat_ts_) {
+    ATOMIC_STORE(&worker_usage_, (busy_time - last_stat_busy_time_) * 100 / (now - last_stat_ts_));
+  }
+  last_stat_ts_ = now;
+  last_stat_busy_time_ = busy_time;
+}
+
 int ObReplayStatus::diagnose(ReplayDiagnoseInfo &diagnose_info)
 {
   int ret = OB_SUCCESS;
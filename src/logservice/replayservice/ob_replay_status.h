@@ -67,6 +67,16 @@ struct LSReplayStat
   palf::LSN unsubmitted_lsn_;
   share::SCN unsubmitted_scn_;
   int64_t pending_cnt_;
+  // now minus the scn of the oldest log which has not been replayed, in microseconds
+  int64_t replay_lag_;
+  // the number of replay task queues which have tasks to be replayed, namely
+  // the number of workers this log stream can make use of right now
+  int64_t active_queue_cnt_;
+  // the time spent by workers on replaying this log stream divided by the wall time
+  // of the last sample window, in percent, 300 means three workers are busy on average
+  int64_t worker_usage_;
+  // the number of worker threads of the replay service
+  int64_t replay_worker_cnt_;
 
   TO_STRING_KV(K(ls_id_),
                K(role_),
@@ -74,7 +84,11 @@ struct LSReplayStat
                K(enabled_),
                K(unsubmitted_lsn_),
                K(unsubmitted_scn_),
-               K(pending_cnt_));
+               K(pending_cnt_),
+               K(replay_lag_),
+               K(active_queue_cnt_),
+               K(worker_usage_),
+               K(replay_worker_cnt_));
 };
 
 struct ReplayDiagnoseInfo
@@ -375,6 +389,7 @@ public:
                                   int64_t &replay_cost,
                                   int64_t &retry_cost,
                                   bool &is_queue_empty);
+  int get_min_unreplayed_scn(share::SCN &scn, bool &is_queue_empty) const;
   bool need_batch_push();
   void set_batch_push_finish();
   INHERIT_TO_STRING_KV("ObReplayServiceReplayTask", ObReplayServiceTask,
@@ -509,6 +524,13 @@ public:
   int batch_push_all_task_queue();
   void inc_pending_task(const int64_t log_size);
   void dec_pending_task(const int64_t log_size);
+  // accumulate the time spent by replay workers on this log stream
+  void add_replay_busy_time(const int64_t busy_time)
+  {
+    ATOMIC_AAF(&replay_busy_time_, busy_time);
+  }
+  // refresh worker usage with the busy time since last sample
+  void sample_worker_usage();
   //通用的replay task释放内存接口, 前向barrier的任务不会单独释放log buf内存
   //前向barrier完整释放申请的内存需要同时调用
   //free_replay_task_log_buf()和free_replay_task()
@@ -597,6 +619,7 @@ private:
   // 注销回调并清空任务
   int disable_();
   bool is_replay_enabled_() const;
+  void stat_replay_parallelism_(LSReplayStat &stat) const;
 
 private:
   static const int64_t PENDING_COUNT_THRESHOLD = 100;
@@ -622,6 +645,11 @@ private:
   // record error info, reported when handle submit or replay type task
   LSErrInfo err_info_;
   int64_t pending_task_count_;
+  // used for statistics of worker usage, sampled by ReplayProcessStat
+  int64_t replay_busy_time_;
+  int64_t last_stat_ts_;
+  int64_t last_stat_busy_time_;
+  int64_t worker_usage_;
   palf::LSN last_check_memstore_lsn_;
   // protect is_enabled_ and submit_log_task_
   // 回放一条日志时会一直持有读锁直到回放完成
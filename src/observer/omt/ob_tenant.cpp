@@ -194,6 +194,36 @@ int ObPxPools::DeletePoolFunc::operator() (common::hash::HashMapPair<int64_t, Ob
   return ret;
 }
 
+int64_t ObPxPools::acquire_helper_threads(const int64_t max_cnt, const int64_t limit)
+{
+  int64_t acquired_cnt = 0;
+  int64_t old_cnt = ATOMIC_LOAD(&helper_thread_cnt_);
+  while (max_cnt > 0) {
+    acquired_cnt = std::min(max_cnt, limit - old_cnt);
+    if (acquired_cnt <= 0) {
+      acquired_cnt = 0;
+      break;
+    } else {
+      const int64_t cur_cnt = ATOMIC_VCAS(&helper_thread_cnt_, old_cnt, old_cnt + acquired_cnt);
+      if (cur_cnt == old_cnt) {
+        break;
+      }
+      old_cnt = cur_cnt;
+    }
+  }
+  return acquired_cnt;
+}
+
+void ObPxPools::release_helper_threads(const int64_t cnt)
+{
+  if (cnt > 0) {
+    const int64_t cur_cnt = ATOMIC_SAF(&helper_thread_cnt_, cnt);
+    if (OB_UNLIKELY(cur_cnt < 0)) {
+      LOG_ERROR_RET(OB_ERR_UNEXPECTED, "helper thread count is negative", K(cnt), K(cur_cnt));
+    }
+  }
+}
+
 void ObPxPools::mtl_stop(ObPxPools *&pools)
 {
   int ret = OB_SUCCESS;
@@ -885,7 +915,9 @@ int ObTenant::construct_mtl_init_ctx(const ObTenantMeta &meta, share::ObTenantMo
       ret = is_virtual_tenant_id(id_) ? OB_SUCCESS : OB_ENTRY_NOT_EXIST;
     } else {
       mtl_init_ctx_->palf_options_.disk_options_.log_writer_parallelism_ = tenant_config->_log_writer_parallelism;
+      mtl_init_ctx_->palf_options_.disk_options_.log_writer_io_depth_ = tenant_config->_log_writer_io_depth;
       mtl_init_ctx_->palf_options_.enable_log_cache_ = tenant_config->_enable_log_cache;
+      mtl_init_ctx_->palf_options_.log_cache_read_ahead_size_ = tenant_config->_log_cache_read_ahead_size;
     }
     LOG_INFO("construct_mtl_init_ctx success", "palf_options", mtl_init_ctx_->palf_options_.disk_options_);
   }
@@ -146,7 +146,7 @@ public:
     pools = nullptr;
   }
 public:
-  ObPxPools() : tenant_id_(common::OB_INVALID_ID)
+  ObPxPools() : tenant_id_(common::OB_INVALID_ID), helper_thread_cnt_(0)
   {}
   ~ObPxPools()
   {
@@ -155,6 +155,11 @@ public:
   int init(uint64_t tenant_id);
   int get_or_create(int64_t group_id, ObPxPool *&pool);
   int thread_recycle();
+  // threads borrowed by intra-operator parallelism of operators which are not executed
+  // by PX workers (e.g. in-memory sort above the PX coordinator), bounded by %limit for
+  // the whole tenant. return the number of threads acquired, which may be 0.
+  int64_t acquire_helper_threads(const int64_t max_cnt, const int64_t limit);
+  void release_helper_threads(const int64_t cnt);
 private:
   void destroy();
   int create_pool(int64_t group_id, ObPxPool *&pool);
@@ -162,6 +167,7 @@ private:
   uint64_t tenant_id_;
   common::SpinRWLock lock_;
   common::hash::ObHashMap<int64_t, ObPxPool *> pool_map_;
+  int64_t helper_thread_cnt_;
 };
 
 
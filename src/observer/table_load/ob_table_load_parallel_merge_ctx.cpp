@@ -553,6 +553,7 @@ ObTableLoadParallelMergeCtx::ObTableLoadParallelMergeCtx()
   light_task_list_.set_tenant_id(MTL_ID());
   heavy_task_list_.set_tenant_id(MTL_ID());
   idle_thread_list_.set_tenant_id(MTL_ID());
+  range_ctxs_.set_tenant_id(MTL_ID());
 }
 
 ObTableLoadParallelMergeCtx::~ObTableLoadParallelMergeCtx()
@@ -563,6 +564,12 @@ ObTableLoadParallelMergeCtx::~ObTableLoadParallelMergeCtx()
     allocator_.free(tablet_ctx);
   }
   tablet_ctx_map_.reuse();
+  for (int64_t i = 0; i < range_ctxs_.count(); ++i) {
+    ObTableLoadParallelMergeTabletCtx *range_ctx = range_ctxs_.at(i);
+    range_ctx->~ObTableLoadParallelMergeTabletCtx();
+    allocator_.free(range_ctx);
+  }
+  range_ctxs_.reset();
   for (int64_t i = 0; i < light_task_list_.count(); ++i) {
     ObTableLoadTask *task = light_task_list_.at(i);
     store_ctx_->ctx_->free_task(task);
@@ -630,28 +637,71 @@ int ObTableLoadParallelMergeCtx::add_tablet_sstable(ObDirectLoadMultipleSSTable
       }
     }
     if (OB_SUCC(ret)) {
-      ObDirectLoadMultipleSSTable *copied_sstable = nullptr;
-      if (OB_ISNULL(copied_sstable =
-                      OB_NEWx(ObDirectLoadMultipleSSTable, (&tablet_ctx->allocator_)))) {
+      if (OB_FAIL(add_sstable(tablet_ctx, sstable))) {
+        LOG_WARN("fail to add sstable", KR(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObTableLoadParallelMergeCtx::add_range_sstable(const int64_t range_idx,
+                                                   ObDirectLoadMultipleSSTable *sstable)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObTableLoadParallelMergeCtx not init", KR(ret), KP(this));
+  } else if (OB_UNLIKELY(range_idx < 0 || nullptr == sstable || !sstable->is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", KR(ret), K(range_idx), KPC(sstable));
+  } else {
+    while (OB_SUCC(ret) && range_ctxs_.count() <= range_idx) {
+      ObTableLoadParallelMergeTabletCtx *range_ctx = nullptr;
+      if (OB_ISNULL(range_ctx = OB_NEWx(ObTableLoadParallelMergeTabletCtx, (&allocator_)))) {
         ret = OB_ALLOCATE_MEMORY_FAILED;
-        LOG_WARN("fail to new ObDirectLoadMultipleSSTable", KR(ret));
-      } else if (OB_FAIL(copied_sstable->copy(*sstable))) {
-        LOG_WARN("fail to copy multiple sstable", KR(ret));
-      } else if (OB_FAIL(tablet_ctx->sstables_.push_back(copied_sstable))) {
+        LOG_WARN("fail to new ObTableLoadParallelMergeTabletCtx", KR(ret));
+      } else if (FALSE_IT(range_ctx->tablet_id_ = sstable->get_tablet_id())) {
+      } else if (OB_FAIL(range_ctxs_.push_back(range_ctx))) {
         LOG_WARN("fail to push back", KR(ret));
+        range_ctx->~ObTableLoadParallelMergeTabletCtx();
+        allocator_.free(range_ctx);
+        range_ctx = nullptr;
       }
-      if (OB_FAIL(ret)) {
-        if (nullptr != copied_sstable) {
-          copied_sstable->~ObDirectLoadMultipleSSTable();
-          tablet_ctx->allocator_.free(copied_sstable);
-          copied_sstable = nullptr;
-        }
+    }
+    if (OB_SUCC(ret)) {
+      if (OB_FAIL(add_sstable(range_ctxs_.at(range_idx), sstable))) {
+        LOG_WARN("fail to add sstable", KR(ret), K(range_idx));
       }
     }
   }
   return ret;
 }
 
+int ObTableLoadParallelMergeCtx::add_sstable(ObTableLoadParallelMergeTabletCtx *tablet_ctx,
+                                             ObDirectLoadMultipleSSTable *sstable)
+{
+  int ret = OB_SUCCESS;
+  ObDirectLoadMultipleSSTable *copied_sstable = nullptr;
+  if (OB_ISNULL(copied_sstable =
+                  OB_NEWx(ObDirectLoadMultipleSSTable, (&tablet_ctx->allocator_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to new ObDirectLoadMultipleSSTable", KR(ret));
+  } else if (OB_FAIL(copied_sstable->copy(*sstable))) {
+    LOG_WARN("fail to copy multiple sstable", KR(ret));
+  } else if (OB_FAIL(tablet_ctx->sstables_.push_back(copied_sstable))) {
+    LOG_WARN("fail to push back", KR(ret));
+  }
+  if (OB_FAIL(ret)) {
+    if (nullptr != copied_sstable) {
+      copied_sstable->~ObDirectLoadMultipleSSTable();
+      tablet_ctx->allocator_.free(copied_sstable);
+      copied_sstable = nullptr;
+    }
+  }
+  return ret;
+}
+
 int ObTableLoadParallelMergeCtx::add_light_task(ObTableLoadTask *task)
 {
   int ret = OB_SUCCESS;
@@ -707,14 +757,14 @@ int ObTableLoadParallelMergeCtx::start(ObTableLoadParallelMergeCb *cb)
     cb_ = cb;
     for (TabletCtxIterator iter = tablet_ctx_map_.begin();
          OB_SUCC(ret) && iter != tablet_ctx_map_.end(); ++iter) {
-      ObTableLoadParallelMergeTabletCtx *tablet_ctx = iter->second;
-      if (tablet_ctx->sstables_.size() > table_data_desc_.merge_count_per_round_) {
-        // need merge
-        if (OB_FAIL(construct_split_range_task(tablet_ctx))) {
-          LOG_WARN("fail to construct split range task", KR(ret));
-        }
-      } else {
-        ATOMIC_AAF(&store_ctx_->ctx_->job_stat_->store_.compact_stage_consume_tmp_files_, tablet_ctx->sstables_.size());
+      if (OB_FAIL(prepare_merge(iter->second))) {
+        LOG_WARN("fail to prepare merge", KR(ret));
+      }
+    }
+    // each range is merged independently, the same as a tablet
+    for (int64_t i = 0; OB_SUCC(ret) && i < range_ctxs_.count(); ++i) {
+      if (OB_FAIL(prepare_merge(range_ctxs_.at(i)))) {
+        LOG_WARN("fail to prepare merge", KR(ret), K(i));
       }
     }
     if (OB_SUCC(ret)) {
@@ -731,6 +781,20 @@ int ObTableLoadParallelMergeCtx::start(ObTableLoadParallelMergeCb *cb)
   return ret;
 }
 
+int ObTableLoadParallelMergeCtx::prepare_merge(ObTableLoadParallelMergeTabletCtx *tablet_ctx)
+{
+  int ret = OB_SUCCESS;
+  if (tablet_ctx->sstables_.size() > table_data_desc_.merge_count_per_round_) {
+    // need merge
+    if (OB_FAIL(construct_split_range_task(tablet_ctx))) {
+      LOG_WARN("fail to construct split range task", KR(ret));
+    }
+  } else {
+    ATOMIC_AAF(&store_ctx_->ctx_->job_stat_->store_.compact_stage_consume_tmp_files_, tablet_ctx->sstables_.size());
+  }
+  return ret;
+}
+
 void ObTableLoadParallelMergeCtx::stop()
 {
   is_stop_ = true;
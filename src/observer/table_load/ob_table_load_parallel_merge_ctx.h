@@ -84,10 +84,19 @@ public:
   ~ObTableLoadParallelMergeCtx();
   int init(ObTableLoadStoreCtx *store_ctx, ObTableLoadStoreTableCtx *store_table_ctx, const ObDirectLoadTableDataDesc &table_data_desc);
   int add_tablet_sstable(storage::ObDirectLoadMultipleSSTable *sstable);
+  // sample sort runs, the runs of each range are merged independently
+  int add_range_sstable(const int64_t range_idx, storage::ObDirectLoadMultipleSSTable *sstable);
   int start(ObTableLoadParallelMergeCb *cb);
   void stop();
   const TabletCtxMap &get_tablet_ctx_map() const { return tablet_ctx_map_; }
+  const common::ObIArray<ObTableLoadParallelMergeTabletCtx *> &get_range_ctxs() const
+  {
+    return range_ctxs_;
+  }
 private:
+  int add_sstable(ObTableLoadParallelMergeTabletCtx *tablet_ctx,
+                  storage::ObDirectLoadMultipleSSTable *sstable);
+  int prepare_merge(ObTableLoadParallelMergeTabletCtx *tablet_ctx);
   int start_merge();
   int schedule_merge_unlock();
   int construct_split_range_task(ObTableLoadParallelMergeTabletCtx *tablet_ctx);
@@ -111,6 +120,7 @@ private:
   ObTableLoadParallelMergeCb *cb_;
   common::ObArenaAllocator allocator_;
   TabletCtxMap tablet_ctx_map_;
+  common::ObArray<ObTableLoadParallelMergeTabletCtx *> range_ctxs_;
   mutable lib::ObMutex mutex_;
   ObArray<ObTableLoadTask *> light_task_list_;
   ObArray<ObTableLoadTask *> heavy_task_list_;
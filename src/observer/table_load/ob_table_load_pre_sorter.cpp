@@ -118,6 +118,7 @@ int ObTableLoadPreSorter::init_mem_ctx()
   mem_ctx_.dml_row_handler_ = store_ctx_->data_store_table_ctx_->row_handler_;
   mem_ctx_.dup_action_ = ctx_->param_.dup_action_;
   mem_ctx_.file_mgr_ = store_ctx_->tmp_file_mgr_;
+  mem_ctx_.use_sample_sort_ = true;
   if (OB_FAIL(mem_ctx_.init())) {
     LOG_WARN("fail to init mem ctx", KR(ret));
   }
@@ -280,15 +281,17 @@ int ObTableLoadPreSorter::prepare_parallel_merge()
 int ObTableLoadPreSorter::add_table_to_parallel_merge_ctx()
 {
   int ret = OB_SUCCESS;
-  for (int64_t i = 0; OB_SUCC(ret) && i < mem_ctx_.tables_.count(); i ++) {
-    ObIDirectLoadPartitionTable *table = mem_ctx_.tables_.at(i);
+  // runs of the same range are merged independently
+  for (int64_t i = 0; OB_SUCC(ret) && i < mem_ctx_.range_tables_.count(); i ++) {
+    const int64_t range_idx = mem_ctx_.range_tables_.at(i).first;
+    ObIDirectLoadPartitionTable *table = mem_ctx_.range_tables_.at(i).second;
     ObDirectLoadMultipleSSTable *sstable = nullptr;
     sstable = static_cast<ObDirectLoadMultipleSSTable *>(table);
     if (OB_ISNULL(sstable)) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("unexpected table", KR(ret), K(i), KPC(table));
-    } else if (OB_FAIL(parallel_merge_ctx_.add_tablet_sstable(sstable))) {
-      LOG_WARN("fail to add tablet sstable", KR(ret));
+    } else if (OB_FAIL(parallel_merge_ctx_.add_range_sstable(range_idx, sstable))) {
+      LOG_WARN("fail to add range sstable", KR(ret), K(range_idx));
     }
   }
   if (OB_SUCC(ret)) {
@@ -333,27 +336,43 @@ int ObTableLoadPreSorter::build_parallel_merge_result()
     LOG_WARN("merger should not be nullptr", KR(ret));
   } else {
     ObTableLoadTableCompactResult &result = merger->table_compact_ctx_.result_;
+    const ObIArray<ObTableLoadParallelMergeTabletCtx *> &range_ctxs =
+      parallel_merge_ctx_.get_range_ctxs();
     for (ObTableLoadParallelMergeCtx::TabletCtxIterator tablet_ctx_iter = tablet_ctx_map.begin();
         OB_SUCC(ret) && tablet_ctx_iter != tablet_ctx_map.end(); ++tablet_ctx_iter) {
-      ObTableLoadParallelMergeTabletCtx *tablet_ctx = tablet_ctx_iter->second;
-      for (int64_t i = 0; OB_SUCC(ret) && i < tablet_ctx->sstables_.size(); ++i) {
-        ObDirectLoadMultipleSSTable *sstable = tablet_ctx->sstables_.at(i);
-        ObDirectLoadMultipleSSTable *copied_sstable = nullptr;
-        if (OB_ISNULL(copied_sstable = OB_NEWx(ObDirectLoadMultipleSSTable,
-                        (&result.allocator_)))) {
-          ret = OB_ALLOCATE_MEMORY_FAILED;
-          LOG_WARN("fail to new ObDirectLoadMultipleSSTable", KR(ret));
-        } else if (OB_FAIL(copied_sstable->copy(*sstable))) {
-          LOG_WARN("fail to copy sstable", KR(ret));
-        } else if (OB_FAIL(result.add_table(copied_sstable))) {
-          LOG_WARN("fail to add table", KR(ret));
-        }
-        if (OB_FAIL(ret)) {
-          if (nullptr != copied_sstable) {
-            copied_sstable->~ObDirectLoadMultipleSSTable();
-            result.allocator_.free(copied_sstable);
-          }
-        }
+      if (OB_FAIL(add_parallel_merge_result(tablet_ctx_iter->second, result))) {
+        LOG_WARN("fail to add parallel merge result", KR(ret));
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < range_ctxs.count(); ++i) {
+      if (OB_FAIL(add_parallel_merge_result(range_ctxs.at(i), result))) {
+        LOG_WARN("fail to add parallel merge result", KR(ret), K(i));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObTableLoadPreSorter::add_parallel_merge_result(ObTableLoadParallelMergeTabletCtx *tablet_ctx,
+                                                    ObTableLoadTableCompactResult &result)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < tablet_ctx->sstables_.size(); ++i) {
+    ObDirectLoadMultipleSSTable *sstable = tablet_ctx->sstables_.at(i);
+    ObDirectLoadMultipleSSTable *copied_sstable = nullptr;
+    if (OB_ISNULL(copied_sstable = OB_NEWx(ObDirectLoadMultipleSSTable,
+                    (&result.allocator_)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to new ObDirectLoadMultipleSSTable", KR(ret));
+    } else if (OB_FAIL(copied_sstable->copy(*sstable))) {
+      LOG_WARN("fail to copy sstable", KR(ret));
+    } else if (OB_FAIL(result.add_table(copied_sstable))) {
+      LOG_WARN("fail to add table", KR(ret));
+    }
+    if (OB_FAIL(ret)) {
+      if (nullptr != copied_sstable) {
+        copied_sstable->~ObDirectLoadMultipleSSTable();
+        result.allocator_.free(copied_sstable);
       }
     }
   }
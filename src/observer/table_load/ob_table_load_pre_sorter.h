@@ -60,6 +60,8 @@ private:
                                             ObTableLoadMerger *merger,
                                             ObTableLoadTableCompactResult &result);
   int build_parallel_merge_result();
+  int add_parallel_merge_result(ObTableLoadParallelMergeTabletCtx *tablet_ctx,
+                                ObTableLoadTableCompactResult &result);
   int handle_pre_sort_success();
   int finish();
   int build_merge_ctx();
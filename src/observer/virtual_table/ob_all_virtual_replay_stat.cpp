@@ -122,6 +122,18 @@ int ObAllVirtualReplayStat::insert_stat_(logservice::LSReplayStat &replay_stat)
       case OB_APP_MIN_COLUMN_ID + 9:
         cur_row_.cells_[i].set_int(replay_stat.pending_cnt_);
         break;
+      case OB_APP_MIN_COLUMN_ID + 10:
+        cur_row_.cells_[i].set_int(replay_stat.replay_lag_);
+        break;
+      case OB_APP_MIN_COLUMN_ID + 11:
+        cur_row_.cells_[i].set_int(replay_stat.active_queue_cnt_);
+        break;
+      case OB_APP_MIN_COLUMN_ID + 12:
+        cur_row_.cells_[i].set_int(replay_stat.worker_usage_);
+        break;
+      case OB_APP_MIN_COLUMN_ID + 13:
+        cur_row_.cells_[i].set_int(replay_stat.replay_worker_cnt_);
+        break;
       default:
         ret = OB_ERR_UNEXPECTED;
         SERVER_LOG(WARN, "unkown column");
@@ -28,6 +28,7 @@ ObAllVirtualTabletCompactionHistory::ObAllVirtualTabletCompactionHistory()
       macro_id_list_(),
       other_info_(),
       comment_(),
+      cs_integer_codecs_(),
       merge_history_(),
       major_merge_info_iter_(),
       minor_merge_info_iter_()
@@ -275,6 +276,12 @@ int ObAllVirtualTabletCompactionHistory::process_curr_tenant(ObNewRow *&row)
       }
       cells[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
       break;
+    case CS_INTEGER_CODECS:
+      MEMSET(cs_integer_codecs_, '\0', sizeof(cs_integer_codecs_));
+      block_info.cs_integer_codec_info_.to_string(cs_integer_codecs_, sizeof(cs_integer_codecs_));
+      cells[i].set_varchar(cs_integer_codecs_);
+      cells[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+      break;
     default:
       ret = OB_ERR_UNEXPECTED;
       SERVER_LOG(WARN, "invalid column id", K(ret), K(col_id));
@@ -296,6 +303,7 @@ void ObAllVirtualTabletCompactionHistory::reset()
   memset(macro_id_list_, 0, sizeof(macro_id_list_));
   memset(comment_, 0, sizeof(comment_));
   memset(other_info_, 0, sizeof(other_info_));
+  memset(cs_integer_codecs_, 0, sizeof(cs_integer_codecs_));
 }
 
 
@@ -64,7 +64,8 @@ public:
     IO_COST_TIME_PERCENTAGE,
     MERGE_REASON,
     BASE_MAJOR_STATUS,
-    CO_MERGE_TYPE
+    CO_MERGE_TYPE,
+    CS_INTEGER_CODECS
   };
   ObAllVirtualTabletCompactionHistory();
   virtual ~ObAllVirtualTabletCompactionHistory();
@@ -89,6 +90,7 @@ private:
   char other_info_[common::OB_COMPACTION_EVENT_STR_LENGTH];
   char comment_[common::OB_COMPACTION_COMMENT_STR_LENGTH];
   char kept_snapshot_info_[common::OB_COMPACTION_INFO_LENGTH];
+  char cs_integer_codecs_[common::OB_COMPACTION_COMMENT_STR_LENGTH];
   compaction::ObSSTableMergeHistory merge_history_;
   compaction::ObIDiagnoseInfoMgr::Iterator major_merge_info_iter_;
   compaction::ObIDiagnoseInfoMgr::Iterator minor_merge_info_iter_;
@@ -10110,7 +10110,8 @@ def_table_schema(
       ('io_cost_time_percentage', 'int'),
       ('merge_reason', 'varchar:OB_MERGE_REASON_STR_LENGTH'),
       ('base_major_status', 'varchar:OB_MERGE_TYPE_STR_LENGTH'),
-      ('co_merge_type', 'varchar:OB_MERGE_TYPE_STR_LENGTH')
+      ('co_merge_type', 'varchar:OB_MERGE_TYPE_STR_LENGTH'),
+      ('cs_integer_codecs', 'varchar:OB_COMPACTION_COMMENT_STR_LENGTH')
   ],
   partition_columns = ['svr_ip', 'svr_port'],
   vtable_route_policy = 'distributed',
@@ -12520,6 +12521,10 @@ def_table_schema(
     ('unsubmitted_lsn', 'uint'),
     ('unsubmitted_log_scn', 'uint'),
     ('pending_cnt', 'int'),
+    ('replay_lag', 'int'),
+    ('active_queue_cnt', 'int'),
+    ('worker_usage', 'int'),
+    ('replay_worker_cnt', 'int'),
   ],
 
   partition_columns = ['svr_ip', 'svr_port'],
@@ -17,6 +17,7 @@
 #include "share/config/ob_server_config.h"
 #include "share/io/ob_io_manager.h"
 #include "share/ob_local_device.h"
+#include "share/ob_local_io_uring_device.h"
 #include "deps/oblib/src/lib/thread/thread.h"
 #ifdef OB_BUILD_SHARED_STORAGE
 #include "storage/shared_storage/ob_local_cache_device.h"
@@ -139,8 +140,22 @@ int parse_storage_info(common::ObString storage_type_prefix, ObIODevice*& device
 
   if (storage_type_prefix.prefix_match(OB_LOCAL_PREFIX)) {
     device_type = OB_STORAGE_LOCAL;
-    mem = allocator.alloc(sizeof(share::ObLocalDevice));
-    if (NULL != mem) {new(mem)share::ObLocalDevice();}
+    const bool enable_io_uring = GCONF._enable_io_uring;
+    if (enable_io_uring && !share::ObLocalIOUringDevice::is_supported()) {
+      OB_LOG(WARN, "io_uring is not usable on this host, fall back to libaio local device");
+    }
+    if (enable_io_uring && share::ObLocalIOUringDevice::is_supported()) {
+      mem = allocator.alloc(sizeof(share::ObLocalIOUringDevice));
+      if (NULL != mem) {
+        const bool use_sqpoll = GCONF._enable_io_uring_sqpoll;
+        share::ObLocalIOUringDevice *uring_device = new(mem)share::ObLocalIOUringDevice();
+        uring_device->set_use_sqpoll(use_sqpoll);
+        OB_LOG(INFO, "use io_uring for local device", K(use_sqpoll));
+      }
+    } else {
+      mem = allocator.alloc(sizeof(share::ObLocalDevice));
+      if (NULL != mem) {new(mem)share::ObLocalDevice();}
+    }
 #ifdef OB_BUILD_SHARED_STORAGE
   } else if (storage_type_prefix.prefix_match(OB_LOCAL_CACHE_PREFIX)) {
     device_type = OB_STORAGE_LOCAL_CACHE;
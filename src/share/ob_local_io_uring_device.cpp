@@ -0,0 +1,665 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+#include "share/ob_local_io_uring_device.h"
+#include "share/ob_io_device_helper.h"
+#include "lib/thread/thread.h"
+
+// io_uring_getevents_arg is required to wait completions with timeout, it's available
+// since linux 5.11. The device is compiled as not supported with older kernel headers.
+#ifdef IORING_FEAT_EXT_ARG
+#define OB_HAS_IO_URING 1
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+#endif
+
+using namespace oceanbase::common;
+
+namespace oceanbase {
+namespace share {
+
+#ifdef OB_HAS_IO_URING
+static inline int sys_io_uring_setup(const unsigned entries, struct io_uring_params *params)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+static inline int sys_io_uring_enter(const int fd, const unsigned to_submit, const unsigned min_complete,
+                                     const unsigned flags, void *arg, const size_t arg_size)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, arg_size));
+}
+
+static inline int sys_io_uring_register(const int fd, const unsigned opcode, const void *arg,
+                                        const unsigned nr_args)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+#endif
+
+/**
+ * ---------------------------------------------ObLocalIOUringEvents---------------------------------------------------
+ */
+int ObLocalIOUringEvents::get_ith_ret_code(const int64_t i) const
+{
+  int ret_code = -1;
+  if (nullptr != io_events_ && i < complete_io_cnt_) {
+    ret_code = io_events_[i].res_ >= 0 ? 0 : -io_events_[i].res_;
+  } else {
+    SHARE_LOG_RET(WARN, ret_code, "invalid member", KP(io_events_), K(i), K(complete_io_cnt_));
+  }
+  return ret_code;
+}
+
+int ObLocalIOUringEvents::get_ith_ret_bytes(const int64_t i) const
+{
+  int ret_val = 0;
+  if (nullptr != io_events_ && i < complete_io_cnt_) {
+    ret_val = io_events_[i].res_ >= 0 ? io_events_[i].res_ : 0;
+  }
+  return ret_val;
+}
+
+void *ObLocalIOUringEvents::get_ith_data(const int64_t i) const
+{
+  return (nullptr != io_events_ && i < complete_io_cnt_) ? io_events_[i].data_ : nullptr;
+}
+
+/**
+ * ---------------------------------------------ObIOUring---------------------------------------------------
+ */
+ObIOUring::ObIOUring()
+  : ring_fd_(-1),
+    sq_entries_(0),
+    cq_entries_(0),
+    use_sqpoll_(false),
+    fixed_fd_(-1),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_ring_mask_(nullptr),
+    sq_flags_(nullptr),
+    sq_array_(nullptr),
+    sqes_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_ring_mask_(nullptr),
+    cqes_(nullptr),
+    sq_ptr_(nullptr),
+    cq_ptr_(nullptr),
+    sq_map_size_(0),
+    cq_map_size_(0),
+    sqes_map_size_(0),
+    submit_lock_()
+{
+}
+
+int ObIOUring::init(const uint32_t entries, const bool use_sqpoll, const int fixed_fd)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  struct io_uring_params params;
+  MEMSET(&params, 0, sizeof(params));
+  if (use_sqpoll) {
+    params.flags |= IORING_SETUP_SQPOLL;
+    params.sq_thread_idle = SQPOLL_IDLE_MS;
+  }
+  if (OB_UNLIKELY(ring_fd_ >= 0)) {
+    ret = OB_INIT_TWICE;
+    SHARE_LOG(WARN, "io uring has been inited", K(ret), KPC(this));
+  } else if ((ring_fd_ = sys_io_uring_setup(entries, &params)) < 0) {
+    ret = ObIODeviceLocalFileOp::convert_sys_errno();
+    SHARE_LOG(WARN, "Fail to setup io uring, ", K(ret), K(entries), K(use_sqpoll), KERRMSG);
+  } else if (OB_UNLIKELY(0 == (params.features & IORING_FEAT_EXT_ARG))) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "io uring without IORING_FEAT_EXT_ARG is not supported", K(ret), K(params.features));
+  } else if (OB_FAIL(mmap_rings(&params))) {
+    SHARE_LOG(WARN, "Fail to mmap io uring", K(ret), K(ring_fd_));
+  } else {
+    use_sqpoll_ = use_sqpoll;
+    // fixed file only saves the per io fd lookup, the ring still works without it.
+    if (fixed_fd > 0) {
+      if (sys_io_uring_register(ring_fd_, IORING_REGISTER_FILES, &fixed_fd, 1) < 0) {
+        SHARE_LOG(WARN, "Fail to register fixed file, ignore", K(fixed_fd), KERRMSG);
+      } else {
+        fixed_fd_ = fixed_fd;
+      }
+    }
+    SHARE_LOG(INFO, "succeed to init io uring", KPC(this));
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  }
+#else
+  UNUSEDx(entries, use_sqpoll, fixed_fd);
+  ret = OB_NOT_SUPPORTED;
+  SHARE_LOG(WARN, "io uring is not supported by the kernel headers of this build", K(ret));
+#endif
+  return ret;
+}
+
+int ObIOUring::mmap_rings(void *params)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  struct io_uring_params &p = *static_cast<struct io_uring_params *>(params);
+  const bool single_mmap = 0 != (p.features & IORING_FEAT_SINGLE_MMAP);
+  sq_map_size_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  cq_map_size_ = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  sqes_map_size_ = p.sq_entries * sizeof(struct io_uring_sqe);
+  if (single_mmap) {
+    sq_map_size_ = cq_map_size_ = MAX(sq_map_size_, cq_map_size_);
+  }
+  if (MAP_FAILED == (sq_ptr_ = ::mmap(nullptr, sq_map_size_, PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING))) {
+    sq_ptr_ = nullptr;
+    ret = ObIODeviceLocalFileOp::convert_sys_errno();
+    SHARE_LOG(WARN, "Fail to mmap sq ring", K(ret), K(sq_map_size_), KERRMSG);
+  } else if (single_mmap) {
+    cq_ptr_ = sq_ptr_;
+  } else if (MAP_FAILED == (cq_ptr_ = ::mmap(nullptr, cq_map_size_, PROT_READ | PROT_WRITE,
+                                             MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING))) {
+    cq_ptr_ = nullptr;
+    ret = ObIODeviceLocalFileOp::convert_sys_errno();
+    SHARE_LOG(WARN, "Fail to mmap cq ring", K(ret), K(cq_map_size_), KERRMSG);
+  }
+  if (OB_FAIL(ret)) {
+  } else if (MAP_FAILED == (sqes_ = ::mmap(nullptr, sqes_map_size_, PROT_READ | PROT_WRITE,
+                                           MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES))) {
+    sqes_ = nullptr;
+    ret = ObIODeviceLocalFileOp::convert_sys_errno();
+    SHARE_LOG(WARN, "Fail to mmap sqes", K(ret), K(sqes_map_size_), KERRMSG);
+  } else {
+    char *sq = static_cast<char *>(sq_ptr_);
+    char *cq = static_cast<char *>(cq_ptr_);
+    sq_head_ = reinterpret_cast<unsigned *>(sq + p.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq + p.sq_off.tail);
+    sq_ring_mask_ = reinterpret_cast<unsigned *>(sq + p.sq_off.ring_mask);
+    sq_flags_ = reinterpret_cast<unsigned *>(sq + p.sq_off.flags);
+    sq_array_ = reinterpret_cast<unsigned *>(sq + p.sq_off.array);
+    cq_head_ = reinterpret_cast<unsigned *>(cq + p.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq + p.cq_off.tail);
+    cq_ring_mask_ = reinterpret_cast<unsigned *>(cq + p.cq_off.ring_mask);
+    cqes_ = cq + p.cq_off.cqes;
+    sq_entries_ = p.sq_entries;
+    cq_entries_ = p.cq_entries;
+  }
+#else
+  UNUSED(params);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+void ObIOUring::destroy()
+{
+  if (nullptr != sqes_) {
+    ::munmap(sqes_, sqes_map_size_);
+  }
+  if (nullptr != cq_ptr_ && cq_ptr_ != sq_ptr_) {
+    ::munmap(cq_ptr_, cq_map_size_);
+  }
+  if (nullptr != sq_ptr_) {
+    ::munmap(sq_ptr_, sq_map_size_);
+  }
+  if (ring_fd_ >= 0) {
+    ::close(ring_fd_);
+  }
+  ring_fd_ = -1;
+  sq_entries_ = 0;
+  cq_entries_ = 0;
+  use_sqpoll_ = false;
+  fixed_fd_ = -1;
+  sq_head_ = nullptr;
+  sq_tail_ = nullptr;
+  sq_ring_mask_ = nullptr;
+  sq_flags_ = nullptr;
+  sq_array_ = nullptr;
+  sqes_ = nullptr;
+  cq_head_ = nullptr;
+  cq_tail_ = nullptr;
+  cq_ring_mask_ = nullptr;
+  cqes_ = nullptr;
+  sq_ptr_ = nullptr;
+  cq_ptr_ = nullptr;
+  sq_map_size_ = 0;
+  cq_map_size_ = 0;
+  sqes_map_size_ = 0;
+}
+
+int ObIOUring::submit(const ObLocalIOUringIOCB &iocb)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  ObSpinLockGuard guard(submit_lock_);
+  // only the submitter moves sq tail, the kernel moves sq head
+  const unsigned tail = OB_LIKELY(ring_fd_ >= 0) ? *sq_tail_ : 0;
+  const unsigned head = OB_LIKELY(ring_fd_ >= 0) ? __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) : 0;
+  if (OB_UNLIKELY(ring_fd_ < 0)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "io uring not init", K(ret));
+  } else if (tail - head >= sq_entries_) {
+    ret = OB_EAGAIN;
+    SHARE_LOG(DEBUG, "io uring submission queue is full", K(ret), K(head), K(tail), KPC(this));
+  } else {
+    const unsigned idx = tail & *sq_ring_mask_;
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(sqes_) + idx;
+    MEMSET(sqe, 0, sizeof(*sqe));
+    sqe->opcode = iocb.is_write_ ? IORING_OP_WRITE : IORING_OP_READ;
+    if (fixed_fd_ >= 0 && iocb.fd_ == fixed_fd_) {
+      sqe->fd = 0; // index in the registered files
+      sqe->flags |= IOSQE_FIXED_FILE;
+    } else {
+      sqe->fd = iocb.fd_;
+    }
+    sqe->addr = reinterpret_cast<uint64_t>(iocb.buf_);
+    sqe->len = iocb.size_;
+    sqe->off = iocb.offset_;
+    sqe->user_data = reinterpret_cast<uint64_t>(iocb.data_);
+    sq_array_[idx] = idx;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    if (use_sqpoll_) {
+      // the poller thread consumes the entry, wake it up if it has gone idle
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+      if (0 != (__atomic_load_n(sq_flags_, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP)
+          && sys_io_uring_enter(ring_fd_, 0, 0, IORING_ENTER_SQ_WAKEUP, nullptr, 0) < 0) {
+        SHARE_LOG(WARN, "Fail to wake up sq poller", K(ring_fd_), KERRMSG);
+      }
+    } else {
+      int sys_ret = 0;
+      while ((sys_ret = sys_io_uring_enter(ring_fd_, 1, 0, 0, nullptr, 0)) < 0 && EINTR == errno);
+      if (sys_ret < 0) {
+        ret = ObIODeviceLocalFileOp::convert_sys_errno();
+        if (__atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == tail) {
+          // not consumed by the kernel, take it back so that the caller can retry
+          __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+          SHARE_LOG(WARN, "Fail to submit io uring, ", K(ret), K(sys_ret), KERRMSG);
+        } else {
+          ret = OB_SUCCESS;
+        }
+      }
+    }
+  }
+#else
+  UNUSED(iocb);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+int ObIOUring::get_events(const int64_t min_nr, const struct timespec *timeout, ObLocalIOUringEvents &events)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  // only the reaper moves cq head, the kernel moves cq tail
+  const unsigned head = OB_LIKELY(ring_fd_ >= 0) ? *cq_head_ : 0;
+  unsigned tail = OB_LIKELY(ring_fd_ >= 0) ? __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE) : 0;
+  events.complete_io_cnt_ = 0;
+  if (OB_UNLIKELY(ring_fd_ < 0)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "io uring not init", K(ret));
+  } else if (static_cast<int64_t>(tail - head) < min_nr) {
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    MEMSET(&arg, 0, sizeof(arg));
+    if (nullptr != timeout) {
+      ts.tv_sec = timeout->tv_sec;
+      ts.tv_nsec = timeout->tv_nsec;
+      arg.ts = reinterpret_cast<uint64_t>(&ts);
+    }
+    const unsigned flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+    if (sys_io_uring_enter(ring_fd_, 0, static_cast<unsigned>(min_nr), flags, &arg, sizeof(arg)) < 0
+        && ETIME != errno && EINTR != errno) {
+      ret = ObIODeviceLocalFileOp::convert_sys_errno();
+      SHARE_LOG(WARN, "Fail to wait io uring completions, ", K(ret), K(min_nr), KERRMSG);
+    } else {
+      tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    }
+  }
+  if (OB_SUCC(ret)) {
+    const int64_t cnt = MIN(static_cast<int64_t>(tail - head), events.max_event_cnt_);
+    const struct io_uring_cqe *cqes = static_cast<const struct io_uring_cqe *>(cqes_);
+    for (int64_t i = 0; i < cnt; ++i) {
+      const struct io_uring_cqe &cqe = cqes[(head + i) & *cq_ring_mask_];
+      events.io_events_[i].data_ = reinterpret_cast<void *>(cqe.user_data);
+      events.io_events_[i].res_ = cqe.res;
+    }
+    __atomic_store_n(cq_head_, head + static_cast<unsigned>(cnt), __ATOMIC_RELEASE);
+    events.complete_io_cnt_ = cnt;
+  }
+#else
+  UNUSEDx(min_nr, timeout, events);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+/**
+ * ---------------------------------------------ObLocalIOUringDevice---------------------------------------------------
+ */
+ObLocalIOUringDevice::ObLocalIOUringDevice()
+  : ObLocalDevice(),
+    use_sqpoll_(false),
+    uring_iocb_pool_()
+{
+}
+
+ObLocalIOUringDevice::~ObLocalIOUringDevice()
+{
+  destroy();
+}
+
+bool ObLocalIOUringDevice::is_supported()
+{
+  // the build has io_uring headers doesn't mean the running kernel has it, io_uring may also be
+  // disabled by sysctl kernel.io_uring_disabled or filtered by seccomp in containers. Probe with
+  // a real ring once, the result never changes during the process lifetime.
+  static const bool supported = probe_io_uring();
+  return supported;
+}
+
+bool ObLocalIOUringDevice::probe_io_uring()
+{
+  bool bret = false;
+#ifdef OB_HAS_IO_URING
+  struct io_uring_params params;
+  MEMSET(&params, 0, sizeof(params));
+  const int ring_fd = sys_io_uring_setup(1, &params);
+  if (ring_fd < 0) {
+    SHARE_LOG(WARN, "io_uring_setup failed, io uring is not supported by the kernel", K(errno), KERRMSG);
+  } else {
+    if (0 == (params.features & IORING_FEAT_EXT_ARG)) {
+      SHARE_LOG(WARN, "io uring of the kernel can not wait completions with timeout",
+                K(params.features));
+    } else {
+      bret = true;
+    }
+    ::close(ring_fd);
+  }
+#else
+  SHARE_LOG(WARN, "io uring is not supported by the kernel headers of this build");
+#endif
+  return bret;
+}
+
+int ObLocalIOUringDevice::init(const common::ObIODOpts &opts)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_supported())) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "io uring is not supported", K(ret));
+  } else if (OB_FAIL(ObLocalDevice::init(opts))) {
+    SHARE_LOG(WARN, "Fail to init local device", K(ret));
+  } else if (OB_FAIL(uring_iocb_pool_.init(allocator_, DEFUALT_PRE_ALLOCATED_IOCB_COUNT))) {
+    SHARE_LOG(WARN, "Fail to init io uring iocb pool", K(ret));
+    destroy();
+  }
+  return ret;
+}
+
+void ObLocalIOUringDevice::destroy()
+{
+  // iocb pool memory belongs to allocator_, which is destroyed by ObLocalDevice::destroy
+  uring_iocb_pool_.reset();
+  ObLocalDevice::destroy();
+}
+
+int ObLocalIOUringDevice::io_setup(
+    uint32_t max_events,
+    common::ObIOContext *&io_context)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  ObLocalIOUringContext *uring_context = nullptr;
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The ObLocalIOUringDevice has not been inited, ", K(ret));
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObLocalIOUringContext)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SHARE_LOG(WARN, "Fail to allocate memory, ", K(ret));
+  } else if (FALSE_IT(uring_context = new (buf) ObLocalIOUringContext())) {
+  } else if (OB_FAIL(uring_context->ring_.init(max_events, use_sqpoll_, block_fd_))) {
+    SHARE_LOG(WARN, "Fail to setup io uring context, ", K(ret), K(max_events), K(use_sqpoll_));
+  } else {
+    io_context = uring_context;
+  }
+
+  if (OB_FAIL(ret) && nullptr != uring_context) {
+    uring_context->~ObLocalIOUringContext();
+    allocator_.free(buf);
+  }
+  return ret;
+}
+
+int ObLocalIOUringDevice::io_destroy(common::ObIOContext *io_context)
+{
+  int ret = OB_SUCCESS;
+  ObLocalIOUringContext *uring_context = nullptr;
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The ObLocalIOUringDevice has not been inited, ", K(ret));
+  } else if (OB_ISNULL(io_context)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", KP(io_context));
+  } else if (OB_UNLIKELY(ObIOContextType::IO_CONTEXT_TYPE_LOCAL_URING != io_context->get_type())) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid io context pointer", K(ret), KP(io_context),
+              "io_context_type", io_context->get_type());
+  } else {
+    uring_context = static_cast<ObLocalIOUringContext *>(io_context);
+    uring_context->~ObLocalIOUringContext();
+    allocator_.free(uring_context);
+  }
+  return ret;
+}
+
+int ObLocalIOUringDevice::io_prepare(
+    const bool is_write,
+    const ObIOFd &fd,
+    void *buf,
+    size_t count,
+    int64_t offset,
+    ObIOCB *iocb,
+    void *callback)
+{
+  int ret = OB_SUCCESS;
+  ObLocalIOUringIOCB *uring_iocb = nullptr;
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The ObLocalIOUringDevice has not been inited, ", K(ret));
+  } else if (OB_ISNULL(buf) || OB_ISNULL(iocb)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", K(ret), KP(buf), KP(iocb));
+  } else if (OB_UNLIKELY(ObIOCBType::IOCB_TYPE_LOCAL_URING != iocb->get_type())) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid iocb pointer", K(ret), KP(iocb), "iocb_type", iocb->get_type());
+  } else if (OB_UNLIKELY(fd.is_super_block())) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "server entry doesn't support AIO", K(ret), K(fd));
+  } else {
+    uring_iocb = static_cast<ObLocalIOUringIOCB *>(iocb);
+    uring_iocb->is_write_ = is_write;
+    uring_iocb->buf_ = buf;
+    uring_iocb->size_ = static_cast<uint32_t>(count);
+    uring_iocb->data_ = callback;
+    if (fd.is_block_file()) {
+      uring_iocb->fd_ = block_fd_;
+      uring_iocb->offset_ = get_block_file_offset(fd, offset);
+    } else {
+      uring_iocb->fd_ = static_cast<int32_t>(fd.second_id_);
+      uring_iocb->offset_ = offset;
+    }
+  }
+  return ret;
+}
+
+int ObLocalIOUringDevice::io_prepare_pwrite(
+    const ObIOFd &fd,
+    void *buf,
+    size_t count,
+    int64_t offset,
+    ObIOCB *iocb,
+    void *callback)
+{
+  return io_prepare(true/*is_write*/, fd, buf, count, offset, iocb, callback);
+}
+
+int ObLocalIOUringDevice::io_prepare_pread(
+    const ObIOFd &fd,
+    void *buf,
+    size_t count,
+    int64_t offset,
+    ObIOCB *iocb,
+    void *callback)
+{
+  return io_prepare(false/*is_write*/, fd, buf, count, offset, iocb, callback);
+}
+
+int ObLocalIOUringDevice::io_submit(
+    common::ObIOContext *io_context,
+    common::ObIOCB *iocb)
+{
+  int ret = OB_SUCCESS;
+  ObTimeGuard time_guard("LocalIOUringDevice", 5000); //5ms
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The ObLocalIOUringDevice has not been inited, ", K(ret));
+  } else if (OB_ISNULL(io_context) || OB_ISNULL(iocb)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", KP(io_context), KP(iocb));
+  } else if (OB_UNLIKELY((ObIOContextType::IO_CONTEXT_TYPE_LOCAL_URING != io_context->get_type())
+                         || (ObIOCBType::IOCB_TYPE_LOCAL_URING != iocb->get_type()))) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid io_context or iocb pointer", K(ret), KP(io_context), "io_context_type",
+             io_context->get_type(), KP(iocb), "iocb_type", iocb->get_type());
+  } else if (OB_FAIL(static_cast<ObLocalIOUringContext *>(io_context)->ring_.submit(
+                     *static_cast<ObLocalIOUringIOCB *>(iocb)))) {
+    SHARE_LOG(WARN, "Fail to submit io uring, ", K(ret), KPC(static_cast<ObLocalIOUringIOCB *>(iocb)));
+  }
+  time_guard.click("LocalIOUringDevice_submit");
+  return ret;
+}
+
+int ObLocalIOUringDevice::io_cancel(
+    common::ObIOContext *io_context,
+    common::ObIOCB *iocb)
+{
+  // IORING_OP_ASYNC_CANCEL is asynchronous, the cancelled request still completes with
+  // -ECANCELED through the completion queue, so it's handled as not supported like
+  // a kernel without io_cancel.
+  UNUSEDx(io_context, iocb);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObLocalIOUringDevice::io_getevents(
+    common::ObIOContext *io_context,
+    int64_t min_nr,
+    common::ObIOEvents *events,
+    struct timespec *timeout)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The ObLocalIOUringDevice has not been inited, ", K(ret));
+  } else if (OB_ISNULL(io_context) || OB_ISNULL(events)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", KP(io_context), KP(events));
+  } else if (OB_UNLIKELY((ObIOContextType::IO_CONTEXT_TYPE_LOCAL_URING != io_context->get_type())
+                         || (ObIOEventsType::IO_EVENTS_TYPE_LOCAL_URING != events->get_type()))) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid io_context or io_events pointer", K(ret), KP(io_context),
+      "io_context_type", io_context->get_type(), KP(events), "io_events_type", events->get_type());
+  } else {
+    oceanbase::lib::Thread::WaitGuard guard(oceanbase::lib::Thread::WAIT_FOR_IO_EVENT);
+    if (OB_FAIL(static_cast<ObLocalIOUringContext *>(io_context)->ring_.get_events(
+                min_nr, timeout, *static_cast<ObLocalIOUringEvents *>(events)))) {
+      SHARE_LOG(WARN, "Fail to get io uring events, ", K(ret), K(min_nr));
+    }
+  }
+  return ret;
+}
+
+common::ObIOCB *ObLocalIOUringDevice::alloc_iocb(const uint64_t tenant_id)
+{
+  UNUSED(tenant_id);
+  ObLocalIOUringIOCB *iocb = nullptr;
+  ObLocalIOUringIOCB *buf = nullptr;
+  if (OB_LIKELY(is_inited_)) {
+    if (NULL != (buf = uring_iocb_pool_.alloc())) {
+      iocb = new (buf) ObLocalIOUringIOCB();
+    }
+  }
+  return iocb;
+}
+
+common::ObIOEvents *ObLocalIOUringDevice::alloc_io_events(const uint32_t max_events)
+{
+  ObLocalIOUringEvents *io_events = nullptr;
+  char *buf = nullptr;
+  int64_t size = 0;
+
+  if (OB_LIKELY(is_inited_)) {
+    size = sizeof(ObLocalIOUringEvents) + max_events * sizeof(ObIOUringEvent);
+    if (NULL != (buf = (char*) allocator_.alloc(size))) {
+      MEMSET(buf, 0, size);
+      io_events = new (buf) ObLocalIOUringEvents();
+      io_events->max_event_cnt_ = max_events;
+      io_events->complete_io_cnt_ = 0;
+      io_events->io_events_ = reinterpret_cast<ObIOUringEvent *> (buf + sizeof(ObLocalIOUringEvents));
+    }
+  }
+  return io_events;
+}
+
+void ObLocalIOUringDevice::free_iocb(common::ObIOCB *iocb)
+{
+  int ret = OB_SUCCESS;
+  if (OB_LIKELY(is_inited_)) {
+    if (OB_ISNULL(iocb) || OB_UNLIKELY(ObIOCBType::IOCB_TYPE_LOCAL_URING != iocb->get_type())) {
+      ret = OB_INVALID_ARGUMENT;
+      SHARE_LOG(WARN, "Invalid iocb pointer", K(ret), KP(iocb));
+    } else {
+      ObLocalIOUringIOCB *uring_iocb = static_cast<ObLocalIOUringIOCB *>(iocb);
+      uring_iocb->~ObLocalIOUringIOCB();
+      uring_iocb_pool_.free(uring_iocb);
+    }
+  }
+}
+
+void ObLocalIOUringDevice::free_io_events(common::ObIOEvents *io_event)
+{
+  if (OB_LIKELY(is_inited_)) {
+    allocator_.free(io_event);
+  }
+}
+
+} /* namespace share */
+} /* namespace oceanbase */
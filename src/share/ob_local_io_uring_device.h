@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef SRC_SHARE_OB_LOCAL_IO_URING_DEVICE_H_
+#define SRC_SHARE_OB_LOCAL_IO_URING_DEVICE_H_
+
+#include "lib/lock/ob_spin_lock.h"
+#include "share/ob_local_device.h"
+
+namespace oceanbase {
+namespace share {
+
+class ObLocalIOUringDevice;
+
+// prepared request, copied into a submission queue entry when submitted
+class ObLocalIOUringIOCB : public common::ObIOCB
+{
+public:
+  ObLocalIOUringIOCB() : is_write_(false), fd_(-1), buf_(nullptr), size_(0), offset_(0), data_(nullptr) {}
+  virtual ~ObLocalIOUringIOCB() {}
+  virtual ObIOCBType get_type() const override
+  {
+    return ObIOCBType::IOCB_TYPE_LOCAL_URING;
+  }
+  TO_STRING_KV(K_(is_write), K_(fd), KP_(buf), K_(size), K_(offset), KP_(data));
+private:
+  friend class ObLocalIOUringDevice;
+  friend class ObIOUring;
+  bool is_write_;
+  int32_t fd_;
+  void *buf_;
+  uint32_t size_;
+  int64_t offset_;
+  void *data_;
+};
+
+struct ObIOUringEvent
+{
+  void *data_;
+  int32_t res_;
+};
+
+class ObLocalIOUringEvents : public common::ObIOEvents
+{
+public:
+  ObLocalIOUringEvents() : complete_io_cnt_(0), io_events_(nullptr) {}
+  virtual ~ObLocalIOUringEvents() {}
+  virtual ObIOEventsType get_type() const override
+  {
+    return ObIOEventsType::IO_EVENTS_TYPE_LOCAL_URING;
+  }
+  virtual int64_t get_complete_cnt() const override { return complete_io_cnt_; }
+  virtual int get_ith_ret_code(const int64_t i) const override;
+  virtual int get_ith_ret_bytes(const int64_t i) const override;
+  virtual void *get_ith_data(const int64_t i) const override;
+private:
+  friend class ObLocalIOUringDevice;
+  friend class ObIOUring;
+  int64_t complete_io_cnt_;
+  ObIOUringEvent *io_events_;
+};
+
+// One io_uring instance, used as the io context of one ObAsyncIOChannel.
+// Several sender threads may submit to the same channel, so the submission queue is
+// protected by a spin lock, while the completion queue is only reaped by the channel's
+// get_events thread.
+class ObIOUring
+{
+public:
+  ObIOUring();
+  ~ObIOUring() { destroy(); }
+  int init(const uint32_t entries, const bool use_sqpoll, const int fixed_fd);
+  void destroy();
+  int submit(const ObLocalIOUringIOCB &iocb);
+  int get_events(const int64_t min_nr, const struct timespec *timeout, ObLocalIOUringEvents &events);
+  TO_STRING_KV(K_(ring_fd), K_(sq_entries), K_(cq_entries), K_(use_sqpoll), K_(fixed_fd));
+private:
+  int mmap_rings(void *params);
+private:
+  static const uint32_t SQPOLL_IDLE_MS = 10;
+  int ring_fd_;
+  uint32_t sq_entries_;
+  uint32_t cq_entries_;
+  bool use_sqpoll_;
+  // the block file is registered as the only fixed file of the ring
+  int fixed_fd_;
+  unsigned *sq_head_;
+  unsigned *sq_tail_;
+  unsigned *sq_ring_mask_;
+  unsigned *sq_flags_;
+  unsigned *sq_array_;
+  void *sqes_;
+  unsigned *cq_head_;
+  unsigned *cq_tail_;
+  unsigned *cq_ring_mask_;
+  void *cqes_;
+  void *sq_ptr_;
+  void *cq_ptr_;
+  int64_t sq_map_size_;
+  int64_t cq_map_size_;
+  int64_t sqes_map_size_;
+  common::ObSpinLock submit_lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObIOUring);
+};
+
+class ObLocalIOUringContext : public common::ObIOContext
+{
+public:
+  ObLocalIOUringContext() : ring_() {}
+  virtual ~ObLocalIOUringContext() {}
+  virtual ObIOContextType get_type() const override
+  {
+    return ObIOContextType::IO_CONTEXT_TYPE_LOCAL_URING;
+  }
+private:
+  friend class ObLocalIOUringDevice;
+  ObIOUring ring_;
+};
+
+// Local device whose async io goes through io_uring instead of libaio, everything else
+// (block file management, sync io, file/dir interfaces) is inherited from ObLocalDevice.
+// The block file is registered as fixed file of each ring.
+class ObLocalIOUringDevice : public ObLocalDevice {
+public:
+  ObLocalIOUringDevice();
+  virtual ~ObLocalIOUringDevice();
+  virtual int init(const common::ObIODOpts &opts) override;
+  virtual void destroy() override;
+
+  void set_use_sqpoll(const bool use_sqpoll) { use_sqpoll_ = use_sqpoll; }
+  // whether io_uring can be used by this process, probed by a real io_uring_setup
+  static bool is_supported();
+
+  //async io interfaces
+  virtual int io_setup(
+    uint32_t max_events,
+    common::ObIOContext *&io_context) override;
+  virtual int io_destroy(common::ObIOContext *io_context) override;
+  virtual int io_prepare_pwrite(
+    const common::ObIOFd &fd,
+    void *buf,
+    size_t count,
+    int64_t offset,
+    common::ObIOCB *iocb,
+    void *callback) override;
+  virtual int io_prepare_pread(
+    const common::ObIOFd &fd,
+    void *buf,
+    size_t count,
+    int64_t offset,
+    common::ObIOCB *iocb,
+    void *callback) override;
+  virtual int io_submit(
+    common::ObIOContext *io_context,
+    common::ObIOCB *iocb) override;
+  virtual int io_cancel(
+    common::ObIOContext *io_context,
+    common::ObIOCB *iocb) override;
+  virtual int io_getevents(
+    common::ObIOContext *io_context,
+    int64_t min_nr,
+    common::ObIOEvents *events,
+    struct timespec *timeout) override;
+  virtual common::ObIOCB *alloc_iocb(const uint64_t tenant_id) override;
+  virtual common::ObIOEvents *alloc_io_events(const uint32_t max_events) override;
+  virtual void free_iocb(common::ObIOCB *iocb) override;
+  virtual void free_io_events(common::ObIOEvents *io_event) override;
+
+private:
+  static bool probe_io_uring();
+  int io_prepare(const bool is_write, const common::ObIOFd &fd, void *buf, size_t count,
+                 int64_t offset, common::ObIOCB *iocb, void *callback);
+
+private:
+  bool use_sqpoll_;
+  ObIOCBPool<ObLocalIOUringIOCB> uring_iocb_pool_;
+};
+
+} /* namespace share */
+} /* namespace oceanbase */
+
+#endif /* SRC_SHARE_OB_LOCAL_IO_URING_DEVICE_H_ */
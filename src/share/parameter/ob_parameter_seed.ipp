@@ -263,6 +263,10 @@ DEF_CAP(kv_transport_compress_threshold, OB_TENANT_PARAMETER, "10K","[0B,]",
 DEF_CAP(_sort_area_size, OB_TENANT_PARAMETER, "32M", "[2M,]",
         "size of maximum memory that could be used by SORT. Range: [2M,+∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_sort_inmem_parallel_degree, OB_TENANT_PARAMETER, "1", "[1,64]",
+        "the max number of threads used to sort in-memory rows of a SORT operator which is "
+        "not executed by PX workers, 1 means disable parallel in-memory sort. Range: [1,64]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(_hash_area_size, OB_TENANT_PARAMETER, "32M", "[4M,]",
         "size of maximum memory that could be used by HASH JOIN. Range: [4M,+∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -484,6 +488,14 @@ DEF_BOOL(_px_message_compression, OB_TENANT_PARAMETER, "True",
         "Enable DTL send message with compression"
         "Value: True: enable compression False: disable compression",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_px_vector_wire_encoding, OB_TENANT_PARAMETER, "False",
+        "Enable DTL rpc channel to encode fixed length vectors with lightweight columnar codecs"
+        "Value: True: enable encoding False: disable encoding",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_px_local_columnar_exchange, OB_TENANT_PARAMETER, "False",
+        "Enable local DTL channel to exchange vectorized data in columnar buffers"
+        "Value: True: send columnar buffers False: send row buffers",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_px_chunklist_count_ratio, OB_CLUSTER_PARAMETER, "1", "[1, 128]",
         "the ratio of the dtl buffer manager list. Range: [1, 128]",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -507,6 +519,10 @@ DEF_INT(_enable_hash_join_processor, OB_TENANT_PARAMETER, "7", "[1, 7]",
          "which path to process for hash join, default 7 to auto choose "
          "1: nest loop, 2: recursive, 4: in-memory",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_hash_group_join, OB_TENANT_PARAMETER, "False",
+         "enable fusing hash group by into the inner hash join below it when the group exprs "
+         "are the unique build side join keys. Value:  True:turned on  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_pushdown_storage_level, OB_TENANT_PARAMETER, "4", "[0, 4]",
         "the level of storage pushdown. Range: [0, 4] "
         "0: disabled, 1:blockscan, 2: blockscan & filter, 3: blockscan & filter & aggregate, 4: blockscan & filter & aggregate & group by",
@@ -715,6 +731,11 @@ DEF_INT(_log_writer_parallelism, OB_TENANT_PARAMETER, "3",
        "[1,8]",
        "the number of parallel log writer threads that can be used to write redo log entries to disk. ",
        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_INT(_log_writer_io_depth, OB_TENANT_PARAMETER, "1",
+       "[1,16]",
+       "the max number of redo log writes of different log streams which are in flight at the same time in one log writer, "
+       "1 means writing them one by one. ",
+       ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 DEF_TIME(_ls_gc_wait_readonly_tx_time, OB_TENANT_PARAMETER, "24h",
         "[0s,)",
@@ -733,6 +754,18 @@ DEF_BOOL(_enable_log_cache, OB_TENANT_PARAMETER, "True",
          "Value:  True:turned on  False: turned off",
          ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_CAP(_log_batch_push_size_threshold, OB_CLUSTER_PARAMETER, "0B", "[0B, 64K]",
+        "group logs smaller than it are pushed to followers through batch rpc, which coalesces "
+        "push log requests and acks to the same server within an adaptive window. "
+        "0 means only raw write logs and fetched logs are pushed through batch rpc. Range: [0B, 64K]",
+        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_CAP(_log_cache_read_ahead_size, OB_TENANT_PARAMETER, "1M", "[0M, 16M]",
+        "the size of logs read ahead into log kv cache when a sequential reader misses the cache, "
+        "the read-ahead logs are shared by all readers of the same palf. 0 means read-ahead is turned off. "
+        "Range: [0M, 16M]",
+        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 DEF_BOOL(_ob_enable_standby_db_parallel_log_transport, OB_TENANT_PARAMETER, "True",
         "Specifies whether the parallel log transport protocol is enabled on the standby database. "
         "The parallel log transport protocol is enabled only if this parameter is true and "
@@ -1006,6 +1039,16 @@ DEF_INT(sync_io_thread_count, OB_CLUSTER_PARAMETER, "0",
         "[0,1024]",
         "The number of io threads for synchronizing request on each device. The default value is 0. Range: [0,1024] in integer",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring, OB_CLUSTER_PARAMETER, "False",
+         "use io_uring instead of libaio for the asynchronous io of local data device, "
+         "requires linux 5.11 or later. Take effect after restart. "
+         "Value:  True:turned on  False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring_sqpoll, OB_CLUSTER_PARAMETER, "False",
+         "let a kernel thread poll the io_uring submission queue, saving the submit syscall "
+         "at the cost of one polling thread per io channel. Take effect after restart. "
+         "Value:  True:turned on  False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 DEF_INT(_io_callback_thread_count, OB_TENANT_PARAMETER, "0", "[0,64]",
         "The number of io callback threads. The default value is 0. Range: [0,64] in integer. If not specified, The number of threads is dynamically configured according to the memory size",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1567,6 +1610,11 @@ DEF_STR_WITH_CHECKER(_px_bloom_filter_group_size, OB_TENANT_PARAMETER, "auto", c
          "specifies the px bloom filter each group size in sending to the other sqc"
          "Range: [1, +∞) or auto, the default value is auto",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_px_bloom_filter_key_range, OB_TENANT_PARAMETER, "True",
+         "specifies whether the runtime bloom filter carries the min/max of join key, "
+         "which is used by storage to skip blocks through skip index",
+         "Value: True: carry key range False: bloom filter only",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_BOOL(enable_sql_extension, OB_TENANT_PARAMETER, "False",
          "specifies whether to allow use some oracle mode features in mysql mode",
@@ -93,10 +93,10 @@ int build_batch_packet(const ObAddr &sender, const uint32_t batch_type, const ui
   return ret;
 }
 
-int64_t ObRpcBuffer::send(Rpc& rpc, uint64_t tenant_id, const ObAddr &sender, bool send_current)
+int64_t ObRpcBuffer::send(Rpc& rpc, uint64_t tenant_id, const ObAddr &sender, bool send_current, int64_t &req_cnt)
 {
   int64_t seq = -1;
-  int64_t req_cnt = 0;
+  req_cnt = 0;
   char* buf = NULL;
   int64_t size = buffer_.read(seq, buf, req_cnt, send_current);
   if (size > 0) {
@@ -138,6 +138,8 @@ int ObBatchRpcBase::post(const uint64_t tenant_id, const ObAddr &dest, const int
     } else {
       if (OB_FAIL(rpc_->post_batch(tenant_id, new_dest, dst_cluster_id, batch_type, *pkt))) {
         RPC_LOG(WARN, "do_post fail", K(ret));
+      } else {
+        stat_(1, 1);
       }
       if (OB_UNLIKELY(is_dynamic_alloc)) {
         ob_free(pkt);
@@ -244,6 +246,8 @@ int ObBatchRpcBase::post(const uint64_t tenant_id, const ObAddr &dest, const int
     } else {
       if (OB_FAIL(rpc_->post_batch(tenant_id, new_dest, dst_cluster_id, batch_type, *pkt))) {
         RPC_LOG(WARN, "do_post fail", K(ret));
+      } else {
+        stat_(1, 1);
       }
       if (OB_UNLIKELY(is_dynamic_alloc)) {
         ob_free(pkt);
@@ -287,14 +291,19 @@ void ObBatchRpcBase::do_work()
     static const int64_t CLEAN_SVR_INTERVAL = 3600 * 1000 * 1000l;  // clean server when idle time reachs 1h
     bool need_gc = false;
     RpcBuffer* iter = NULL;
+    int64_t round_rpc_cnt = 0;
+    int64_t round_req_cnt = 0;
     while(NULL != (iter = buffer_map_->quick_next(iter))) {
       iter->freeze();
     }
     while(NULL != (iter = buffer_map_->quick_next(iter))) {
       int cnt = 0;
-      while (iter->send(*rpc_, iter->get_tenant_id(), self_, 0 == cnt) > 0) {
+      int64_t req_cnt = 0;
+      while (iter->send(*rpc_, iter->get_tenant_id(), self_, 0 == cnt, req_cnt) > 0) {
         cnt++;
+        round_req_cnt += req_cnt;
       }
+      round_rpc_cnt += cnt;
       if (start_ts - iter->get_last_use_ts() > CLEAN_SVR_INTERVAL
           && iter->is_empty()) {
         need_gc = true;
@@ -323,15 +332,26 @@ void ObBatchRpcBase::do_work()
           // del succ, then wait
           WaitQuiescent(get_qs());
           // send all msg
-          while (cur_buf->send(*rpc_, cur_buf->get_tenant_id(), self_, true) > 0) {
+          int64_t req_cnt = 0;
+          while (cur_buf->send(*rpc_, cur_buf->get_tenant_id(), self_, true, req_cnt) > 0) {
           }
           destroy_buffer(cur_buf);
           RPC_LOG(INFO, "batch_rpc delete server success", K(cur_server), K(cluster_id), K(tenant_id), K(hash_val), K_(batch_type));
         }
       }
     }
+    stat_(round_rpc_cnt, round_req_cnt);
+    adjust_delay_(round_rpc_cnt, round_req_cnt);
     const int64_t cost_time = common::ObTimeUtility::current_time() - start_ts;
-    int64_t sleep_ts = delay_us_ > 0 ? delay_us_ : (10 * 1000);
+    int64_t sleep_ts = (10 * 1000);
+    if (delay_us_ <= 0) {
+    } else if (0 == round_rpc_cnt) {
+      // nothing sent in this round, sleep the configured delay to avoid busy polling
+      // with a shrunk window, the window itself is kept for the next busy round
+      sleep_ts = delay_us_;
+    } else {
+      sleep_ts = curr_delay_us_;
+    }
     sleep_ts -= cost_time;
     if (sleep_ts < 0) {
       sleep_ts = 0;
@@ -344,6 +364,36 @@ void ObBatchRpcBase::do_work()
   }
 }
 
+void ObBatchRpcBase::adjust_delay_(const int64_t round_rpc_cnt, const int64_t round_req_cnt)
+{
+  // Only clog batch window adapts to load. Under light load requests hardly meet each
+  // other in one window, so shrink it to cut latency; under heavy load widen it to coalesce
+  // more requests into one rpc. An idle round says nothing about the load, keep the window.
+  if (CLOG_BATCH_REQ != batch_type_ || delay_us_ <= 0 || 0 == round_rpc_cnt) {
+  } else if (round_req_cnt > round_rpc_cnt * HIGH_REQ_PER_RPC) {
+    curr_delay_us_ = MIN(curr_delay_us_ * 2, delay_us_);
+  } else if (round_req_cnt < round_rpc_cnt * LOW_REQ_PER_RPC) {
+    curr_delay_us_ = MAX(curr_delay_us_ / 2, MIN(MIN_ADAPTIVE_DELAY_US, delay_us_));
+  }
+}
+
+void ObBatchRpcBase::stat_(const int64_t rpc_cnt, const int64_t req_cnt)
+{
+  if (rpc_cnt > 0) {
+    const int64_t total_rpc_cnt = ATOMIC_AAF(&rpc_cnt_, rpc_cnt);
+    const int64_t total_req_cnt = ATOMIC_AAF(&req_cnt_, req_cnt);
+    const int64_t last_stat_ts = ATOMIC_LOAD(&last_stat_ts_);
+    const int64_t now = common::ObClockGenerator::getClock();
+    if (now - last_stat_ts > STAT_INTERVAL_US
+        && ATOMIC_BCAS(&last_stat_ts_, last_stat_ts, now)) {
+      RPC_LOG(INFO, "[BATCH RPC STAT]", K_(batch_type), "rpc_cnt", total_rpc_cnt, "req_cnt", total_req_cnt,
+              "req_per_rpc", total_req_cnt / total_rpc_cnt, K_(delay_us), K_(curr_delay_us));
+      ATOMIC_SAF(&rpc_cnt_, total_rpc_cnt);
+      ATOMIC_SAF(&req_cnt_, total_req_cnt);
+    }
+  }
+}
+
 ObRpcBuffer* ObBatchRpcBase::create_buffer(const uint64_t tenant_id, const ObAddr& addr, const int64_t dst_cluster_id)
 {
   const int64_t alloc_size = get_batch_buffer_size(batch_type_) * BATCH_BUFFER_COUNT;
@@ -255,7 +255,8 @@ public:
     return buffer_.write(batch_type_, sub_type, ls, req);
   }
   void freeze() { buffer_.freeze(); }
-  int64_t send(Rpc& rpc, uint64_t tenant_id, const common::ObAddr &sender, bool send_current);
+  // @return the size of sent packet, req_cnt is the count of requests in it
+  int64_t send(Rpc& rpc, uint64_t tenant_id, const common::ObAddr &sender, bool send_current, int64_t &req_cnt);
   void record_use_time()
   {
     const int64_t now = common::ObClockGenerator::getClock();
@@ -359,7 +360,15 @@ public:
   typedef common::FixedHash2<RpcBuffer> BufferMap;
   typedef SingleWaitCond SendCond;
   static const int64_t SVR_IDLE_TIME_THRESHOLD = 10 * 60 * 1000 * 1000L;  // 10 minutes
-  ObBatchRpcBase(): is_inited_(false), batch_type_(-1), self_(), delay_us_(0), rpc_(nullptr), buffer_map_(nullptr)
+  // the batching window of CLOG_BATCH_REQ adapts to load in [MIN_ADAPTIVE_DELAY_US, delay_us_]
+  static const int64_t MIN_ADAPTIVE_DELAY_US = 50;
+  // shrink the window when rpcs carry less requests than LOW_REQ_PER_RPC on average,
+  // and widen it when they carry more than HIGH_REQ_PER_RPC.
+  static const int64_t LOW_REQ_PER_RPC = 2;
+  static const int64_t HIGH_REQ_PER_RPC = 16;
+  static const int64_t STAT_INTERVAL_US = 10 * 1000 * 1000L;
+  ObBatchRpcBase(): is_inited_(false), batch_type_(-1), self_(), delay_us_(0), curr_delay_us_(0), rpc_(nullptr),
+                    buffer_map_(nullptr), rpc_cnt_(0), req_cnt_(0), last_stat_ts_(0)
   {}
   ~ObBatchRpcBase()
   {
@@ -369,7 +378,8 @@ public:
         RpcBuffer* iter = NULL;
         if (NULL != (iter = buffer_map_->quick_next(iter))) {
           int cnt = 0;
-          while (iter->send(*rpc_, iter->get_tenant_id(), self_, 0 == cnt) > 0) {
+          int64_t req_cnt = 0;
+          while (iter->send(*rpc_, iter->get_tenant_id(), self_, 0 == cnt, req_cnt) > 0) {
             cnt++;
           }
           if (iter->is_empty()) {
@@ -404,6 +414,7 @@ public:
         batch_type_ = CLOG_BATCH_REQ_NODELAY;
       }
       delay_us_ = delay_us;
+      curr_delay_us_ = delay_us;
       self_ = self_addr;
       rpc_ = rpc;
       is_inited_ = true;
@@ -435,14 +446,23 @@ protected:
 private:
   RpcBuffer* create_buffer(const uint64_t tenant_id, const common::ObAddr& addr, const int64_t dst_cluster_id);
   void destroy_buffer(RpcBuffer* p);
+  void adjust_delay_(const int64_t round_rpc_cnt, const int64_t round_req_cnt);
+  void stat_(const int64_t rpc_cnt, const int64_t req_cnt);
 private:
   bool is_inited_;
   int batch_type_;
   common::ObAddr self_;
+  // the max batching window
   int64_t delay_us_;
+  // the current batching window, only modified by the batch thread
+  int64_t curr_delay_us_;
   Rpc* rpc_;
   SendCond cond_;
   BufferMap *buffer_map_;
+  // the count of rpcs and requests sent since last stat
+  int64_t rpc_cnt_;
+  int64_t req_cnt_;
+  int64_t last_stat_ts_;
 };
 
 class ObBatchRpc: public lib::TGRunnable
@@ -2165,7 +2165,7 @@ int ObDagPrioScheduler::schedule_dag_(ObIDag &dag, bool &move_dag_to_waiting_lis
     next_dag_status = ObIDag::DAG_STATUS_NODE_FAILED;
     dag.set_dag_ret(OB_CANCELED);
     LOG_INFO("dag net is cancel", K(dag));
-  } else if (!dag.check_can_schedule()) { // cur dag can't be scheduled now
+  } else if (!dag.check_can_schedule() || !dag.try_admit()) { // cur dag can't be scheduled now
     move_dag_to_waiting_list = true;
   } else { // dag can be scheduled
     if (ObIDag::DAG_STATUS_READY == dag.get_dag_status()) {
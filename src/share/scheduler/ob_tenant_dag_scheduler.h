@@ -450,8 +450,12 @@ public:
   virtual bool check_can_schedule()
   { // true: waiting_list -> ready_list OR ready_list -> start running
     // false: ready_list -> waiting_list
+    // NOTICE: should be side effect free, it's also called when dumping dag info
     return true;
   }
+  // acquire the resource the dag runs with after check_can_schedule passes,
+  // only called right before the dag starts running, dags in ready_list hold nothing
+  virtual bool try_admit() { return true; }
   int add_child(ObIDag &child, const bool check_child_dag_status = true);
   int update_status_in_dag_net(bool &dag_net_finished);
   int finish(const ObDagStatus status, bool &dag_net_finished);
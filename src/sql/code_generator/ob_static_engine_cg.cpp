@@ -15,6 +15,7 @@
 #include "ob_static_engine_cg.h"
 #include "sql/optimizer/ob_logical_operator.h"
 #include "sql/optimizer/ob_log_group_by.h"
+#include "sql/optimizer/ob_log_group_join.h"
 #include "sql/optimizer/ob_log_table_scan.h"
 #include "sql/optimizer/ob_log_sort.h"
 #include "sql/optimizer/ob_log_limit.h"
@@ -104,6 +105,7 @@
 #include "sql/engine/aggregate/ob_scalar_aggregate_op.h"
 #include "sql/engine/aggregate/ob_merge_groupby_op.h"
 #include "sql/engine/aggregate/ob_hash_groupby_op.h"
+#include "sql/engine/aggregate/ob_hash_group_join_vec_op.h"
 #include "sql/engine/join/ob_merge_join_op.h"
 #include "sql/engine/basic/ob_topk_op.h"
 #include "sql/executor/ob_task_spliter.h"
@@ -5134,6 +5136,38 @@ int ObStaticEngineCG::generate_spec(ObLogGroupBy &op, ObHashGroupByVecSpec &spec
   return generate_spec(op, reinterpret_cast<ObHashGroupBySpec &> (spec), in_root_job);
 }
 
+int ObStaticEngineCG::generate_spec(ObLogGroupJoin &op, ObHashGroupJoinVecSpec &spec,
+                                    const bool in_root_job)
+{
+  UNUSED(in_root_job);
+  int ret = OB_SUCCESS;
+  const ObIArray<ObRawExpr *> &group_exprs = op.get_group_by_exprs();
+  const ObIArray<ObRawExpr *> &probe_keys = op.get_probe_keys();
+  if (OB_UNLIKELY(2 != spec.get_child_cnt() || group_exprs.count() != probe_keys.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid group join", K(ret), K(spec.get_child_cnt()),
+             K(group_exprs.count()), K(probe_keys.count()));
+  } else if (OB_UNLIKELY(!spec.is_vectorized() || !spec.use_rich_format_)) {
+    // the optimizer only chooses group join for vectorized rich format plans
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("group join is not vectorized", K(ret), K(spec.max_batch_size_),
+             K(spec.use_rich_format_));
+  } else if (OB_FAIL(spec.build_keys_.init(group_exprs.count()))) {
+    LOG_WARN("failed to init build keys", K(ret));
+  } else if (OB_FAIL(generate_rt_exprs(group_exprs, spec.build_keys_))) {
+    LOG_WARN("failed to generate build keys", K(ret));
+  } else if (OB_FAIL(spec.probe_keys_.init(probe_keys.count()))) {
+    LOG_WARN("failed to init probe keys", K(ret));
+  } else if (OB_FAIL(generate_rt_exprs(probe_keys, spec.probe_keys_))) {
+    LOG_WARN("failed to generate probe keys", K(ret));
+  } else if (OB_FAIL(fill_aggr_infos(op, spec, &spec.build_keys_, nullptr, nullptr))) {
+    LOG_WARN("failed to fill aggr infos", K(ret));
+  } else {
+    spec.set_est_group_cnt(op.get_distinct_card());
+  }
+  return ret;
+}
+
 // copy from ObCodeGeneratorImpl::convert_normal_table_scan
 int ObStaticEngineCG::generate_normal_tsc(ObLogTableScan &op, ObTableScanSpec &spec)
 {
@@ -9086,6 +9120,10 @@ int ObStaticEngineCG::get_phy_op_type(ObLogicalOperator &log_op,
       }
       break;
     }
+    case log_op_def::LOG_GROUP_JOIN: {
+      type = PHY_VEC_HASH_GROUP_JOIN;
+      break;
+    }
     case log_op_def::LOG_SORT: {
       int tmp_ret = OB_SUCCESS;
       bool use_vec_sort = true;
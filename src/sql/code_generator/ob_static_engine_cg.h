@@ -337,6 +337,7 @@ private:
   int generate_spec(ObLogGroupBy &op, ObMergeGroupByVecSpec &spec, const bool in_root_job);
   int generate_spec(ObLogGroupBy &op, ObHashGroupBySpec &spec, const bool in_root_job);
   int generate_spec(ObLogGroupBy &op, ObHashGroupByVecSpec &spec, const bool in_root_job);
+  int generate_spec(ObLogGroupJoin &op, ObHashGroupJoinVecSpec &spec, const bool in_root_job);
   int generate_dist_aggr_distinct_columns(ObLogGroupBy &op, ObHashGroupBySpec &spec);
   int generate_dist_aggr_group(ObLogGroupBy &op, ObGroupBySpec &spec);
 
@@ -176,6 +176,7 @@ ObDtlBasicChannel::ObDtlBasicChannel(
       hash_val_(0),
       dfc_idx_(OB_INVALID_ID),
       got_from_dtl_cache_(true),
+      local_columnar_exchange_(false),
       msg_writer_(nullptr),
       bc_service_(nullptr),
       times_(0),
@@ -214,6 +215,7 @@ ObDtlBasicChannel::ObDtlBasicChannel(
           hash_val_(hash_val),
           dfc_idx_(OB_INVALID_ID),
           got_from_dtl_cache_(true),
+          local_columnar_exchange_(false),
           msg_writer_(nullptr),
           bc_service_(nullptr),
           times_(0),
@@ -1210,7 +1212,8 @@ void ObDtlBasicChannel::switch_msg_type(const ObDtlMsg &msg)
 {
   if (msg.is_data_msg()
       && static_cast<const ObPxNewRow &> (msg).get_data_type() == PX_VECTOR
-       && DtlChannelType::LOCAL_CHANNEL == get_channel_type()) {
+       && DtlChannelType::LOCAL_CHANNEL == get_channel_type()
+       && !local_columnar_exchange_) {
     static_cast<ObPxNewRow &> (const_cast<ObDtlMsg &> (msg)).set_data_type(PX_VECTOR_ROW);
   }
 }
@@ -725,6 +725,10 @@ public:
   ObDtlVectorFixedMsgWriter &get_vector_fixed_msg_writer() { return vector_fixed_msg_writer_; }
   virtual int push_buffer_batch_info() override;
   void switch_msg_type(const ObDtlMsg &msg);
+  // local channel keeps PX_VECTOR buffers in columnar layout instead of
+  // demoting them to PX_VECTOR_ROW, receiver attaches the vectors directly.
+  void set_local_columnar_exchange(bool v) { local_columnar_exchange_ = v; }
+  bool is_local_columnar_exchange() const { return local_columnar_exchange_; }
   void set_row_meta(RowMeta &meta) { meta_ = &meta; }
 
   TO_STRING_KV(KP_(id), K_(peer));
@@ -772,6 +776,7 @@ protected:
   int64_t hash_val_;
   int64_t dfc_idx_;
   int64_t got_from_dtl_cache_;
+  bool local_columnar_exchange_;
 
   ObDtlControlMsgWriter ctl_msg_writer_;
   ObDtlRowMsgWriter row_msg_writer_;
@@ -235,6 +235,7 @@ public:
   OB_INLINE ObDtlChannelWatcher *get_msg_watcher() { return msg_watcher_; }
 
   void set_compression_type(const common::ObCompressorType &type) { compressor_type_ = type; }
+  void set_vector_encode(bool vector_encode) { vector_encode_ = vector_encode; }
 
   void set_batch_id(int64_t batch_id) { batch_id_ = batch_id; }
   int64_t get_batch_id() { return batch_id_; }
@@ -288,6 +289,8 @@ protected:
   int64_t loop_idx_;
 
   common::ObCompressorType compressor_type_;
+  // encode fixed vector buffer with ObDtlVectorCodec before sending by rpc
+  bool vector_encode_;
 
   DTLChannelOwner owner_mod_;
   int64_t thread_id_;
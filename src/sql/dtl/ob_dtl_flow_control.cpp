@@ -19,6 +19,7 @@
 #include "ob_dtl_channel_loop.h"
 #include "ob_dtl_utils.h"
 #include "observer/omt/ob_tenant_config_mgr.h"
+#include "share/ob_cluster_version.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::omt;
@@ -62,6 +63,12 @@ int ObDtlFlowControl::init(uint64_t tenant_id, int64_t chan_cnt)
     if (tenant_config.is_valid() && true == tenant_config->_px_message_compression) {
       compressor_type_ = ObCompressorType::LZ4_COMPRESSOR;
     }
+    // receivers before 4.3.4.0 can not decode DTL_VECTOR_ENCODED buffers, keep the raw
+    // layout until all servers are upgraded.
+    if (tenant_config.is_valid() && true == tenant_config->_px_vector_wire_encoding
+        && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_3_4_0) {
+      vector_encode_ = true;
+    }
     is_init_ = true;
     tenant_id_ = tenant_id;
     timeout_ts_ = 0;
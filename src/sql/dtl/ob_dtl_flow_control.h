@@ -84,7 +84,7 @@ class ObDtlFlowControl
 public:
   ObDtlFlowControl() :
   tenant_id_(OB_INVALID_ID), timeout_ts_(0), communicate_flag_(0),
-  compressor_type_(common::ObCompressorType::NONE_COMPRESSOR), is_init_(false), block_ch_cnt_(0),
+  compressor_type_(common::ObCompressorType::NONE_COMPRESSOR), vector_encode_(false), is_init_(false), block_ch_cnt_(0),
   total_memory_size_(0), total_buffer_cnt_(0), accumulated_blocked_cnt_(0), blocks_(), chans_(), drain_ch_cnt_(0),
   dfo_key_(), op_metric_(nullptr),
   chan_loop_(nullptr), ch_info_(nullptr)
@@ -219,6 +219,7 @@ public:
   { ch_info_ = ch_info; }
 
   common::ObCompressorType get_compressor_type() { return compressor_type_; }
+  bool enable_vector_encode() const { return vector_encode_; }
 
 private:
   static const int64_t THRESHOLD_SIZE = 2097152;
@@ -229,6 +230,7 @@ private:
   // 标识是否是transmit、receive、qc等
   int communicate_flag_;
   common::ObCompressorType compressor_type_;
+  bool vector_encode_;
   bool is_init_;
   int64_t block_ch_cnt_;
   int64_t total_memory_size_;
@@ -137,7 +137,9 @@ OB_DEF_SERIALIZE(ObDtlLinkedBuffer)
     if (buf_len - pos < size_) {
       ret = OB_SIZE_OVERFLOW;
     } else {
-      if (PX_VECTOR == msg_type_) {
+      if (is_vector_encoded()) {
+        MEMCPY(buf + pos, buf_, size_);
+      } else if (PX_VECTOR == msg_type_) {
         if (OB_FAIL(serialize_vector(buf, pos, size_))) {
           SQL_DTL_LOG(WARN, "serialize vector failed", K(ret));
         }
@@ -233,7 +235,9 @@ OB_DEF_DESERIALIZE(ObDtlLinkedBuffer)
 OB_DEF_SERIALIZE_SIZE(ObDtlLinkedBuffer)
 {
   int64_t len = 0;
-  if (PX_VECTOR == msg_type_) {
+  if (is_vector_encoded()) {
+    // size_ is already the encoded size
+  } else if (PX_VECTOR == msg_type_) {
     int64_t new_size  = get_serialize_vector_size();
     if (OB_UNLIKELY(size_ < new_size)) {
       SQL_DTL_LOG(TRACE, "unexpected encode leads size overflow", K(size_), K(new_size));
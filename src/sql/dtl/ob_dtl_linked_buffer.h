@@ -23,6 +23,8 @@ namespace sql {
 namespace dtl {
 
 #define DTL_BROADCAST (1ULL)
+// payload is encoded by ObDtlVectorCodec, decoded by receiver rpc channel
+#define DTL_VECTOR_ENCODED (1ULL << 1)
 
 struct ObDtlMsgHeader;
 class ObDtlChannel;
@@ -362,6 +364,10 @@ public:
     remove_flag(DTL_BROADCAST);
   }
 
+  bool is_vector_encoded() const {
+    return has_flag(DTL_VECTOR_ENCODED);
+  }
+
   uint64_t enable_channel_sync() const { return enable_channel_sync_; }
   void set_enable_channel_sync(const bool enable_channel_sync) { enable_channel_sync_ = enable_channel_sync; }
 
@@ -406,6 +412,7 @@ public:
     msg_type_ = src.msg_type_;
     flags_ = src.flags_;
     dfo_key_ = src.dfo_key_;
+    use_interm_result_ = src.use_interm_result_;
     dfo_id_ = src.dfo_id_;
     sqc_id_ = src.sqc_id_;
     enable_channel_sync_ = src.enable_channel_sync_;
@@ -15,6 +15,7 @@
 #include "ob_dtl_local_channel.h"
 #include "lib/oblog/ob_log_module.h"
 #include "sql/dtl/ob_dtl_flow_control.h"
+#include "sql/dtl/ob_dtl_vectors_buffer.h"
 #include "sql/engine/basic/ob_chunk_row_store.h"
 #include "ob_dtl_interm_result_manager.h"
 #include "sql/engine/px/datahub/components/ob_dh_init_channel.h"
@@ -68,6 +69,42 @@ int ObDtlLocalChannel::feedup(ObDtlLinkedBuffer *&linked_buffer)
   return attach(linked_buffer);
 }
 
+// PX_VECTOR buffer is written as column segments, compact it into the same
+// continuous layout that rpc channel serializes, so receiver can attach the
+// vectors on the shared buffer without decoding row by row.
+int ObDtlLocalChannel::compact_vector_buffer(ObDtlLinkedBuffer *&buf)
+{
+  int ret = OB_SUCCESS;
+  ObDtlLinkedBuffer *compact_buf = nullptr;
+  const int64_t size = buf->get_serialize_vector_size();
+  if (OB_ISNULL(compact_buf = alloc_buf(size))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc compact buffer", K(ret), K(size));
+  } else {
+    char *data = compact_buf->buf();
+    if (OB_FAIL(buf->serialize_vector(data, 0, size))) {
+      LOG_WARN("failed to serialize vector", K(ret), K(size));
+    } else if (OB_FAIL(compact_buf->shallow_copy(*buf))) {
+      LOG_WARN("failed to copy buffer header", K(ret));
+    } else if (OB_FAIL(compact_buf->push_batch_id(buf->get_batch_id(),
+                                                  ObDtlVectors::decode_row_cnt(data)))) {
+      LOG_WARN("failed to push batch id", K(ret));
+    } else {
+      compact_buf->set_buf(data);
+      compact_buf->set_size(size);
+      // bcast buffer is owned by bcast agent and skipped by free_buf
+      free_buf(buf);
+      buf = compact_buf;
+      compact_buf = nullptr;
+    }
+    if (nullptr != compact_buf) {
+      compact_buf->set_buf(data);
+      free_buf(compact_buf);
+    }
+  }
+  return ret;
+}
+
 // 每一条return路径都必须设置on_finish否则后续会卡死
 int ObDtlLocalChannel::send_shared_message(ObDtlLinkedBuffer *&buf)
 {
@@ -82,15 +119,17 @@ int ObDtlLocalChannel::send_shared_message(ObDtlLinkedBuffer *&buf)
   } else {
     is_first = buf->is_data_msg() && 1 == buf->seq_no();
     is_eof = buf->is_eof();
-    if (buf->is_data_msg() && buf->use_interm_result()) {
+    // compact before the buffer leaves the sender, the segments of the uncompacted
+    // buffer are owned by the sender and may be freed before interm result is read.
+    if (ObDtlMsgType::PX_VECTOR == buf->msg_type()
+        && OB_FAIL(compact_vector_buffer(buf))) {
+      LOG_WARN("failed to compact vector buffer", K(ret), K(buf->msg_type()));
+    } else if (buf->is_data_msg() && buf->use_interm_result()) {
       MTL_SWITCH(buf->tenant_id()) {
         if (OB_FAIL(MTL(ObDTLIntermResultManager*)->process_interm_result(buf, peer_id_))) {
           LOG_WARN("fail to process internal result", K(ret));
         }
       }
-    } else if (ObDtlMsgType::PX_VECTOR == buf->msg_type()) {
-      ret = OB_NOT_SUPPORTED;
-      LOG_WARN("vector is not supported in local channel", K(ret), K(buf->msg_type()));
     } else if (OB_FAIL(DTL.get_channel(peer_id_, chan))) {
       int tmp_ret = ret;
       // cache版本升级不需要处理，数据发送到receive端大致几种情况：
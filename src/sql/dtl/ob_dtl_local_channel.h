@@ -48,6 +48,7 @@ public:
   virtual int send_message(ObDtlLinkedBuffer *&buf);
 private:
   int send_shared_message(ObDtlLinkedBuffer *&buf);
+  int compact_vector_buffer(ObDtlLinkedBuffer *&buf);
 };
 
 }  // dtl
@@ -22,6 +22,7 @@
 #include "sql/dtl/ob_dtl_channel_agent.h"
 #include "share/rc/ob_context.h"
 #include "sql/dtl/ob_dtl_channel_watcher.h"
+#include "sql/dtl/ob_dtl_vector_codec.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::share;
@@ -229,10 +230,16 @@ int ObDtlRpcChannel::feedup(ObDtlLinkedBuffer *&buffer)
       }
     } else if (is_drain()) {
       // do nothing
-    } else if (OB_ISNULL(linked_buffer = alloc_buf(buffer->size()))){
+    } else if (OB_ISNULL(linked_buffer = alloc_buf(buffer->is_vector_encoded()
+                                                   ? ObDtlVectorCodec::decode_size(buffer->buf())
+                                                   : buffer->size()))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       LOG_WARN("failed to allocate buffer", K(ret));
-    } else if (OB_FAIL(ObDtlLinkedBuffer::assign(*buffer, linked_buffer))) {
+    } else if (buffer->is_vector_encoded() && OB_FAIL(decode_vector_buffer(*buffer, *linked_buffer))) {
+      LOG_WARN("failed to decode vector buffer", K(ret));
+      free_buf(linked_buffer);
+      linked_buffer = nullptr;
+    } else if (!buffer->is_vector_encoded() && OB_FAIL(ObDtlLinkedBuffer::assign(*buffer, linked_buffer))) {
       LOG_WARN("failed to assign buffer", K(ret));
     } else {
       if (1 == linked_buffer->seq_no() && linked_buffer->is_data_msg()
@@ -275,6 +282,58 @@ int ObDtlRpcChannel::feedup(ObDtlLinkedBuffer *&buffer)
   return ret;
 }
 
+int ObDtlRpcChannel::encode_vector_buffer(ObDtlLinkedBuffer &src, ObDtlLinkedBuffer *&dst)
+{
+  int ret = OB_SUCCESS;
+  const int64_t raw_size = src.get_serialize_fixed_vector_size();
+  const int64_t buf_len = ObDtlVectorCodec::get_max_encoded_size(raw_size);
+  int64_t pos = 0;
+  ObArenaAllocator codec_alloc(ObMemAttr(tenant_id_, "SqlDtlCodec"));
+  if (OB_ISNULL(dst = alloc_buf(buf_len))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc encode buffer", K(ret), K(buf_len));
+  } else {
+    char *data = dst->buf();
+    if (OB_FAIL(ObDtlVectorCodec::encode(src.buf(), data, buf_len, pos, codec_alloc))) {
+      LOG_WARN("failed to encode vector buffer", K(ret), K(buf_len));
+    } else if (OB_FAIL(dst->shallow_copy(src))) {
+      LOG_WARN("failed to copy buffer header", K(ret));
+    } else if (OB_FAIL(dst->push_batch_id(src.get_batch_id(), 0))) {
+      LOG_WARN("failed to push batch id", K(ret));
+    } else {
+      dst->add_flag(DTL_VECTOR_ENCODED);
+      metric_.add_wire_bytes(raw_size, pos);
+    }
+    dst->set_buf(data);
+    dst->set_size(pos);
+    if (OB_FAIL(ret)) {
+      free_buf(dst);
+      dst = nullptr;
+    }
+  }
+  return ret;
+}
+
+int ObDtlRpcChannel::decode_vector_buffer(ObDtlLinkedBuffer &src, ObDtlLinkedBuffer &dst)
+{
+  int ret = OB_SUCCESS;
+  char *data = dst.buf();
+  const int64_t size = ObDtlVectorCodec::decode_size(src.buf());
+  if (OB_FAIL(ObDtlVectorCodec::decode(src.buf(), src.size(), data, size))) {
+    LOG_WARN("failed to decode vector buffer", K(ret), K(size));
+  } else if (OB_FAIL(dst.shallow_copy(src))) {
+    LOG_WARN("failed to copy buffer header", K(ret));
+  } else if (OB_FAIL(dst.push_batch_id(src.get_batch_id(), 0))) {
+    LOG_WARN("failed to push batch id", K(ret));
+  } else {
+    dst.remove_flag(DTL_VECTOR_ENCODED);
+    metric_.add_wire_bytes(size, src.size());
+  }
+  dst.set_buf(data);
+  dst.set_size(size);
+  return ret;
+}
+
 int ObDtlRpcChannel::send_message(ObDtlLinkedBuffer *&buf)
 {
   int ret = OB_SUCCESS;
@@ -316,21 +375,32 @@ int ObDtlRpcChannel::send_message(ObDtlLinkedBuffer *&buf)
     // we wait first message return and retry until peer setup.
     int64_t timeout_us = buf->timeout_ts() - ObTimeUtility::current_time();
     SendMsgCB cb(msg_response_, *cur_trace_id, buf->timeout_ts());
+    // the encoded buffer is serialized into rpc packet synchronously, so it's freed right after send
+    ObDtlLinkedBuffer *send_buf = buf;
     if (timeout_us <= 0) {
       ret = OB_TIMEOUT;
       LOG_WARN("send dtl message timeout", K(ret), K(peer_),
           K(buf->timeout_ts()));
+    } else if (vector_encode_
+               && buf->is_data_msg()
+               && PX_VECTOR_FIXED == buf->msg_type()
+               && !buf->use_interm_result()
+               && OB_FAIL(encode_vector_buffer(*buf, send_buf))) {
+      LOG_WARN("failed to encode vector buffer", K(ret));
     } else if (OB_FAIL(msg_response_.start())) {
       LOG_WARN("start message process fail", K(ret));
     } else if (OB_FAIL(DTL.get_rpc_proxy().to(peer_).timeout(timeout_us)
         .compressed(compressor_type_)
-        .ap_send_message(ObDtlSendArgs{peer_id_, *buf}, &cb))) {
+        .ap_send_message(ObDtlSendArgs{peer_id_, *send_buf}, &cb))) {
       LOG_WARN("send message failed", K_(peer), K(ret));
       int tmp_ret = msg_response_.on_start_fail();
       if (OB_SUCCESS != tmp_ret) {
         LOG_WARN("set start fail failed", K(tmp_ret));
       }
     }
+    if (nullptr != send_buf && send_buf != buf) {
+      free_buf(send_buf);
+    }
     // 1) for data message, if dtl channel is not built, it's cached by first buffer manage,
     //    it's processed rightly, or it's drain
     //    so don't wait first response
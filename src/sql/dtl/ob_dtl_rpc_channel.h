@@ -100,6 +100,9 @@ public:
   virtual int send_message(ObDtlLinkedBuffer *&buf);
 
   bool recv_sqc_fin_res() { return recv_sqc_fin_res_; }
+private:
+  int encode_vector_buffer(ObDtlLinkedBuffer &src, ObDtlLinkedBuffer *&dst);
+  int decode_vector_buffer(ObDtlLinkedBuffer &src, ObDtlLinkedBuffer &dst);
 private:
   bool recv_sqc_fin_res_;
 };
@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DTL
+
+#include "ob_dtl_vector_codec.h"
+#include "lib/codec/ob_codecs.h"
+#include "lib/codec/ob_composite_codec.h"
+#include "lib/codec/ob_simd_fixed_pfor.h"
+#include "lib/codec/ob_delta_zigzag_rle.h"
+
+using namespace oceanbase::common;
+
+namespace oceanbase {
+namespace sql {
+namespace dtl {
+
+typedef ObCompositeCodec<ObSIMDFixedPFor, ObSimpleBitPacking> ObDtlBitPackingCodec;
+
+int ObDtlVectorCodec::encode(const char *src, char *buf, const int64_t buf_len, int64_t &pos,
+                             ObIAllocator &alloc)
+{
+  int ret = OB_SUCCESS;
+  const int32_t col_cnt = *reinterpret_cast<const int32_t *>(src + sizeof(int32_t));
+  const int32_t row_cnt = ObDtlVectors::decode_row_cnt(const_cast<char *>(src));
+  const VectorInfo *infos = reinterpret_cast<const VectorInfo *>(src + ObDtlVectors::HEAD_SIZE);
+  const int64_t nulls_size = ObBitVector::memory_size(row_cnt);
+  char *head = buf + pos;
+  int64_t offset = HEAD_SIZE;
+  int64_t decoded_size = ObDtlVectors::HEAD_SIZE;
+  if (row_cnt > 0 && col_cnt > 0) {
+    offset += col_cnt * sizeof(ColumnHeader);
+    decoded_size += col_cnt * sizeof(VectorInfo);
+  }
+  if (OB_UNLIKELY(pos + offset > buf_len)) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("buffer is not enough", K(ret), K(pos), K(offset), K(buf_len));
+  } else if (row_cnt > 0 && col_cnt > 0) {
+    ColumnHeader *headers = reinterpret_cast<ColumnHeader *>(head + HEAD_SIZE);
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt; ++i) {
+      const int64_t data_len = infos[i].fixed_len_ * row_cnt;
+      headers[i].format_ = infos[i].format_;
+      headers[i].fixed_len_ = infos[i].fixed_len_;
+      headers[i].reserved_ = 0;
+      decoded_size += nulls_size + data_len;
+      if (OB_UNLIKELY(pos + offset + nulls_size > buf_len)) {
+        ret = OB_SIZE_OVERFLOW;
+        LOG_WARN("buffer is not enough", K(ret), K(pos), K(offset), K(buf_len));
+      } else {
+        ObBitVector *nulls = to_bit_vector(head + offset);
+        nulls->deep_copy(*to_bit_vector(src + infos[i].nulls_offset_), row_cnt);
+        offset += nulls_size;
+        if (OB_FAIL(encode_column(src + infos[i].data_offset_, data_len, infos[i].fixed_len_,
+                                  head + offset, buf_len - pos - offset, alloc, headers[i]))) {
+          LOG_WARN("failed to encode column", K(ret), K(i), K(infos[i]));
+        } else {
+          offset += headers[i].data_len_;
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    *reinterpret_cast<int32_t *>(head) = MAGIC;
+    *reinterpret_cast<int32_t *>(head + sizeof(int32_t)) = col_cnt;
+    *reinterpret_cast<int32_t *>(head + sizeof(int32_t) * 2) = row_cnt;
+    *reinterpret_cast<int32_t *>(head + sizeof(int32_t) * 3) = static_cast<int32_t>(decoded_size);
+    pos += offset;
+  }
+  return ret;
+}
+
+int ObDtlVectorCodec::encode_column(const char *in, const int64_t in_len, const int64_t uint_bytes,
+                                    char *out, const int64_t out_len, ObIAllocator &alloc,
+                                    ColumnHeader &header)
+{
+  int ret = OB_SUCCESS;
+  header.codec_ = RAW;
+  header.uint_bytes_ = static_cast<uint8_t>(uint_bytes);
+  header.data_len_ = static_cast<int32_t>(in_len);
+  const bool encodable = (1 == uint_bytes || 2 == uint_bytes || 4 == uint_bytes || 8 == uint_bytes)
+                         && in_len / uint_bytes >= MIN_ENCODE_ROW_CNT;
+  if (OB_UNLIKELY(out_len < in_len)) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("buffer is not enough", K(ret), K(in_len), K(out_len));
+  } else if (encodable) {
+    const int64_t scratch_len = ObCodec::get_default_max_encoding_size(in_len);
+    char *scratch = nullptr;
+    ObDeltaZigzagRle rle_codec;
+    ObDtlBitPackingCodec bp_codec;
+    ObCodec *codecs[] = { &rle_codec, &bp_codec };
+    const CodecType types[] = { DELTA_ZIGZAG_RLE, BIT_PACKING };
+    if (OB_ISNULL(scratch = static_cast<char *>(alloc.alloc(scratch_len)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc scratch buffer", K(ret), K(scratch_len));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < ARRAYSIZEOF(codecs); ++i) {
+      uint64_t encoded_len = 0;
+      codecs[i]->set_uint_bytes(static_cast<uint8_t>(uint_bytes));
+      if (OB_FAIL(codecs[i]->encode(in, in_len, scratch, scratch_len, encoded_len))) {
+        LOG_TRACE("codec not applicable, try next", K(ret), K(types[i]), K(in_len));
+        ret = OB_SUCCESS;
+      } else if (static_cast<int64_t>(encoded_len) < header.data_len_) {
+        MEMCPY(out, scratch, encoded_len);
+        header.codec_ = types[i];
+        header.data_len_ = static_cast<int32_t>(encoded_len);
+      }
+    }
+    if (nullptr != scratch) {
+      alloc.free(scratch);
+    }
+  }
+  if (OB_SUCC(ret) && RAW == header.codec_) {
+    MEMCPY(out, in, in_len);
+  }
+  return ret;
+}
+
+int ObDtlVectorCodec::decode(const char *src, const int64_t src_len, char *buf, const int64_t buf_len)
+{
+  int ret = OB_SUCCESS;
+  const int32_t col_cnt = *reinterpret_cast<const int32_t *>(src + sizeof(int32_t));
+  const int32_t row_cnt = *reinterpret_cast<const int32_t *>(src + sizeof(int32_t) * 2);
+  const int64_t nulls_size = ObBitVector::memory_size(row_cnt);
+  if (OB_UNLIKELY(!is_encoded(src) || decode_size(src) > buf_len)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid encoded vector buffer", K(ret), K(decode_size(src)), K(buf_len));
+  } else {
+    *reinterpret_cast<int32_t *>(buf) = ObDtlVectorsBuffer::MAGIC;
+    *reinterpret_cast<int32_t *>(buf + sizeof(int32_t)) = col_cnt;
+    *reinterpret_cast<int32_t *>(buf + sizeof(int32_t) * 2) = row_cnt;
+  }
+  if (OB_SUCC(ret) && row_cnt > 0 && col_cnt > 0) {
+    const ColumnHeader *headers = reinterpret_cast<const ColumnHeader *>(src + HEAD_SIZE);
+    VectorInfo *infos = reinterpret_cast<VectorInfo *>(buf + ObDtlVectors::HEAD_SIZE);
+    int64_t in_offset = HEAD_SIZE + col_cnt * sizeof(ColumnHeader);
+    int64_t out_offset = ObDtlVectors::HEAD_SIZE + col_cnt * sizeof(VectorInfo);
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt; ++i) {
+      infos[i].format_ = headers[i].format_;
+      infos[i].fixed_len_ = headers[i].fixed_len_;
+      infos[i].nulls_offset_ = out_offset;
+      infos[i].offsets_offset_ = out_offset + nulls_size;
+      infos[i].data_offset_ = out_offset + nulls_size;
+      if (OB_UNLIKELY(in_offset + nulls_size + headers[i].data_len_ > src_len)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("encoded column out of range", K(ret), K(i), K(headers[i]), K(in_offset), K(src_len));
+      } else {
+        to_bit_vector(buf + out_offset)->deep_copy(*to_bit_vector(src + in_offset), row_cnt);
+        in_offset += nulls_size;
+        out_offset += nulls_size;
+        if (OB_FAIL(decode_column(headers[i], src + in_offset, row_cnt, buf + out_offset))) {
+          LOG_WARN("failed to decode column", K(ret), K(i), K(headers[i]));
+        } else {
+          in_offset += headers[i].data_len_;
+          out_offset += headers[i].fixed_len_ * row_cnt;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObDtlVectorCodec::decode_column(const ColumnHeader &header, const char *in,
+                                    const int64_t row_cnt, char *out)
+{
+  int ret = OB_SUCCESS;
+  const int64_t out_len = header.fixed_len_ * row_cnt;
+  uint64_t in_pos = 0;
+  uint64_t out_pos = 0;
+  switch (header.codec_) {
+    case RAW: {
+      MEMCPY(out, in, out_len);
+      break;
+    }
+    case DELTA_ZIGZAG_RLE: {
+      ObDeltaZigzagRle codec;
+      codec.set_uint_bytes(header.uint_bytes_);
+      ret = codec.decode(in, header.data_len_, in_pos, row_cnt, out, out_len, out_pos);
+      break;
+    }
+    case BIT_PACKING: {
+      ObDtlBitPackingCodec codec;
+      codec.set_uint_bytes(header.uint_bytes_);
+      ret = codec.decode(in, header.data_len_, in_pos, row_cnt, out, out_len, out_pos);
+      break;
+    }
+    default: {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected codec type", K(ret), K(header));
+      break;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("failed to decode column", K(ret), K(header), K(row_cnt));
+  }
+  return ret;
+}
+
+}  // dtl
+}  // sql
+}  // oceanbase
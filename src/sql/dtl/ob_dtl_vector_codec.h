@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_DTL_VECTOR_CODEC_H
+#define OB_DTL_VECTOR_CODEC_H
+
+#include "lib/allocator/ob_allocator.h"
+#include "sql/dtl/ob_dtl_vectors_buffer.h"
+
+namespace oceanbase {
+namespace sql {
+namespace dtl {
+
+/*
+lightweight columnar encoding of fixed vector buffer, used by rpc channel
+magic_num : 4
+col_cnt : 4
+row_cnt : 4
+decoded size : 4
+(format : 4 + fixed len : 4 + codec : 1 + uint bytes : 1 + reserved : 2 + data len : 4) * col_cnt
+(nulls : to_bit_vector(row_cnt) + encoded data)  * col_cnt
+decoded buffer has the same layout as ObDtlLinkedBuffer::serialize_fixed_vector
+*/
+class ObDtlVectorCodec
+{
+public:
+  static const int32_t MAGIC = 0xd7c0dec;
+  static const int64_t HEAD_SIZE = sizeof(int32_t) * 4;
+  static const int64_t MIN_ENCODE_ROW_CNT = 16;
+  enum CodecType : uint8_t
+  {
+    RAW = 0,
+    DELTA_ZIGZAG_RLE = 1,
+    BIT_PACKING = 2,
+  };
+  struct ColumnHeader
+  {
+    VectorFormat format_;
+    int32_t fixed_len_;
+    uint8_t codec_;
+    uint8_t uint_bytes_;
+    uint16_t reserved_;
+    int32_t data_len_;
+    TO_STRING_KV(K_(format), K_(fixed_len), K_(codec), K_(uint_bytes), K_(data_len));
+  };
+  // encoded size never exceeds the decoded size plus the extra head
+  static int64_t get_max_encoded_size(const int64_t decoded_size)
+  {
+    return decoded_size + HEAD_SIZE;
+  }
+  static int32_t decode_size(const char *buf)
+  {
+    return *reinterpret_cast<const int32_t *>(buf + sizeof(int32_t) * 3);
+  }
+  static bool is_encoded(const char *buf)
+  {
+    return MAGIC == *reinterpret_cast<const int32_t *>(buf);
+  }
+  // %src is a fixed vector buffer, see ObDtlVectors
+  static int encode(const char *src, char *buf, const int64_t buf_len, int64_t &pos,
+                    common::ObIAllocator &alloc);
+  static int decode(const char *src, const int64_t src_len, char *buf, const int64_t buf_len);
+private:
+  static int encode_column(const char *in, const int64_t in_len, const int64_t uint_bytes,
+                           char *out, const int64_t out_len, common::ObIAllocator &alloc,
+                           ColumnHeader &header);
+  static int decode_column(const ColumnHeader &header, const char *in, const int64_t row_cnt,
+                           char *out);
+};
+
+}  // dtl
+}  // sql
+}  // oceanbase
+
+#endif /* OB_DTL_VECTOR_CODEC_H */
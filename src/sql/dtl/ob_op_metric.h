@@ -28,7 +28,8 @@ class ObOpMetric
 public:
   ObOpMetric() :
     enable_audit_(false), id_(-1), type_(MetricType::DEFAULT_MAX), interval_cnt_(0), interval_start_time_(0), interval_end_time_(0),
-    exec_time_(0), flag_(0), first_in_ts_(0), first_out_ts_(0), last_in_ts_(0), last_out_ts_(0), counter_(0), eof_(false)
+    exec_time_(0), flag_(0), first_in_ts_(0), first_out_ts_(0), last_in_ts_(0), last_out_ts_(0), counter_(0), eof_(false),
+    raw_bytes_(0), wire_bytes_(0)
   {}
   virtual ~ObOpMetric() {}
 
@@ -49,6 +50,8 @@ public:
     last_out_ts_ = other.last_out_ts_;
     counter_ = other.counter_;
     eof_ = other.eof_;
+    raw_bytes_ = other.raw_bytes_;
+    wire_bytes_ = other.wire_bytes_;
     return *this;
   }
 
@@ -73,6 +76,15 @@ public:
   OB_INLINE void count(int64_t cnt) { counter_ += cnt; }
   int64_t get_counter() { return counter_; }
 
+  // bytes of dtl buffer before and after columnar encoding
+  OB_INLINE void add_wire_bytes(int64_t raw_bytes, int64_t wire_bytes)
+  {
+    raw_bytes_ += raw_bytes;
+    wire_bytes_ += wire_bytes;
+  }
+  int64_t get_raw_bytes() const { return raw_bytes_; }
+  int64_t get_wire_bytes() const { return wire_bytes_; }
+
   void set_audit(bool enable_audit) { enable_audit_ = enable_audit; }
   bool get_enable_audit() { return enable_audit_; }
   void set_id(int64_t id) { id_ = id; }
@@ -85,7 +97,8 @@ public:
   void mark_interval_end(int64_t *out_exec_time = nullptr, int64_t interval = 1);
   OB_INLINE int64_t get_exec_time() { return exec_time_; }
 
-  TO_STRING_KV(K_(id), K_(type), K_(first_in_ts), K_(first_out_ts), K_(last_in_ts), K_(last_out_ts), K_(counter), K_(exec_time), K_(eof));
+  TO_STRING_KV(K_(id), K_(type), K_(first_in_ts), K_(first_out_ts), K_(last_in_ts), K_(last_out_ts), K_(counter), K_(exec_time), K_(eof),
+               K_(raw_bytes), K_(wire_bytes));
 private:
   static const int64_t FIRST_IN = 0x01;
   static const int64_t FIRST_OUT = 0x02;
@@ -112,6 +125,8 @@ private:
 
   int64_t counter_;
   bool eof_;
+  int64_t raw_bytes_;
+  int64_t wire_bytes_;
 };
 
 OB_INLINE void ObOpMetric::mark_first_in()
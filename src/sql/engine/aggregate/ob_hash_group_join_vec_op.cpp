@@ -0,0 +1,546 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/aggregate/ob_hash_group_join_vec_op.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/px/ob_px_util.h"
+
+namespace oceanbase
+{
+using namespace common;
+
+namespace sql
+{
+
+OB_SERIALIZE_MEMBER((ObHashGroupJoinVecSpec, ObGroupBySpec),
+                    build_keys_, probe_keys_, est_group_cnt_);
+
+DEF_TO_STRING(ObHashGroupJoinVecSpec)
+{
+  int64_t pos = 0;
+  J_OBJ_START();
+  J_NAME("groupby_spec");
+  J_COLON();
+  pos += ObGroupBySpec::to_string(buf + pos, buf_len - pos);
+  J_COMMA();
+  J_KV(K_(build_keys), K_(probe_keys), K_(est_group_cnt));
+  J_OBJ_END();
+  return pos;
+}
+
+ObHashGroupJoinVecOp::ObHashGroupJoinVecOp(ObExecContext &exec_ctx, const ObOpSpec &spec,
+                                           ObOpInput *input)
+  : ObGroupByVecOp(exec_ctx, spec, input),
+    mem_context_(nullptr),
+    profile_(ObSqlWorkAreaType::HASH_WORK_AREA),
+    sql_mem_processor_(profile_, op_monitor_info_),
+    group_store_(),
+    group_entries_(),
+    buckets_(nullptr),
+    bucket_num_(0),
+    hash_vals_(nullptr),
+    key_skip_(nullptr),
+    stored_rows_(nullptr),
+    batch_aggr_rows_(nullptr),
+    output_rows_(nullptr),
+    cur_group_idx_(0),
+    probe_row_cnt_(0),
+    matched_row_cnt_(0),
+    ht_built_(false),
+    probe_end_(false)
+{
+}
+
+void ObHashGroupJoinVecOp::reset(const bool for_rescan)
+{
+  if (for_rescan) {
+    group_store_.reuse();
+  } else {
+    group_store_.reset();
+  }
+  group_entries_.reuse();
+  if (nullptr != buckets_ && nullptr != mem_context_) {
+    mem_context_->get_malloc_allocator().free(buckets_);
+  }
+  buckets_ = nullptr;
+  bucket_num_ = 0;
+  sql_mem_processor_.reset();
+  cur_group_idx_ = 0;
+  probe_row_cnt_ = 0;
+  matched_row_cnt_ = 0;
+  ht_built_ = false;
+  probe_end_ = false;
+}
+
+int ObHashGroupJoinVecOp::init_mem_context()
+{
+  int ret = OB_SUCCESS;
+  if (NULL == mem_context_) {
+    lib::ContextParam param;
+    param.set_mem_attr(ctx_.get_my_session()->get_effective_tenant_id(),
+                       ObModIds::OB_HASH_NODE_GROUP_ROWS,
+                       ObCtxIds::WORK_AREA);
+    if (OB_FAIL(CURRENT_CONTEXT->CREATE_CONTEXT(mem_context_, param))) {
+      LOG_WARN("memory entity create failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::init_batch_buffers()
+{
+  int ret = OB_SUCCESS;
+  const int64_t max_size = MY_SPEC.max_batch_size_;
+  ObIAllocator &alloc = mem_context_->get_arena_allocator();
+  void *skip_buf = nullptr;
+  if (OB_ISNULL(hash_vals_ = static_cast<uint64_t *>(alloc.alloc(sizeof(uint64_t) * max_size)))
+      || OB_ISNULL(skip_buf = alloc.alloc(ObBitVector::memory_size(max_size)))
+      || OB_ISNULL(stored_rows_ = static_cast<ObCompactRow **>(
+                     alloc.alloc(sizeof(ObCompactRow *) * max_size)))
+      || OB_ISNULL(batch_aggr_rows_ = static_cast<aggregate::AggrRowPtr *>(
+                     alloc.alloc(sizeof(aggregate::AggrRowPtr) * max_size)))
+      || OB_ISNULL(output_rows_ = static_cast<const ObCompactRow **>(
+                     alloc.alloc(sizeof(ObCompactRow *) * max_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate batch buffers failed", K(ret), K(max_size));
+  } else {
+    key_skip_ = to_bit_vector(skip_buf);
+    key_skip_->reset(max_size);
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::init_sql_mem_processor()
+{
+  int ret = OB_SUCCESS;
+  int64_t est_group_cnt = MY_SPEC.est_group_cnt_;
+  if (OB_FAIL(ObPxEstimateSizeUtil::get_px_size(&ctx_, MY_SPEC.px_est_size_factor_,
+                                                est_group_cnt, est_group_cnt))) {
+    LOG_WARN("failed to get px size", K(ret));
+  } else if (OB_FAIL(sql_mem_processor_.init(&mem_context_->get_malloc_allocator(),
+                                             ctx_.get_my_session()->get_effective_tenant_id(),
+                                             MY_SPEC.width_ * est_group_cnt
+                                             + sizeof(GroupEntry) * est_group_cnt * 3,
+                                             MY_SPEC.type_,
+                                             MY_SPEC.id_,
+                                             &ctx_))) {
+    LOG_WARN("failed to init sql mem processor", K(ret));
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::check_mem_bound()
+{
+  int ret = OB_SUCCESS;
+  bool updated = false;
+  bool need_dump = false;
+  const int64_t mem_used = get_mem_used_size();
+  if (OB_FAIL(sql_mem_processor_.update_max_available_mem_size_periodically(
+                &mem_context_->get_malloc_allocator(),
+                [&](int64_t cur_cnt) { return group_entries_.count() > cur_cnt; },
+                updated))) {
+    LOG_WARN("failed to update usable memory size periodically", K(ret));
+  } else if (OB_FAIL(sql_mem_processor_.update_used_mem_size(mem_used))) {
+    LOG_WARN("failed to update used memory size", K(ret), K(mem_used));
+  } else if (mem_used <= sql_mem_processor_.get_mem_bound()) {
+  } else if (OB_FAIL(sql_mem_processor_.extend_max_memory_size(
+                       &mem_context_->get_malloc_allocator(),
+                       [&](int64_t max_memory_size) { return mem_used > max_memory_size; },
+                       need_dump,
+                       mem_used))) {
+    LOG_WARN("failed to extend max memory size", K(ret), K(mem_used));
+  } else if (need_dump) {
+    ret = OB_EXCEED_MEM_LIMIT;
+    LOG_WARN("build side of group join exceeds memory bound", K(ret), K(mem_used),
+             K(sql_mem_processor_.get_mem_bound()), K(group_entries_.count()));
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::inner_open()
+{
+  int ret = OB_SUCCESS;
+  reset(false);
+  ObMemAttr attr(ctx_.get_my_session()->get_effective_tenant_id(),
+                 ObModIds::OB_HASH_NODE_GROUP_ROWS, ObCtxIds::WORK_AREA);
+  if (OB_UNLIKELY(2 != get_child_cnt() || OB_ISNULL(left_) || OB_ISNULL(right_)
+                  || MY_SPEC.build_keys_.count() != MY_SPEC.probe_keys_.count()
+                  || MY_SPEC.build_keys_.empty())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid group join", K(ret), K(get_child_cnt()), K(MY_SPEC.build_keys_),
+             K(MY_SPEC.probe_keys_));
+  } else if (OB_FAIL(ObGroupByVecOp::inner_open())) {
+    LOG_WARN("failed to inner_open", K(ret));
+  } else if (OB_FAIL(init_mem_context())) {
+    LOG_WARN("init memory entity failed", K(ret));
+  } else if (OB_FAIL(init_batch_buffers())) {
+    LOG_WARN("init batch buffers failed", K(ret));
+  } else if (OB_FAIL(init_sql_mem_processor())) {
+    LOG_WARN("init sql mem processor failed", K(ret));
+  } else {
+    group_store_.set_allocator(mem_context_->get_malloc_allocator());
+    group_entries_.set_attr(attr);
+    if (OB_FAIL(group_store_.init(MY_SPEC.build_keys_, MY_SPEC.max_batch_size_, attr,
+                                  0 /*mem_limit*/, false /*enable_dump*/,
+                                  aggr_processor_.get_aggregate_row_size(), NONE_COMPRESSOR))) {
+      LOG_WARN("init group store failed", K(ret));
+    } else if (MY_SPEC.est_group_cnt_ > 0
+               && OB_FAIL(group_entries_.reserve(min(MY_SPEC.est_group_cnt_,
+                                                     MIN_BUCKET_NUM * MIN_BUCKET_NUM)))) {
+      LOG_WARN("reserve group entries failed", K(ret), K(MY_SPEC.est_group_cnt_));
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::inner_rescan()
+{
+  int ret = OB_SUCCESS;
+  reset(true);
+  if (OB_FAIL(ObGroupByVecOp::inner_rescan())) {
+    LOG_WARN("failed to rescan", K(ret));
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::inner_switch_iterator()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(inner_rescan())) {
+    LOG_WARN("failed to switch iterator", K(ret));
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::inner_close()
+{
+  sql_mem_processor_.unregister_profile();
+  reset(false);
+  return ObGroupByVecOp::inner_close();
+}
+
+void ObHashGroupJoinVecOp::destroy()
+{
+  sql_mem_processor_.unregister_profile_if_necessary();
+  reset(false);
+  group_entries_.destroy();
+  sql_mem_processor_.destroy();
+  ObGroupByVecOp::destroy();
+  if (NULL != mem_context_) {
+    DESTROY_CONTEXT(mem_context_);
+    mem_context_ = NULL;
+  }
+}
+
+int ObHashGroupJoinVecOp::inner_get_next_batch(const int64_t max_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (!ht_built_) {
+    if (OB_FAIL(build_hash_table())) {
+      LOG_WARN("build hash table failed", K(ret));
+    } else if (OB_FAIL(probe_and_aggregate())) {
+      LOG_WARN("probe and aggregate failed", K(ret));
+    } else {
+      op_monitor_info_.otherstat_2_value_ = group_entries_.count();
+      op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::HASH_ROW_COUNT;
+      op_monitor_info_.otherstat_3_value_ = bucket_num_;
+      op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::HASH_BUCKET_COUNT;
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(output_groups(min(max_row_cnt, MY_SPEC.max_batch_size_)))) {
+    LOG_WARN("output groups failed", K(ret));
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::calc_hash_values(const ExprFixedArray &keys, const ObBatchRows &brs,
+                                           ObBitVector &skip)
+{
+  int ret = OB_SUCCESS;
+  uint64_t seed = HASH_SEED;
+  skip.deep_copy(*brs.skip_, brs.size_);
+  // inner join on non null safe equal condition, the row with null key never matches
+  for (int64_t i = 0; OB_SUCC(ret) && i < keys.count(); i++) {
+    ObExpr *expr = keys.at(i);
+    ObIVector *vec = nullptr;
+    if (OB_FAIL(expr->eval_vector(eval_ctx_, brs))) {
+      LOG_WARN("eval key failed", K(ret), K(i));
+    } else if (FALSE_IT(vec = expr->get_vector(eval_ctx_))) {
+    } else if (vec->has_null()) {
+      for (int64_t j = 0; j < brs.size_; j++) {
+        if (!skip.at(j) && vec->is_null(j)) {
+          skip.set(j);
+        }
+      }
+    }
+  }
+  const EvalBound bound(brs.size_, skip.is_all_false(brs.size_));
+  for (int64_t i = 0; OB_SUCC(ret) && i < keys.count(); i++) {
+    ObExpr *expr = keys.at(i);
+    const bool is_batch_seed = (i > 0);
+    if (OB_FAIL(expr->get_vector(eval_ctx_)->murmur_hash_v3(*expr, hash_vals_, skip, bound,
+                                                            is_batch_seed ? hash_vals_ : &seed,
+                                                            is_batch_seed))) {
+      LOG_WARN("calc hash value failed", K(ret), K(i));
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::build_hash_table()
+{
+  int ret = OB_SUCCESS;
+  const ObBatchRows *child_brs = nullptr;
+  bool iter_end = false;
+  while (OB_SUCC(ret) && !iter_end) {
+    if (OB_FAIL(left_->get_next_batch(MY_SPEC.max_batch_size_, child_brs))) {
+      LOG_WARN("get build side batch failed", K(ret));
+    } else if (child_brs->size_ > 0 && OB_FAIL(add_build_batch(*child_brs))) {
+      LOG_WARN("add build batch failed", K(ret));
+    } else if (OB_FAIL(check_mem_bound())) {
+      LOG_WARN("check memory bound failed", K(ret));
+    } else if (OB_FAIL(try_check_status())) {
+      LOG_WARN("check status failed", K(ret));
+    } else {
+      iter_end = child_brs->end_;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    bucket_num_ = next_pow2(max(MIN_BUCKET_NUM, group_entries_.count() * 2));
+    const int64_t buckets_size = sizeof(GroupEntry *) * bucket_num_;
+    if (OB_ISNULL(buckets_ = static_cast<GroupEntry **>(
+                    mem_context_->get_malloc_allocator().alloc(buckets_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate buckets failed", K(ret), K(bucket_num_));
+    } else {
+      MEMSET(buckets_, 0, buckets_size);
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < group_entries_.count(); i++) {
+      if (OB_FAIL(insert_group_entry(group_entries_.at(i)))) {
+        LOG_WARN("insert group entry failed", K(ret), K(i));
+      }
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(sql_mem_processor_.update_used_mem_size(get_mem_used_size()))) {
+    LOG_WARN("failed to update used memory size", K(ret));
+  }
+  if (OB_SUCC(ret)) {
+    ht_built_ = true;
+    LOG_TRACE("group join hash table built", K(group_entries_.count()), K(bucket_num_),
+              K(group_store_.get_mem_used()));
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::add_build_batch(const ObBatchRows &brs)
+{
+  int ret = OB_SUCCESS;
+  ObBatchRows key_brs;
+  int64_t stored_cnt = 0;
+  clear_evaluated_flag();
+  if (OB_FAIL(calc_hash_values(MY_SPEC.build_keys_, brs, *key_skip_))) {
+    LOG_WARN("calc build hash values failed", K(ret));
+  } else if (FALSE_IT(key_brs.size_ = brs.size_)) {
+  } else if (FALSE_IT(key_brs.skip_ = key_skip_)) {
+  } else if (OB_FAIL(group_store_.add_batch(MY_SPEC.build_keys_, eval_ctx_, key_brs, stored_cnt,
+                                            stored_rows_))) {
+    LOG_WARN("add build rows failed", K(ret));
+  } else {
+    GroupEntry entry;
+    for (int64_t i = 0, j = 0; OB_SUCC(ret) && i < brs.size_; i++) {
+      if (key_skip_->at(i)) {
+        continue;
+      } else if (OB_UNLIKELY(j >= stored_cnt)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected stored rows count", K(ret), K(j), K(stored_cnt));
+      } else {
+        entry.hash_ = hash_vals_[i];
+        entry.row_ = stored_rows_[j++];
+        if (OB_FAIL(aggr_processor_.add_one_aggregate_row(
+                      get_aggr_row(entry.row_), aggr_processor_.get_aggregate_row_size(),
+                      false /*push_agg_row*/))) {
+          LOG_WARN("init aggregate row failed", K(ret));
+        } else if (OB_FAIL(group_entries_.push_back(entry))) {
+          LOG_WARN("push back group entry failed", K(ret));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::insert_group_entry(GroupEntry &entry)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t mask = bucket_num_ - 1;
+  bool inserted = false;
+  for (uint64_t pos = entry.hash_ & mask; OB_SUCC(ret) && !inserted; pos = (pos + 1) & mask) {
+    GroupEntry *&bucket = buckets_[pos];
+    bool is_same = false;
+    if (nullptr == bucket) {
+      bucket = &entry;
+      inserted = true;
+    } else if (bucket->hash_ != entry.hash_) {
+    } else if (OB_FAIL(is_same_group(*bucket->row_, *entry.row_, is_same))) {
+      LOG_WARN("compare group rows failed", K(ret));
+    } else if (OB_UNLIKELY(is_same)) {
+      // build keys are unique, guaranteed by optimizer
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("duplicate build key in group join", K(ret), K(entry), KPC(bucket));
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::is_same_group(const ObCompactRow &l, const ObCompactRow &r,
+                                        bool &is_same) const
+{
+  int ret = OB_SUCCESS;
+  const RowMeta &row_meta = group_store_.get_row_meta();
+  is_same = true;
+  for (int64_t i = 0; OB_SUCC(ret) && is_same && i < MY_SPEC.build_keys_.count(); i++) {
+    const ObExpr *expr = MY_SPEC.build_keys_.at(i);
+    const char *l_v = nullptr;
+    const char *r_v = nullptr;
+    ObLength l_len = 0;
+    ObLength r_len = 0;
+    int cmp_ret = 0;
+    l.get_cell_payload(row_meta, i, l_v, l_len);
+    r.get_cell_payload(row_meta, i, r_v, r_len);
+    if (OB_FAIL(expr->basic_funcs_->row_null_first_cmp_(expr->obj_meta_, expr->obj_meta_,
+                                                        l_v, l_len, l.is_null(i),
+                                                        r_v, r_len, r.is_null(i), cmp_ret))) {
+      LOG_WARN("compare failed", K(ret), K(i));
+    } else {
+      is_same = (0 == cmp_ret);
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::find_group(const int64_t batch_idx, const uint64_t hash_val,
+                                     GroupEntry *&entry) const
+{
+  int ret = OB_SUCCESS;
+  const RowMeta &row_meta = group_store_.get_row_meta();
+  const uint64_t mask = bucket_num_ - 1;
+  entry = nullptr;
+  bool stop = false;
+  for (uint64_t pos = hash_val & mask; OB_SUCC(ret) && !stop; pos = (pos + 1) & mask) {
+    GroupEntry *bucket = buckets_[pos];
+    if (nullptr == bucket) {
+      stop = true;
+    } else if (bucket->hash_ == hash_val) {
+      bool is_same = true;
+      for (int64_t i = 0; OB_SUCC(ret) && is_same && i < MY_SPEC.probe_keys_.count(); i++) {
+        const ObExpr *expr = MY_SPEC.probe_keys_.at(i);
+        const char *payload = nullptr;
+        ObLength len = 0;
+        int cmp_ret = 0;
+        bucket->row_->get_cell_payload(row_meta, i, payload, len);
+        if (OB_FAIL(expr->get_vector(eval_ctx_)->null_first_cmp(*expr, batch_idx, false, payload,
+                                                                len, cmp_ret))) {
+          LOG_WARN("compare failed", K(ret), K(i), K(batch_idx));
+        } else {
+          is_same = (0 == cmp_ret);
+        }
+      }
+      if (OB_SUCC(ret) && is_same) {
+        entry = bucket;
+        stop = true;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::probe_and_aggregate()
+{
+  int ret = OB_SUCCESS;
+  const ObBatchRows *child_brs = nullptr;
+  while (OB_SUCC(ret) && !probe_end_) {
+    if (OB_FAIL(right_->get_next_batch(MY_SPEC.max_batch_size_, child_brs))) {
+      LOG_WARN("get probe side batch failed", K(ret));
+    } else if (child_brs->size_ > 0 && !group_entries_.empty()
+               && OB_FAIL(probe_batch(*child_brs))) {
+      LOG_WARN("probe batch failed", K(ret));
+    } else if (OB_FAIL(try_check_status())) {
+      LOG_WARN("check status failed", K(ret));
+    } else {
+      probe_end_ = child_brs->end_ || group_entries_.empty();
+    }
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::probe_batch(const ObBatchRows &brs)
+{
+  int ret = OB_SUCCESS;
+  int64_t matched_cnt = 0;
+  clear_evaluated_flag();
+  if (OB_FAIL(calc_hash_values(MY_SPEC.probe_keys_, brs, *key_skip_))) {
+    LOG_WARN("calc probe hash values failed", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < brs.size_; i++) {
+    GroupEntry *entry = nullptr;
+    batch_aggr_rows_[i] = nullptr;
+    if (key_skip_->at(i)) {
+    } else if (OB_FAIL(find_group(i, hash_vals_[i], entry))) {
+      LOG_WARN("find group failed", K(ret), K(i));
+    } else if (nullptr != entry) {
+      entry->matched_ = true;
+      batch_aggr_rows_[i] = get_aggr_row(entry->row_);
+      matched_cnt++;
+    }
+  }
+  if (OB_FAIL(ret) || 0 == matched_cnt) {
+  } else if (OB_FAIL(aggr_processor_.eval_aggr_param_batch(brs))) {
+    LOG_WARN("eval aggregate params failed", K(ret));
+  } else if (OB_FAIL(aggr_processor_.add_batch_for_multi_groups(
+               0, MY_SPEC.aggr_infos_.count(), batch_aggr_rows_, brs.size_))) {
+    LOG_WARN("aggregate probe rows failed", K(ret));
+  }
+  if (OB_SUCC(ret)) {
+    probe_row_cnt_ += brs.size_;
+    matched_row_cnt_ += matched_cnt;
+  }
+  return ret;
+}
+
+int ObHashGroupJoinVecOp::output_groups(const int64_t max_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  int64_t cnt = 0;
+  while (cnt < max_row_cnt && cur_group_idx_ < group_entries_.count()) {
+    const GroupEntry &entry = group_entries_.at(cur_group_idx_++);
+    if (entry.matched_) {
+      output_rows_[cnt++] = entry.row_;
+    }
+  }
+  clear_evaluated_flag();
+  brs_.size_ = 0;
+  brs_.skip_->reset(max_row_cnt);
+  if (cnt > 0 && OB_FAIL(aggr_processor_.collect_group_results(group_store_.get_row_meta(),
+                                                               MY_SPEC.build_keys_, cnt,
+                                                               output_rows_, brs_))) {
+    LOG_WARN("collect group results failed", K(ret), K(cnt));
+  } else {
+    brs_.all_rows_active_ = true;
+    brs_.end_ = (cur_group_idx_ >= group_entries_.count());
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_BASIC_OB_HASH_GROUP_JOIN_VEC_OP_H_
+#define OCEANBASE_BASIC_OB_HASH_GROUP_JOIN_VEC_OP_H_
+
+#include "sql/engine/aggregate/ob_groupby_vec_op.h"
+#include "sql/engine/basic/ob_temp_row_store.h"
+#include "sql/engine/ob_sql_mem_mgr_processor.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Hash group join: GROUP BY over an inner hash join whose group exprs are exactly the
+// unique build side join keys. The group rows are the build side hash table entries,
+// probe rows are aggregated into the matched entry directly, so neither the join result
+// nor a second hash table is materialized.
+//
+//   left child  (build) : evaluates build_keys_ (== group exprs)
+//   right child (probe) : evaluates probe_keys_ and aggregate params
+class ObHashGroupJoinVecSpec : public ObGroupBySpec
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  ObHashGroupJoinVecSpec(common::ObIAllocator &alloc, const ObPhyOperatorType type)
+    : ObGroupBySpec(alloc, type),
+      build_keys_(alloc), probe_keys_(alloc), est_group_cnt_(0)
+  {
+  }
+
+  DECLARE_VIRTUAL_TO_STRING;
+  inline void set_est_group_cnt(const int64_t cnt) { est_group_cnt_ = cnt; }
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObHashGroupJoinVecSpec);
+
+public:
+  ExprFixedArray build_keys_;
+  ExprFixedArray probe_keys_;
+  int64_t est_group_cnt_;
+};
+
+class ObHashGroupJoinVecOp : public ObGroupByVecOp
+{
+public:
+  struct GroupEntry
+  {
+    GroupEntry() : hash_(0), row_(nullptr), matched_(false) {}
+    uint64_t hash_;
+    ObCompactRow *row_;
+    // inner join semantic: the group without any matched probe row is not output
+    bool matched_;
+    TO_STRING_KV(K_(hash), KP_(row), K_(matched));
+  };
+  static const uint64_t HASH_SEED = 99194853094755497L;
+  static const int64_t MIN_BUCKET_NUM = 1024;
+
+  ObHashGroupJoinVecOp(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput *input);
+  virtual ~ObHashGroupJoinVecOp() {}
+
+  virtual int inner_open() override;
+  virtual int inner_rescan() override;
+  virtual int inner_switch_iterator() override;
+  virtual int inner_close() override;
+  virtual void destroy() override;
+  virtual int inner_get_next_row() override { return common::OB_NOT_IMPLEMENT; }
+  virtual int inner_get_next_batch(const int64_t max_row_cnt) override;
+
+private:
+  void reset(const bool for_rescan);
+  int init_mem_context();
+  int init_batch_buffers();
+  int init_sql_mem_processor();
+  // the build side can not be dumped, fail the query once it exceeds the work area bound
+  int check_mem_bound();
+  inline int64_t get_mem_used_size() const
+  { return nullptr == mem_context_ ? 0 : mem_context_->used(); }
+  int calc_hash_values(const ExprFixedArray &keys, const ObBatchRows &brs, ObBitVector &skip);
+  int build_hash_table();
+  int add_build_batch(const ObBatchRows &brs);
+  int insert_group_entry(GroupEntry &entry);
+  int probe_and_aggregate();
+  int probe_batch(const ObBatchRows &brs);
+  int find_group(const int64_t batch_idx, const uint64_t hash_val, GroupEntry *&entry) const;
+  int is_same_group(const ObCompactRow &l, const ObCompactRow &r, bool &is_same) const;
+  int output_groups(const int64_t max_row_cnt);
+  inline char *get_aggr_row(ObCompactRow *row) const
+  {
+    return static_cast<char *>(row->get_extra_payload(group_store_.get_row_meta()));
+  }
+
+private:
+  lib::MemoryContext mem_context_;
+  ObSqlWorkAreaProfile profile_;
+  ObSqlMemMgrProcessor sql_mem_processor_;
+  // build side rows, each row is (build keys + aggregate row), also the group row.
+  ObTempRowStore group_store_;
+  common::ObArray<GroupEntry> group_entries_;
+  // open addressing buckets point to %group_entries_, built after the build side is drained
+  GroupEntry **buckets_;
+  int64_t bucket_num_;
+  uint64_t *hash_vals_;
+  ObBitVector *key_skip_;
+  ObCompactRow **stored_rows_;
+  aggregate::AggrRowPtr *batch_aggr_rows_;
+  const ObCompactRow **output_rows_;
+  int64_t cur_group_idx_;
+  int64_t probe_row_cnt_;
+  int64_t matched_row_cnt_;
+  bool ht_built_;
+  bool probe_end_;
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_BASIC_OB_HASH_GROUP_JOIN_VEC_OP_H_
@@ -2205,6 +2205,58 @@ int ObBlackFilterExecutor::judge_greater_or_less(
   return ret;
 }
 
+bool ObBlackFilterExecutor::has_bloom_runtime_filter() const
+{
+  bool bool_ret = false;
+  if (1 == filter_.column_exprs_.count() && nullptr != filter_.column_exprs_.at(0)) {
+    const ObExpr &column_expr = *filter_.column_exprs_.at(0);
+    for (int64_t i = 0; !bool_ret && i < filter_.filter_exprs_.count(); ++i) {
+      const ObExpr *expr = filter_.filter_exprs_.at(i);
+      bool_ret = nullptr != expr && ObExprJoinFilter::is_key_range_applicable(*expr, column_expr);
+    }
+  }
+  return bool_ret;
+}
+
+int ObBlackFilterExecutor::check_runtime_filter_key_range(
+    const blocksstable::ObStorageDatum &min_datum,
+    const blocksstable::ObStorageDatum &max_datum,
+    ObBoolMask &bool_mask)
+{
+  int ret = OB_SUCCESS;
+  bool_mask.set_uncertain();
+  ObEvalCtx &eval_ctx = op_.get_eval_ctx();
+  const ObExpr *column_expr = filter_.column_exprs_.count() == 1 ? filter_.column_exprs_.at(0) : nullptr;
+  ObDatum min_val;
+  ObDatum max_val;
+  if (min_datum.is_null() || max_datum.is_null()) {
+  } else if (OB_ISNULL(column_expr)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected column exprs", K(ret), K_(filter));
+  } else if (OB_FAIL(min_val.from_storage_datum(min_datum, column_expr->obj_datum_map_))) {
+    LOG_WARN("Failed to convert from datum", K(ret), K(min_datum));
+  } else if (OB_FAIL(max_val.from_storage_datum(max_datum, column_expr->obj_datum_map_))) {
+    LOG_WARN("Failed to convert from datum", K(ret), K(max_datum));
+  } else {
+    bool is_disjoint = false;
+    // filter exprs are combined by AND, any disjoint bloom filter falsifies the block
+    for (int64_t i = 0; OB_SUCC(ret) && !is_disjoint && i < filter_.filter_exprs_.count(); ++i) {
+      const ObExpr *expr = filter_.filter_exprs_.at(i);
+      if (OB_ISNULL(expr) || !ObExprJoinFilter::is_key_range_applicable(*expr, *column_expr)) {
+      } else if (OB_FAIL(ObExprJoinFilter::check_key_range_disjoint(*expr, *column_expr,
+                                                                     eval_ctx,
+                                                                     min_val, max_val,
+                                                                     is_disjoint))) {
+        LOG_WARN("Failed to check key range of runtime filter", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && is_disjoint) {
+      bool_mask.set_always_false();
+    }
+  }
+  return ret;
+}
+
 int ObBlackFilterExecutor::get_datums_from_column(common::ObIArray<blocksstable::ObSqlDatumInfo> &datum_infos)
 {
   int ret = OB_SUCCESS;
@@ -831,6 +831,13 @@ public:
                                    bool &ret_val);
   OB_INLINE bool is_monotonic() const { return filter_.is_monotonic(); }
   OB_INLINE PushdownFilterMonotonicity get_monotonicity() const { return filter_.mono_; }
+  // bloom runtime filter carries the join key range, blocks out of the range can be skipped
+  // by skip index even though the filter is not monotonic. Only applies when the probe key
+  // is the filter column itself, otherwise the block is left uncertain.
+  bool has_bloom_runtime_filter() const;
+  int check_runtime_filter_key_range(const blocksstable::ObStorageDatum &min_datum,
+                                     const blocksstable::ObStorageDatum &max_datum,
+                                     ObBoolMask &bool_mask);
 private:
   int eval_exprs_batch(ObBitVector &skip, const int64_t bsize);
 
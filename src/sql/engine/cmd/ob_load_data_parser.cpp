@@ -23,6 +23,11 @@
 #include "share/ob_encryption_util.h"
 #endif
 #include "lib/utility/ob_print_utils.h"
+#include "common/ob_target_specific.h"
+
+#if OB_USE_MULTITARGET_CODE
+#include <immintrin.h>
+#endif
 
 using namespace oceanbase::sql;
 using namespace oceanbase::common;
@@ -33,6 +38,29 @@ namespace sql
 {
 const char INVALID_TERM_CHAR = '\xff';
 
+OB_DECLARE_AVX2_SPECIFIC_CODE(
+inline const char *skip_plain_chars(const char *str, const char *end, const char *structural_chars)
+{
+  const __m256i c0 = _mm256_set1_epi8(structural_chars[0]);
+  const __m256i c1 = _mm256_set1_epi8(structural_chars[1]);
+  const __m256i c2 = _mm256_set1_epi8(structural_chars[2]);
+  const __m256i c3 = _mm256_set1_epi8(structural_chars[3]);
+  while (end - str >= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str));
+    const __m256i cmp = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, c0), _mm256_cmpeq_epi8(block, c1)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, c2), _mm256_cmpeq_epi8(block, c3)));
+    // the sign bit of non-ascii byte is set, stop at it as well as at structural chars
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(cmp, block)));
+    if (0 != mask) {
+      return str + __builtin_ctz(mask);
+    }
+    str += 32;
+  }
+  return str;
+}
+)
+
 const char * ObExternalFileFormat::FORMAT_TYPE_STR[] = {
   "CSV",
   "PARQUET",
@@ -404,6 +432,17 @@ int ObCSVGeneralParser::init_opt_variables()
         && !opt_param_.is_same_escape_enclosed_
         && format_.field_enclosed_char_ == INT64_MAX;
 
+    opt_param_.structural_chars_[0] = opt_param_.field_term_c_;
+    opt_param_.structural_chars_[1] = opt_param_.line_term_c_;
+    opt_param_.structural_chars_[2] = format_.field_escaped_char_ == INT64_MAX
+        ? opt_param_.field_term_c_ : static_cast<char>(format_.field_escaped_char_);
+    opt_param_.structural_chars_[3] = format_.field_enclosed_char_ == INT64_MAX
+        ? opt_param_.field_term_c_ : static_cast<char>(format_.field_enclosed_char_);
+#if OB_USE_MULTITARGET_CODE
+    opt_param_.is_structural_scan_ = common::is_arch_supported(ObTargetArch::AVX2);
+#else
+    opt_param_.is_structural_scan_ = false;
+#endif
   }
 
   if (OB_SUCC(ret) && OB_FAIL(fields_per_line_.prepare_allocate(format_.file_column_nums_))) {
@@ -412,6 +451,14 @@ int ObCSVGeneralParser::init_opt_variables()
   return ret;
 }
 
+const char *ObCSVGeneralParser::skip_plain_chars(const char *str, const char *end) const
+{
+#if OB_USE_MULTITARGET_CODE
+  str = specific::avx2::skip_plain_chars(str, end, opt_param_.structural_chars_);
+#endif
+  return str;
+}
+
 int ObCSVGeneralParser::handle_irregular_line(int field_idx, int line_no,
                                               ObIArray<LineErrRec> &errors)
 {
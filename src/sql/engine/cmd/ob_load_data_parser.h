@@ -174,18 +174,25 @@ public:
     TO_STRING_KV(KP(ptr_), K(len_), K(flags_), "string", common::ObString(len_, ptr_));
   };
   struct OptParams {
+    static const int64_t STRUCTURAL_CHAR_CNT = 4;
     OptParams() : line_term_c_(0), field_term_c_(0),
       is_filling_zero_to_empty_field_(false),
       is_line_term_by_counting_field_(false),
       is_same_escape_enclosed_(false),
-      is_simple_format_(false)
-    {}
+      is_simple_format_(false),
+      is_structural_scan_(false)
+    {
+      MEMSET(structural_chars_, 0, sizeof(structural_chars_));
+    }
     char line_term_c_;
     char field_term_c_;
     bool is_filling_zero_to_empty_field_;
     bool is_line_term_by_counting_field_;
     bool is_same_escape_enclosed_;
     bool is_simple_format_;
+    // skip plain chars of field by simd, structural chars are the chars need to be checked one by one
+    bool is_structural_scan_;
+    char structural_chars_[STRUCTURAL_CHAR_CNT];
   };
 public:
   ObCSVGeneralParser() {}
@@ -256,6 +263,13 @@ private:
     return 1;
   }
 
+  /**
+   * @brief return the first structural char or non-ascii byte in [str, end),
+   *        the bytes before it are single byte chars in all supported charsets,
+   *        so they can be skipped without calling mbcharlen one by one
+   */
+  const char *skip_plain_chars(const char *str, const char *end) const;
+
   int handle_irregular_line(int field_idx,
                             int line_no,
                             common::ObIArray<LineErrRec> &errors);
@@ -492,6 +506,9 @@ int ObCSVGeneralParser::scan_proto(const char *&str,
           if (!is_term) {
             int mb_len = mbcharlen<cs_type>(str, end);
             str += mb_len;
+            if (opt_param_.is_structural_scan_) {
+              str = skip_plain_chars(str, end);
+            }
           }
         }
       }
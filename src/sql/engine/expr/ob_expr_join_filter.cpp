@@ -16,6 +16,7 @@
 #include "sql/session/ob_sql_session_info.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/engine/px/p2p_datahub/ob_p2p_dh_mgr.h"
+#include "sql/engine/px/p2p_datahub/ob_runtime_filter_msg.h"
 
 
 using namespace oceanbase::share;
@@ -258,6 +259,35 @@ int ObExprJoinFilter::prepare_storage_white_filter_data(const ObExpr &expr,
   return ret;
 }
 
+int ObExprJoinFilter::check_key_range_disjoint(const ObExpr &expr,
+                                               const ObExpr &column_expr,
+                                               ObEvalCtx &eval_ctx,
+                                               const ObDatum &min_datum,
+                                               const ObDatum &max_datum,
+                                               bool &is_disjoint)
+{
+  int ret = OB_SUCCESS;
+  is_disjoint = false;
+  ObExecContext &exec_ctx = eval_ctx.exec_ctx_;
+  ObExprJoinFilterContext *join_filter_ctx = NULL;
+  if (!is_key_range_applicable(expr, column_expr)) {
+    // probe key is an expression of the column, the min/max of column says nothing
+  } else if (OB_ISNULL(join_filter_ctx = static_cast<ObExprJoinFilterContext *>(
+          exec_ctx.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+    // join filter ctx may be null in das.
+  } else if (OB_FAIL(check_rf_ready(exec_ctx, join_filter_ctx))) {
+    LOG_WARN("fail to check bf ready", K(ret));
+  } else if (OB_ISNULL(join_filter_ctx->rf_msg_) || !join_filter_ctx->is_ready_) {
+  } else if (ObP2PDatahubMsgBase::BLOOM_FILTER_VEC_MSG
+             != join_filter_ctx->rf_msg_->get_msg_type()) {
+  } else if (OB_FAIL(static_cast<ObRFBloomFilterMsg *>(join_filter_ctx->rf_msg_)
+                     ->check_key_range_disjoint(column_expr.datum_meta_,
+                                                min_datum, max_datum, is_disjoint))) {
+    LOG_WARN("fail to check key range", K(ret));
+  }
+  return ret;
+}
+
 int ObExprJoinFilter::eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res)
 {
   return eval_filter_internal(expr, ctx, res);
@@ -186,6 +186,25 @@ public:
       ObEvalCtx &eval_ctx,
       ObRuntimeFilterParams &params,
       bool &is_data_prepared);
+  static inline bool is_bloom_filter_expr(const ObExpr &expr)
+  {
+    return T_OP_RUNTIME_FILTER == expr.type_ && eval_bloom_filter == expr.eval_func_;
+  }
+  // the key range of bloom filter can be compared with the min/max of a column only if
+  // the probe key is the column itself, not an expression or an implicit cast of it
+  static inline bool is_key_range_applicable(const ObExpr &expr, const ObExpr &column_expr)
+  {
+    return is_bloom_filter_expr(expr) && 1 == expr.arg_cnt_ && &column_expr == expr.args_[0];
+  }
+  // check whether [min_datum, max_datum] of probe column is disjoint with the join key
+  // range carried by bloom filter msg, used by storage to skip blocks
+  static int check_key_range_disjoint(
+      const ObExpr &expr,
+      const ObExpr &column_expr,
+      ObEvalCtx &eval_ctx,
+      const ObDatum &min_datum,
+      const ObDatum &max_datum,
+      bool &is_disjoint);
 private:
   static int check_rf_ready(
     ObExecContext &exec_ctx,
@@ -56,7 +56,8 @@ OB_SERIALIZE_MEMBER(ObJoinFilterRuntimeConfig,
     runtime_filter_max_in_num_,
     runtime_bloom_filter_max_size_,
     px_message_compression_,
-    build_send_opt_);
+    build_send_opt_,
+    bloom_filter_key_range_);
 
 OB_SERIALIZE_MEMBER(ObRuntimeFilterInfo,
                     filter_expr_id_,
@@ -222,6 +223,9 @@ int ObJoinFilterOpInput::load_runtime_config(const ObJoinFilterSpec &spec, ObExe
   config_.runtime_bloom_filter_max_size_ = ctx.get_my_session()->
       get_runtime_bloom_filter_max_size();
   config_.px_message_compression_ = true;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  config_.bloom_filter_key_range_ = tenant_config.is_valid()
+                                    && tenant_config->_px_bloom_filter_key_range;
   LOG_TRACE("load runtime filter config", K(spec.get_id()), K(config_));
   return ret;
 }
@@ -335,12 +339,29 @@ int ObJoinFilterOpInput::construct_msg_details(
       if (spec.use_realistic_runtime_bloom_filter_size()) {
         bf_msg.set_use_hash_join_seed(true);
       }
+      // only single key without null safe equal can be used to skip blocks,
+      // multi keys are hashed together and the range of each key is meaningless
+      if (config.bloom_filter_key_range_
+          && 1 == spec.join_keys_.count()
+          && 1 == spec.rf_build_cmp_infos_.count()
+          && 1 == spec.rf_probe_cmp_infos_.count()
+          && (spec.need_null_cmp_flags_.empty() || !spec.need_null_cmp_flags_.at(0))) {
+        if (OB_ISNULL(spec.join_keys_.at(0))) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("join key is null", K(ret));
+        } else if (OB_FAIL(bf_msg.init_key_range(spec.rf_build_cmp_infos_.at(0),
+                                                 spec.rf_probe_cmp_infos_.at(0),
+                                                 spec.join_keys_.at(0)->datum_meta_))) {
+          LOG_WARN("failed to init key range", K(ret));
+        }
+      }
     }
     case ObP2PDatahubMsgBase::BLOOM_FILTER_MSG: {
       ObSArray<ObAddr> *target_addrs = nullptr;
       ObRFBloomFilterMsg &bf_msg = static_cast<ObRFBloomFilterMsg &>(msg);
       ObPxSQCProxy::SQCP2PDhMap &dh_map = sqc_proxy->get_p2p_dh_map();
-      if (OB_FAIL(bf_msg.bloom_filter_.init(estimated_rows,
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(bf_msg.bloom_filter_.init(estimated_rows,
           bf_msg.get_allocator(),
           bf_msg.get_tenant_id(),
           config.bloom_filter_ratio_,
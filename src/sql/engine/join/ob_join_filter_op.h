@@ -83,7 +83,8 @@ struct ObJoinFilterRuntimeConfig
 public:
   TO_STRING_KV(K_(bloom_filter_ratio), K_(each_group_size), K_(bf_piece_size),
                K_(runtime_filter_wait_time_ms), K_(runtime_filter_max_in_num),
-               K_(runtime_bloom_filter_max_size), K_(px_message_compression));
+               K_(runtime_bloom_filter_max_size), K_(px_message_compression),
+               K_(bloom_filter_key_range));
 public:
   ObJoinFilterRuntimeConfig() :
       bloom_filter_ratio_(0.0),
@@ -93,7 +94,8 @@ public:
       runtime_filter_max_in_num_(0),
       runtime_bloom_filter_max_size_(0),
       px_message_compression_(false),
-      build_send_opt_{false} {}
+      build_send_opt_{false},
+      bloom_filter_key_range_(false) {}
   double bloom_filter_ratio_;
   int64_t each_group_size_;
   int64_t bf_piece_size_; // how many int64_t a piece bloom filter contains
@@ -102,6 +104,8 @@ public:
   int64_t runtime_bloom_filter_max_size_;
   bool px_message_compression_;
   bool build_send_opt_;
+  // bloom filter msg carries the min/max of join key for storage block skipping
+  bool bloom_filter_key_range_;
 };
 
 class ObJoinFilterOpInput : public ObOpInput
@@ -168,6 +168,7 @@
 #include "sql/engine/basic/ob_stat_collector_op.h"
 #include "sql/engine/opt_statistics/ob_optimizer_stats_gathering_op.h"
 #include "sql/engine/aggregate/ob_hash_groupby_vec_op.h"
+#include "sql/engine/aggregate/ob_hash_group_join_vec_op.h"
 #include "sql/engine/aggregate/ob_hash_distinct_vec_op.h"
 #include "sql/engine/aggregate/ob_scalar_aggregate_vec_op.h"
 #include "sql/engine/basic/ob_temp_table_insert_vec_op.h"
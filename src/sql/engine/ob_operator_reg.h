@@ -535,6 +535,12 @@ REGISTER_OPERATOR(ObLogGroupBy, PHY_HASH_GROUP_BY, ObHashGroupBySpec,
 REGISTER_OPERATOR(ObLogGroupBy, PHY_VEC_HASH_GROUP_BY, ObHashGroupByVecSpec,
                   ObHashGroupByVecOp, NOINPUT, VECTORIZED_OP, 0, SUPPORT_RICH_FORMAT);
 
+class ObLogGroupJoin;
+class ObHashGroupJoinVecSpec;
+class ObHashGroupJoinVecOp;
+REGISTER_OPERATOR(ObLogGroupJoin, PHY_VEC_HASH_GROUP_JOIN, ObHashGroupJoinVecSpec,
+                  ObHashGroupJoinVecOp, NOINPUT, VECTORIZED_OP, 0, SUPPORT_RICH_FORMAT);
+
 class ObLogWindowFunction;
 class ObWindowFunctionSpec;
 class ObWindowFunctionOp;
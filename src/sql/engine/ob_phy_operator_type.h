@@ -141,6 +141,7 @@ PHY_OP_DEF(PHY_VEC_HASH_EXCEPT)
 PHY_OP_DEF(PHY_VEC_WINDOW_FUNCTION)
 PHY_OP_DEF(PHY_VEC_MERGE_GROUP_BY)
 PHY_OP_DEF(PHY_VEC_MERGE_JOIN)
+PHY_OP_DEF(PHY_VEC_HASH_GROUP_JOIN)
 PHY_OP_DEF(PHY_END)
 #endif /*PHY_OP_DEF*/
 
@@ -24,6 +24,7 @@
 #include "sql/engine/aggregate/ob_merge_groupby_op.h"
 #include "sql/engine/aggregate/ob_merge_groupby_vec_op.h"
 #include "share/detect/ob_detect_manager_utils.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include <unordered_set>
 
 namespace oceanbase
@@ -142,6 +143,7 @@ ObPxTransmitOp::ObPxTransmitOp(ObExecContext &exec_ctx, const ObOpSpec &spec, Ob
   batch_param_remain_(false),
   receive_channel_ready_(false),
   data_msg_type_(dtl::ObDtlMsgType::PX_DATUM_ROW),
+  local_columnar_exchange_(false),
   params_(px_row_allocator_)
 {
   MEMSET(rand48_buf_, 0, sizeof(rand48_buf_));
@@ -234,6 +236,20 @@ int ObPxTransmitOp::inner_open()
         for (int64_t i = 0; i < task_channels_.count(); ++i) {
           task_channels_.at(i)->set_send_buffer_size(size_per_buffer);
         }
+      } else if (dtl::ObDtlMsgType::PX_VECTOR == data_msg_type_ && local_columnar_exchange_) {
+        bool all_local = true;
+        for (int64_t i = 0; all_local && i < task_channels_.count(); ++i) {
+          all_local = ObDtlChannel::DtlChannelType::LOCAL_CHANNEL
+                      == task_channels_.at(i)->get_channel_type();
+        }
+        if (!all_local) {
+          // rpc channels keep the row layout, the columnar buffer is only handed over locally.
+          data_msg_type_ = dtl::ObDtlMsgType::PX_VECTOR_ROW;
+          local_columnar_exchange_ = false;
+        }
+        for (int64_t i = 0; local_columnar_exchange_ && i < task_channels_.count(); ++i) {
+          static_cast<ObDtlBasicChannel *> (task_channels_.at(i))->set_local_columnar_exchange(true);
+        }
       }
       if (OB_FAIL(params_.init_keep_order_params(get_spec().max_batch_size_,
                                                  task_channels_.count(),
@@ -413,6 +429,8 @@ int ObPxTransmitOp::init_channel(ObPxTransmitOpInput &trans_input)
         ch->set_enable_channel_sync(true);
         ch->set_batch_id(px_batch_id);
         ch->set_compression_type(dfc_.get_compressor_type());
+        ch->set_vector_encode(dfc_.enable_vector_encode()
+                              && dtl::ObDtlMsgType::PX_VECTOR_FIXED == data_msg_type_);
         ch->set_operator_owner();
         ch->set_thread_id(thread_id);
         ch->set_row_meta(params_.meta_);
@@ -1427,7 +1445,7 @@ int ObPxTransmitOp::send_row(int64_t slice_idx,
           break;
         }
         case dtl::ObDtlMsgType::PX_VECTOR: {
-          if (is_rpc_channel) {
+          if (is_rpc_channel || channel->is_local_columnar_exchange()) {
             is_send_row_normal = true;
           } else {
             ObDtlVectorRowMsgWriter &row_writer = channel->get_vector_row_writer();
@@ -1783,10 +1801,21 @@ void ObPxTransmitOp::init_data_msg_type(const common::ObIArray<ObExpr *> &output
       all_fixed = false;
     }
   }
+  bool local_columnar = false;
+  local_columnar_exchange_ = false;
+  if (!all_fixed) {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    local_columnar = tenant_config.is_valid() && tenant_config->_px_local_columnar_exchange;
+  }
   if (col_cnt > ObDtlVectorsBuffer::MAX_COL_CNT) {
     data_msg_type_ = dtl::ObDtlMsgType::PX_VECTOR_ROW;
   } else if (all_fixed) {
     data_msg_type_ = dtl::ObDtlMsgType::PX_VECTOR_FIXED;
+  } else if (local_columnar) {
+    // local channel hands over columnar buffers, see ObDtlLocalChannel::compact_vector_buffer.
+    // fall back to PX_VECTOR_ROW in inner_open if any channel is a rpc channel.
+    data_msg_type_ = dtl::ObDtlMsgType::PX_VECTOR;
+    local_columnar_exchange_ = true;
   } else {
     data_msg_type_ = dtl::ObDtlMsgType::PX_VECTOR_ROW;
   }
@@ -1799,6 +1828,7 @@ void ObPxTransmitOp::init_data_msg_type(const common::ObIArray<ObExpr *> &output
     } else if (3 == std::abs(err_sim)) {
       data_msg_type_ = dtl::ObDtlMsgType::PX_VECTOR;
     }
+    local_columnar_exchange_ = false;
   }
 }
 
@@ -1859,6 +1889,7 @@ int ObPxTransmitOp::hash_reorder_send_batch(ObEvalCtx::BatchInfoScopeGuard &batc
         }
         break;
       }
+      case dtl::ObDtlMsgType::PX_VECTOR:
       case dtl::ObDtlMsgType::PX_VECTOR_ROW: {
         for (int64_t channel_idx = 0; OB_SUCC(ret) && channel_idx < task_channels_.count(); ++channel_idx) {
           if (0 == params_.slice_bkt_item_cnts_[channel_idx]) {
@@ -1870,7 +1901,9 @@ int ObPxTransmitOp::hash_reorder_send_batch(ObEvalCtx::BatchInfoScopeGuard &batc
           bool is_rpc_channel = channel->get_channel_type()
                                 == ObDtlChannel::DtlChannelType::RPC_CHANNEL;
           ObDtlVectorRowMsgWriter &row_writer = channel->get_vector_row_writer();
-          if (!row_writer.is_inited() || (data_msg_type_ == dtl::ObDtlMsgType::PX_VECTOR && is_rpc_channel)) {
+          if (!row_writer.is_inited()
+              || (data_msg_type_ == dtl::ObDtlMsgType::PX_VECTOR
+                  && (is_rpc_channel || channel->is_local_columnar_exchange()))) {
             is_send_row_normal = true;
           } else if (OB_FAIL(row_writer.try_append_batch(spec.output_, params_.vectors_,
                                                         eval_ctx_, params_.slice_info_bkts_[channel_idx],
@@ -234,6 +234,8 @@ protected:
   unsigned short rand48_buf_[3];
   bool receive_channel_ready_;
   dtl::ObDtlMsgType data_msg_type_;
+  // PX_VECTOR is chosen by _px_local_columnar_exchange, only used if all channels are local.
+  bool local_columnar_exchange_;
   //slice_idx, batch_idx
   struct VectorSendParams {
     VectorSendParams(common::ObIAllocator &alloc) : slice_info_bkts_(nullptr),
@@ -42,7 +42,13 @@ OB_DEF_SERIALIZE(ObRFBloomFilterMsg)
               expect_first_phase_count_,
               piece_size_,
               use_rich_format_,
-              use_hash_join_seed_);
+              use_hash_join_seed_,
+              track_key_range_,
+              key_lower_bound_,
+              key_upper_bound_,
+              build_key_cmp_info_,
+              probe_key_cmp_info_,
+              build_key_meta_);
   return ret;
 }
 
@@ -60,7 +66,16 @@ OB_DEF_DESERIALIZE(ObRFBloomFilterMsg)
               expect_first_phase_count_,
               piece_size_,
               use_rich_format_,
-              use_hash_join_seed_);
+              use_hash_join_seed_,
+              track_key_range_,
+              key_lower_bound_,
+              key_upper_bound_,
+              build_key_cmp_info_,
+              probe_key_cmp_info_,
+              build_key_meta_);
+  // key bounds point to the rpc buffer, never write through them
+  key_lower_buf_size_ = 0;
+  key_upper_buf_size_ = 0;
   return ret;
 }
 
@@ -75,7 +90,13 @@ OB_DEF_SERIALIZE_SIZE(ObRFBloomFilterMsg)
               expect_first_phase_count_,
               piece_size_,
               use_rich_format_,
-              use_hash_join_seed_);
+              use_hash_join_seed_,
+              track_key_range_,
+              key_lower_bound_,
+              key_upper_bound_,
+              build_key_cmp_info_,
+              probe_key_cmp_info_,
+              build_key_meta_);
   return len;
 }
 
@@ -319,6 +340,8 @@ int ObRFBloomFilterMsg::reuse()
   is_empty_ = true;
   bloom_filter_.reset_filter();
   need_send_msg_ = true;
+  key_lower_bound_.set_null();
+  key_upper_bound_.set_null();
   return ret;
 }
 
@@ -443,6 +466,8 @@ int ObRFBloomFilterMsg::assign(const ObP2PDatahubMsgBase &msg)
   use_hash_join_seed_ = other_msg.use_hash_join_seed_;
   if (OB_FAIL(ObP2PDatahubMsgBase::assign(msg))) {
     LOG_WARN("failed to assign base data", K(ret));
+  } else if (OB_FAIL(assign_key_range(other_msg))) {
+    LOG_WARN("fail to assign key range", K(ret));
   } else if (OB_FAIL(next_peer_addrs_.assign(other_msg.next_peer_addrs_))) {
     LOG_WARN("fail to assign bf msg", K(ret));
   } else if (OB_FAIL(bloom_filter_.assign(other_msg.bloom_filter_, msg.get_tenant_id()))) {
@@ -473,12 +498,190 @@ int ObRFBloomFilterMsg::shadow_copy(const ObRFBloomFilterMsg &other_msg)
   use_hash_join_seed_ = other_msg.use_hash_join_seed_;
   if (OB_FAIL(ObP2PDatahubMsgBase::assign(other_msg))) {
     LOG_WARN("failed to assign base data", K(ret));
+  } else if (OB_FAIL(assign_key_range(other_msg))) {
+    LOG_WARN("fail to assign key range", K(ret));
   } else if (OB_FAIL(bloom_filter_.init(&other_msg.bloom_filter_))) {
     LOG_WARN("fail to assign bf msg", K(ret));
   }
   return ret;
 }
 
+int ObRFBloomFilterMsg::assign_key_range(const ObRFBloomFilterMsg &other_msg)
+{
+  int ret = OB_SUCCESS;
+  ObSpinLockGuard guard(other_msg.lock_);
+  track_key_range_ = other_msg.track_key_range_;
+  build_key_cmp_info_ = other_msg.build_key_cmp_info_;
+  probe_key_cmp_info_ = other_msg.probe_key_cmp_info_;
+  build_key_meta_ = other_msg.build_key_meta_;
+  key_lower_bound_.set_null();
+  key_upper_bound_.set_null();
+  if (!track_key_range_) {
+  } else if (OB_FAIL(copy_key_bound(other_msg.key_lower_bound_, key_lower_bound_,
+                                    key_lower_buf_size_))) {
+    LOG_WARN("fail to copy key lower bound", K(ret));
+  } else if (OB_FAIL(copy_key_bound(other_msg.key_upper_bound_, key_upper_bound_,
+                                    key_upper_buf_size_))) {
+    LOG_WARN("fail to copy key upper bound", K(ret));
+  }
+  return ret;
+}
+
+int ObRFBloomFilterMsg::init_key_range(const ObRFCmpInfo &build_cmp_info,
+                                       const ObRFCmpInfo &probe_cmp_info,
+                                       const ObDatumMeta &build_key_meta)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(build_cmp_info.cmp_func_) || OB_ISNULL(probe_cmp_info.cmp_func_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid cmp func", K(ret));
+  } else {
+    build_key_cmp_info_ = build_cmp_info;
+    probe_key_cmp_info_ = probe_cmp_info;
+    build_key_meta_ = build_key_meta;
+    key_lower_bound_.set_null();
+    key_upper_bound_.set_null();
+    track_key_range_ = true;
+  }
+  return ret;
+}
+
+int ObRFBloomFilterMsg::copy_key_bound(const ObDatum &src, ObDatum &target, int64_t &buf_size)
+{
+  int ret = OB_SUCCESS;
+  if (src.is_null()) {
+    target.set_null();
+  } else if (src.len_ > buf_size) {
+    int64_t need_size = src.len_ * 2;
+    char *buf = nullptr;
+    if (OB_ISNULL(buf = static_cast<char *>(allocator_.alloc(need_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc key bound", K(ret), K(need_size));
+    } else {
+      MEMCPY(buf, src.ptr_, src.len_);
+      target.pack_ = src.pack_;
+      target.ptr_ = buf;
+      buf_size = need_size;
+    }
+  } else {
+    MEMCPY(const_cast<char *>(target.ptr_), src.ptr_, src.len_);
+    target.pack_ = src.pack_;
+  }
+  return ret;
+}
+
+// the caller must hold lock_
+int ObRFBloomFilterMsg::merge_key_range(const ObDatum &lower, const ObDatum &upper)
+{
+  int ret = OB_SUCCESS;
+  int cmp = 0;
+  const ObRFCmpInfo &cmp_info = build_key_cmp_info_;
+  if (lower.is_null() || upper.is_null()) {
+  } else if (key_lower_bound_.is_null()) {
+    if (OB_FAIL(copy_key_bound(lower, key_lower_bound_, key_lower_buf_size_))) {
+      LOG_WARN("fail to copy key lower bound", K(ret));
+    } else if (OB_FAIL(copy_key_bound(upper, key_upper_bound_, key_upper_buf_size_))) {
+      LOG_WARN("fail to copy key upper bound", K(ret));
+    }
+  } else if (OB_FAIL(cmp_info.cmp_func_(cmp_info.obj_meta_, cmp_info.obj_meta_,
+      key_lower_bound_.ptr_, key_lower_bound_.len_, false,
+      lower.ptr_, lower.len_, false, cmp))) {
+    LOG_WARN("fail to cmp key lower bound", K(ret));
+  } else if (cmp > 0 && OB_FAIL(copy_key_bound(lower, key_lower_bound_, key_lower_buf_size_))) {
+    LOG_WARN("fail to copy key lower bound", K(ret));
+  } else if (OB_FAIL(cmp_info.cmp_func_(cmp_info.obj_meta_, cmp_info.obj_meta_,
+      key_upper_bound_.ptr_, key_upper_bound_.len_, false,
+      upper.ptr_, upper.len_, false, cmp))) {
+    LOG_WARN("fail to cmp key upper bound", K(ret));
+  } else if (cmp < 0 && OB_FAIL(copy_key_bound(upper, key_upper_bound_, key_upper_buf_size_))) {
+    LOG_WARN("fail to copy key upper bound", K(ret));
+  }
+  return ret;
+}
+
+int ObRFBloomFilterMsg::update_key_range(const ObExpr &key_expr,
+                                         const ObBatchRows &child_brs,
+                                         ObEvalCtx &eval_ctx)
+{
+  int ret = OB_SUCCESS;
+  ObIVector *key_vec = key_expr.get_vector(eval_ctx);
+  const ObRFCmpInfo &cmp_info = build_key_cmp_info_;
+  ObDatum batch_lower;
+  ObDatum batch_upper;
+  ObDatum cur;
+  bool has_value = false;
+  int cmp = 0;
+  batch_lower.set_null();
+  batch_upper.set_null();
+  for (int64_t i = 0; OB_SUCC(ret) && i < child_brs.size_; ++i) {
+    if (child_brs.skip_->at(i) || key_vec->is_null(i)) {
+      continue;
+    }
+    cur.ptr_ = key_vec->get_payload(i);
+    cur.pack_ = key_vec->get_length(i);
+    if (!has_value) {
+      batch_lower = cur;
+      batch_upper = cur;
+      has_value = true;
+    } else if (OB_FAIL(cmp_info.cmp_func_(cmp_info.obj_meta_, cmp_info.obj_meta_,
+        cur.ptr_, cur.len_, false, batch_lower.ptr_, batch_lower.len_, false, cmp))) {
+      LOG_WARN("fail to cmp key", K(ret));
+    } else if (cmp < 0) {
+      batch_lower = cur;
+    } else if (OB_FAIL(cmp_info.cmp_func_(cmp_info.obj_meta_, cmp_info.obj_meta_,
+        cur.ptr_, cur.len_, false, batch_upper.ptr_, batch_upper.len_, false, cmp))) {
+      LOG_WARN("fail to cmp key", K(ret));
+    } else if (cmp > 0) {
+      batch_upper = cur;
+    }
+  }
+  if (OB_SUCC(ret) && has_value) {
+    // shared bloom filter msg is inserted by several threads concurrently
+    ObSpinLockGuard guard(lock_);
+    if (OB_FAIL(merge_key_range(batch_lower, batch_upper))) {
+      LOG_WARN("fail to merge key range", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObRFBloomFilterMsg::check_key_range_disjoint(const ObDatumMeta &probe_meta,
+                                                 const ObDatum &min_datum,
+                                                 const ObDatum &max_datum,
+                                                 bool &is_disjoint)
+{
+  int ret = OB_SUCCESS;
+  int cmp = 0;
+  is_disjoint = false;
+  const ObRFCmpInfo &probe_info = probe_key_cmp_info_;
+  const ObRFCmpInfo &build_info = build_key_cmp_info_;
+  if (!track_key_range_ || min_datum.is_null() || max_datum.is_null()) {
+  } else if (probe_meta.type_ != build_key_meta_.type_
+             || probe_meta.cs_type_ != build_key_meta_.cs_type_
+             || probe_meta.scale_ != build_key_meta_.scale_
+             || probe_meta.precision_ != build_key_meta_.precision_) {
+    // the block min/max is in the layout of probe column, the bounds are compared
+    // only if both sides have exactly the same meta, e.g. decimal int of different
+    // precision has different width, leave the block uncertain otherwise.
+  } else if (is_empty_) {
+    is_disjoint = true;
+  } else if (key_lower_bound_.is_null() || key_upper_bound_.is_null()) {
+  } else if (OB_FAIL(probe_info.cmp_func_(probe_info.obj_meta_, build_info.obj_meta_,
+      max_datum.ptr_, max_datum.len_, false,
+      key_lower_bound_.ptr_, key_lower_bound_.len_, false, cmp))) {
+    LOG_WARN("fail to cmp with key lower bound", K(ret));
+  } else if (cmp < 0) {
+    is_disjoint = true;
+  } else if (OB_FAIL(probe_info.cmp_func_(probe_info.obj_meta_, build_info.obj_meta_,
+      min_datum.ptr_, min_datum.len_, false,
+      key_upper_bound_.ptr_, key_upper_bound_.len_, false, cmp))) {
+    LOG_WARN("fail to cmp with key upper bound", K(ret));
+  } else if (cmp > 0) {
+    is_disjoint = true;
+  }
+  return ret;
+}
+
 int ObRFBloomFilterMsg::regenerate()
 {
   int ret = OB_SUCCESS;
@@ -519,6 +722,14 @@ int ObRFBloomFilterMsg::merge(ObP2PDatahubMsgBase &msg)
   } else if (OB_FAIL(bloom_filter_.merge_filter(&bf_msg.bloom_filter_))) {
     LOG_WARN("fail to merge bloom filter msg", K(ret));
   } else {
+    if (track_key_range_) {
+      ObSpinLockGuard guard(lock_);
+      if (!bf_msg.track_key_range_) {
+        track_key_range_ = false;
+      } else if (OB_FAIL(merge_key_range(bf_msg.key_lower_bound_, bf_msg.key_upper_bound_))) {
+        LOG_WARN("fail to merge key range", K(ret));
+      }
+    }
     is_empty_ = false;
   }
   return ret;
@@ -690,6 +901,8 @@ int ObRFBloomFilterMsg::insert_by_row_batch(
   uint64_t *batch_hash_values)
 {
   int ret = OB_SUCCESS;
+  // key range is only maintained in vectorized insert
+  track_key_range_ = false;
   if (child_brs->size_ > 0) {
     uint64_t seed = ObExprJoinFilter::JOIN_FILTER_SEED;
     if (OB_NOT_NULL(calc_tablet_id_expr)) {
@@ -753,6 +966,7 @@ int ObRFBloomFilterMsg::insert_by_row(
   int ret = OB_SUCCESS;
   uint64_t hash_value = 0;
   bool ignore = false;
+  track_key_range_ = false;
   if (OB_FAIL(calc_hash_value(expr_array,
     hash_funcs, calc_tablet_id_expr,
     eval_ctx, hash_value, ignore))) {
@@ -938,6 +1152,8 @@ int ObRFBloomFilterMsg::insert_bloom_filter_with_hash_values(
 {
   int ret = OB_SUCCESS;
   EvalBound bound(child_brs->size_, child_brs->all_rows_active_);
+  // join keys are not available here, key range can not be maintained
+  track_key_range_ = false;
   if (OB_FAIL(bloom_filter_.put_batch(batch_hash_values, bound, *child_brs->skip_, is_empty_))) {
     LOG_WARN("failed to push hash value to px bloom filter");
   }
@@ -957,6 +1173,7 @@ int ObRFBloomFilterMsg::insert_by_row_vector(
     uint64_t seed = ObExprJoinFilter::JOIN_FILTER_SEED;
     EvalBound bound(child_brs->size_, child_brs->all_rows_active_);
     if (OB_NOT_NULL(calc_tablet_id_expr)) {
+      track_key_range_ = false;
       if (hash_funcs.count() != 1) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unexpected part id expr", K(ret));
@@ -1001,6 +1218,9 @@ int ObRFBloomFilterMsg::insert_by_row_vector(
       if (OB_FAIL(ret)) {
       } else if (OB_FAIL(bloom_filter_.put_batch(batch_hash_values, bound, *child_brs->skip_, is_empty_))) {
         LOG_WARN("failed to push hash value to px bloom filter");
+      } else if (track_key_range_
+                 && OB_FAIL(update_key_range(*expr_array.at(0), *child_brs, eval_ctx))) {
+        LOG_WARN("failed to update key range", K(ret));
       }
     }
   }
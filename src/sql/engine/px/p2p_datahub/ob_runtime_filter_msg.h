@@ -18,6 +18,7 @@
 #include "sql/engine/px/ob_px_bloom_filter.h"
 #include "sql/engine/px/p2p_datahub/ob_p2p_dh_msg.h"
 #include "sql/engine/px/p2p_datahub/ob_runtime_filter_query_range.h"
+#include "sql/engine/px/p2p_datahub/ob_runtime_filter_vec_msg.h"
 
 
 namespace oceanbase
@@ -40,7 +41,9 @@ public:
       next_peer_addrs_(allocator_), expect_first_phase_count_(0),
       piece_size_(0), filter_indexes_(allocator_), receive_count_array_(allocator_),
       filter_idx_(0), create_finish_(false), need_send_msg_(true), is_finish_regen_(false),
-      use_rich_format_(false) {}
+      use_rich_format_(false), track_key_range_(false), key_lower_bound_(nullptr, 0, true),
+      key_upper_bound_(nullptr, 0, true), key_lower_buf_size_(0), key_upper_buf_size_(0),
+      build_key_cmp_info_(), probe_key_cmp_info_(), build_key_meta_() {}
   ~ObRFBloomFilterMsg() { destroy(); }
   virtual int assign(const ObP2PDatahubMsgBase &) final;
   virtual int merge(ObP2PDatahubMsgBase &) final;
@@ -102,6 +105,16 @@ public:
 
   inline void set_use_hash_join_seed(bool value) { use_hash_join_seed_ = value; }
   inline bool use_hash_join_seed() const { return use_hash_join_seed_; }
+
+  // besides the bloom filter, the msg tracks the min/max of the single join key,
+  // storage use it to skip macro/micro blocks by skip index before probing rows.
+  int init_key_range(const ObRFCmpInfo &build_cmp_info, const ObRFCmpInfo &probe_cmp_info,
+                     const ObDatumMeta &build_key_meta);
+  inline bool has_key_range() const { return track_key_range_; }
+  // %min_datum and %max_datum are the min/max value of probe column in a block,
+  // %probe_meta is the datum meta of the probe column
+  int check_key_range_disjoint(const ObDatumMeta &probe_meta, const ObDatum &min_datum,
+                               const ObDatum &max_datum, bool &is_disjoint);
 private:
   int calc_hash_value(
       const common::ObIArray<ObExpr *> &expr_array,
@@ -123,6 +136,10 @@ private:
   template <VectorFormat ResFormat, typename ResVec>
   int fill_vec_result(ResVec *res_vec, const ObBitVector &skip, const EvalBound &bound,
                       uint64_t *hash_values, int64_t &total_count, int64_t &filter_count);
+  int update_key_range(const ObExpr &key_expr, const ObBatchRows &child_brs, ObEvalCtx &eval_ctx);
+  int merge_key_range(const ObDatum &lower, const ObDatum &upper);
+  int copy_key_bound(const ObDatum &src, ObDatum &target, int64_t &buf_size);
+  int assign_key_range(const ObRFBloomFilterMsg &other_msg);
 
 public:
   ObSendBFPhase phase_;
@@ -138,6 +155,15 @@ public:
   bool is_finish_regen_;
   bool use_rich_format_;
   bool use_hash_join_seed_ {false};
+  // key range is valid only if every piece merged into the msg tracked it
+  bool track_key_range_;
+  ObDatum key_lower_bound_;
+  ObDatum key_upper_bound_;
+  int64_t key_lower_buf_size_;
+  int64_t key_upper_buf_size_;
+  ObRFCmpInfo build_key_cmp_info_;
+  ObRFCmpInfo probe_key_cmp_info_;
+  ObDatumMeta build_key_meta_;
 };
 
 class ObRFRangeFilterMsg : public ObP2PDatahubMsgBase
@@ -102,7 +102,7 @@ CompareBase::CompareBase(ObIAllocator &allocator) :
   allocator_(allocator), ret_(OB_SUCCESS), cmp_sk_exprs_(nullptr), sk_row_meta_(nullptr),
   addon_row_meta_(nullptr), cmp_sort_collations_(nullptr), sk_col_result_list_(nullptr),
   cmp_funcs_(allocator), exec_ctx_(nullptr), encode_sk_state_(CompareBase::DISABLE), cmp_count_(0),
-  cmp_start_(0), cmp_end_(0), cnt_(0)
+  cmp_start_(0), cmp_end_(0), cnt_(0), check_status_(true)
 {}
 
 CompareBase::~CompareBase()
@@ -158,7 +158,7 @@ int CompareBase::init(const ObIArray<ObExpr *> *cmp_sk_exprs, const RowMeta *sk_
 int CompareBase::fast_check_status()
 {
   int ret = OB_SUCCESS;
-  if (OB_UNLIKELY((cmp_count_++ & 8191) == 8191)) {
+  if (OB_UNLIKELY((cmp_count_++ & 8191) == 8191) && check_status_) {
     ret = exec_ctx_->check_status();
   }
   return ret;
@@ -96,6 +96,11 @@ public:
   {
     encode_sk_state_ = CompareBase::FALLBACK_TO_DISABLE;
   }
+  // for comparators used by parallel sort threads, which can not access exec ctx
+  void disable_check_status()
+  {
+    check_status_ = false;
+  }
 
 protected:
   int init_cmp_sort_key(const ObIArray<ObExpr *> *cmp_sk_exprs,
@@ -116,6 +121,7 @@ public:
   int64_t cmp_start_;
   int64_t cmp_end_;
   int64_t cnt_;
+  bool check_status_;
 };
 
 template <typename Store_Row, bool has_addon>
@@ -412,6 +412,14 @@ int ObSortVecOp::init_sort(int64_t tenant_id, int64_t row_count, int64_t topn_cn
   context.enable_pd_topn_filter_ = MY_SPEC.enable_pd_topn_filter();
   context.pd_topn_filter_info_ = &MY_SPEC.pd_topn_filter_info_;
   context.op_ = this;
+  if (nullptr == ctx_.get_sqc_handler()) {
+    // only sort above the PX coordinator or in serial plans can use extra threads,
+    // sort in PX workers is already parallelized by DFO.
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id));
+    if (tenant_config.is_valid()) {
+      context.inmem_sort_parallel_degree_ = tenant_config->_sort_inmem_parallel_degree;
+    }
+  }
   if (MY_SPEC.prefix_pos_ > 0) {
     context.prefix_pos_ = MY_SPEC.prefix_pos_;
     context.sort_row_cnt_ = &sort_row_count_;
@@ -25,11 +25,13 @@ struct ObSortVecOpContext
     tenant_id_(UINT64_MAX), sk_exprs_(nullptr), addon_exprs_(nullptr), sk_collations_(nullptr),
     base_sk_collations_(nullptr), addon_collations_(nullptr), eval_ctx_(nullptr),
     exec_ctx_(nullptr), op_(nullptr), prefix_pos_(0), part_cnt_(0), topn_cnt_(INT64_MAX),
-    sort_row_cnt_(nullptr), flag_(0), compress_type_(NONE_COMPRESSOR)
+    sort_row_cnt_(nullptr), flag_(0), compress_type_(NONE_COMPRESSOR),
+    inmem_sort_parallel_degree_(1)
   {}
   TO_STRING_KV(K_(tenant_id), KP_(sk_exprs), KP_(addon_exprs), KP_(sk_collations),
                KP_(base_sk_collations), KP_(addon_collations), K_(prefix_pos), K_(part_cnt),
-               K_(topn_cnt), KP_(sort_row_cnt), K_(flag), K_(compress_type));
+               K_(topn_cnt), KP_(sort_row_cnt), K_(flag), K_(compress_type),
+               K_(inmem_sort_parallel_degree));
 
   uint64_t tenant_id_;
   const ObIArray<ObExpr *> *sk_exprs_;
@@ -60,6 +62,8 @@ struct ObSortVecOpContext
   };
   ObCompressorType compress_type_;
   const ObPushDownTopNFilterInfo *pd_topn_filter_info_;
+  // max threads used to sort in-memory rows, 1 means sort in the operator thread only
+  int64_t inmem_sort_parallel_degree_;
 };
 
 } // end namespace sql
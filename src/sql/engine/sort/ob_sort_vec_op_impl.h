@@ -25,6 +25,7 @@
 #include "sql/engine/sort/ob_sort_key_fetcher_vec_op.h"
 #include "sql/engine/sort/ob_sort_vec_op_eager_filter.h"
 #include "sql/engine/sort/ob_sort_vec_op_store_row_factory.h"
+#include "sql/engine/sort/ob_sort_vec_op_parallel_sorter.h"
 #include "sql/engine/expr/ob_array_expr_utils.h"
 #include "observer/omt/ob_tenant_config_mgr.h"
 #include "sql/engine/sort/ob_pd_topn_sort_filter.h"
@@ -44,6 +45,7 @@ template <typename Compare, typename Store_Row, bool has_addon>
 class ObSortVecOpImpl : public ObISortVecOpImpl
 {
   using SortVecOpChunk = ObSortVecOpChunk<Store_Row, has_addon>;
+  using ParallelSorter = ObSortVecOpParallelSorter<Compare, Store_Row>;
 
 public:
   explicit ObSortVecOpImpl(ObMonitorNode &op_monitor_info, lib::MemoryContext &mem_context) :
@@ -63,7 +65,8 @@ public:
     ties_array_pos_(0), ties_array_(), sorted_dumped_rows_ptrs_(), last_ties_row_(nullptr), rows_(nullptr),
     sort_exprs_getter_(allocator_),
     store_row_factory_(allocator_, sql_mem_processor_, sk_row_meta_, addon_row_meta_, inmem_row_size_, topn_cnt_),
-    topn_filter_(nullptr), is_topn_filter_enabled_(false), compress_type_(NONE_COMPRESSOR)
+    topn_filter_(nullptr), is_topn_filter_enabled_(false), compress_type_(NONE_COMPRESSOR),
+    inmem_sort_parallel_degree_(1), parallel_sorter_(nullptr)
   {}
   virtual ~ObSortVecOpImpl()
   {
@@ -188,6 +191,9 @@ public:
 protected:
   typedef int (ObSortVecOpImpl::*NextStoredRowFunc)(const Store_Row *&sr);
   int sort_inmem_data();
+  // sort rows_[begin, end) with multiple threads, fallback to single thread sort if rows
+  // are too few to split.
+  int parallel_sort_inmem_data(const int64_t begin, const int64_t end);
   int do_dump();
   int build_ems_heap(int64_t &merge_ways);
   template <typename Heap, typename NextFunc, typename Item>
@@ -479,6 +485,8 @@ protected:
   bool is_topn_filter_enabled_;
   ObCompressorType compress_type_;
   ObPushDownTopNFilter pd_topn_filter_;
+  int64_t inmem_sort_parallel_degree_;
+  ParallelSorter *parallel_sorter_;
 };
 
 } // end namespace sql
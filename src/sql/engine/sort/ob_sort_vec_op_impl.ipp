@@ -74,6 +74,11 @@ void ObSortVecOpImpl<Compare, Store_Row, has_addon>::reset()
       mem_context_->get_malloc_allocator().free(part_hash_nodes_);
       part_hash_nodes_ = nullptr;
     }
+    if (nullptr != parallel_sorter_) {
+      parallel_sorter_->~ParallelSorter();
+      mem_context_->get_malloc_allocator().free(parallel_sorter_);
+      parallel_sorter_ = nullptr;
+    }
     if (nullptr != topn_filter_) {
       topn_filter_->reset();
       mem_context_->get_malloc_allocator().free(topn_filter_);
@@ -285,6 +290,7 @@ int ObSortVecOpImpl<Compare, Store_Row, has_addon>::init(ObSortVecOpContext &ctx
     use_heap_sort_ = is_topn_sort();
     is_fetch_with_ties_ = ctx.is_fetch_with_ties_;
     compress_type_ = ctx.compress_type_;
+    inmem_sort_parallel_degree_ = ctx.inmem_sort_parallel_degree_;
     page_allocator_.set_allocator(&mem_context_->get_malloc_allocator());
     int64_t batch_size = eval_ctx_->max_batch_size_;
     if (OB_FAIL(merge_sk_addon_exprs(sk_exprs_, addon_exprs_))) {
@@ -1483,6 +1489,8 @@ int ObSortVecOpImpl<Compare, Store_Row, has_addon>::sort_inmem_data()
           comp_.fallback_to_disable_encode_sortkey();
           lib::ob_sort(&rows_->at(begin), &rows_->at(0) + rows_->count(), CopyableComparer(comp_));
         }
+      } else if (inmem_sort_parallel_degree_ > 1 && !use_heap_sort_) {
+        OZ(parallel_sort_inmem_data(begin, rows_->count()));
       } else {
         lib::ob_sort(&rows_->at(begin), &rows_->at(0) + rows_->count(), CopyableComparer(comp_));
       }
@@ -1542,6 +1550,61 @@ int ObSortVecOpImpl<Compare, Store_Row, has_addon>::sort_inmem_data()
   return ret;
 }
 
+template <typename Compare, typename Store_Row, bool has_addon>
+int ObSortVecOpImpl<Compare, Store_Row, has_addon>::parallel_sort_inmem_data(const int64_t begin,
+                                                                              const int64_t end)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = end - begin;
+  const int64_t merge_buf_size = ParallelSorter::get_merge_buf_size(row_cnt);
+  int64_t run_cnt = ParallelSorter::get_run_cnt(inmem_sort_parallel_degree_, row_cnt);
+  ObSortVecOpParallelWorkers workers;
+  Store_Row **merged_rows = nullptr;
+  if (run_cnt > 1 && mem_context_->used() + merge_buf_size > profile_.get_max_bound()) {
+    // no memory for the merge buffer, the sort is usually triggered by dump here.
+    run_cnt = 1;
+  }
+  if (run_cnt <= 1) {
+  } else if (OB_FAIL(workers.acquire(run_cnt - 1))) {
+    SQL_ENG_LOG(WARN, "failed to acquire sort workers", K(ret), K(run_cnt));
+  } else {
+    run_cnt = workers.get_acquired_cnt() + 1;
+  }
+  if (OB_FAIL(ret)) {
+  } else if (run_cnt <= 1) {
+    lib::ob_sort(&rows_->at(begin), &rows_->at(0) + end, CopyableComparer(comp_));
+  } else {
+    if (nullptr != parallel_sorter_) {
+      parallel_sorter_->reset();
+    } else if (OB_ISNULL(parallel_sorter_ = OB_NEWx(ParallelSorter,
+                                                    (&mem_context_->get_malloc_allocator()),
+                                                    mem_context_->get_malloc_allocator()))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SQL_ENG_LOG(WARN, "allocate memory failed", K(ret));
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_ISNULL(merged_rows = static_cast<Store_Row **>(
+                           mem_context_->get_malloc_allocator().alloc(merge_buf_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SQL_ENG_LOG(WARN, "allocate memory failed", K(ret), K(merge_buf_size));
+    } else if (FALSE_IT(sql_mem_processor_.alloc(merge_buf_size))) {
+    } else if (OB_FAIL(parallel_sorter_->init(run_cnt, comp_))) {
+      SQL_ENG_LOG(WARN, "failed to init parallel sorter", K(ret), K(run_cnt));
+    } else if (OB_FAIL(parallel_sorter_->sort(&rows_->at(begin), row_cnt, merged_rows, comp_,
+                                              workers))) {
+      SQL_ENG_LOG(WARN, "failed to do parallel sort", K(ret), K(run_cnt), K(begin), K(end));
+    } else {
+      LOG_TRACE("parallel in-memory sort", K(run_cnt), K(begin), K(end));
+    }
+    if (nullptr != merged_rows) {
+      sql_mem_processor_.alloc(-1 * merge_buf_size);
+      mem_context_->get_malloc_allocator().free(merged_rows);
+      merged_rows = nullptr;
+    }
+  }
+  return ret;
+}
+
 template <typename Compare, typename Store_Row, bool has_addon>
 int ObSortVecOpImpl<Compare, Store_Row, has_addon>::do_dump()
 {
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/sort/ob_sort_vec_op_parallel_sorter.h"
+#include "lib/worker.h"
+#include "observer/omt/ob_tenant.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase {
+using namespace common;
+namespace sql {
+
+ObSortVecOpParallelWorkers::ObSortVecOpParallelWorkers() :
+  pools_(nullptr), pool_(nullptr), acquired_cnt_(0), submitted_cnt_(0), finished_cnt_(0),
+  task_ret_(OB_SUCCESS), cond_()
+{}
+
+ObSortVecOpParallelWorkers::~ObSortVecOpParallelWorkers()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(wait())) {
+    LOG_WARN("sort task failed", K(ret));
+  }
+  release();
+  cond_.destroy();
+}
+
+int ObSortVecOpParallelWorkers::acquire(const int64_t max_cnt)
+{
+  int ret = OB_SUCCESS;
+  omt::ObPxPools *pools = nullptr;
+  omt::ObPxPool *pool = nullptr;
+  if (OB_UNLIKELY(nullptr != pools_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("acquire twice", K(ret), K(acquired_cnt_));
+  } else if (max_cnt <= 0 || nullptr == MTL_CTX()) {
+    // run all tasks by the caller thread
+  } else if (OB_ISNULL(pools = MTL(omt::ObPxPools *))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("px pools is null", K(ret));
+  } else if (OB_FAIL(pools->get_or_create(THIS_WORKER.get_group_id(), pool))) {
+    LOG_WARN("failed to get px pool", K(ret), K(THIS_WORKER.get_group_id()));
+  } else if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    LOG_WARN("failed to init cond", K(ret));
+  } else {
+    const int64_t limit = std::max(1L, static_cast<int64_t>(MTL_CPU_COUNT()));
+    acquired_cnt_ = pools->acquire_helper_threads(max_cnt, limit);
+    pools_ = pools;
+    pool_ = pool;
+  }
+  return ret;
+}
+
+int ObSortVecOpParallelWorkers::submit(const int64_t task_idx, const TaskFunc &func)
+{
+  int ret = OB_SUCCESS;
+  bool submitted = false;
+  if (submitted_cnt_ < acquired_cnt_ && nullptr != pool_) {
+    const uint64_t tenant_id = MTL_ID();
+    const bool is_oracle_mode = lib::is_oracle_mode();
+    const ObCurTraceId::TraceId trace_id = *ObCurTraceId::get_trace_id();
+    auto pool_task = [this, task_idx, func, tenant_id, is_oracle_mode, trace_id](bool need_exec) {
+      int ret = OB_SUCCESS;
+      ObCurTraceId::set(trace_id);
+      if (!need_exec) {
+        ret = OB_CANCELED;
+        LOG_WARN("px pool already stopped, sort task is not executed", K(ret), K(task_idx));
+      } else {
+        lib::CompatModeGuard mode_guard(is_oracle_mode ? lib::Worker::CompatMode::ORACLE
+                                                       : lib::Worker::CompatMode::MYSQL);
+        MTL_SWITCH(tenant_id) {
+          ret = func(task_idx);
+        }
+      }
+      finish_task(ret);
+    };
+    {
+      ObThreadCondGuard guard(cond_);
+      submitted_cnt_++;
+    }
+    // the pool is extended if it has no idle thread, which is bounded by the acquired count.
+    for (int64_t retry = 0; !submitted && retry < MAX_SUBMIT_RETRY_TIMES; retry++) {
+      int tmp_ret = pool_->submit(pool_task);
+      if (OB_SUCCESS == tmp_ret) {
+        submitted = true;
+      } else if (OB_SIZE_OVERFLOW != tmp_ret) {
+        LOG_WARN("failed to submit sort task to px pool", K(tmp_ret), K(task_idx));
+        break;
+      } else if (OB_SUCCESS != (tmp_ret = pool_->inc_thread_count(1))) {
+        LOG_WARN("failed to increase px pool thread count", K(tmp_ret), K(task_idx));
+        break;
+      }
+    }
+    if (!submitted) {
+      ObThreadCondGuard guard(cond_);
+      submitted_cnt_--;
+    }
+  }
+  if (!submitted) {
+    ret = func(task_idx);
+  }
+  return ret;
+}
+
+void ObSortVecOpParallelWorkers::finish_task(const int task_ret)
+{
+  ObThreadCondGuard guard(cond_);
+  if (OB_SUCCESS == task_ret_) {
+    task_ret_ = task_ret;
+  }
+  finished_cnt_++;
+  cond_.broadcast();
+}
+
+int ObSortVecOpParallelWorkers::wait()
+{
+  int ret = OB_SUCCESS;
+  if (nullptr != pool_) {
+    ObThreadCondGuard guard(cond_);
+    while (finished_cnt_ < submitted_cnt_) {
+      cond_.wait_us(WAIT_INTERVAL_US);
+    }
+    ret = task_ret_;
+  }
+  return ret;
+}
+
+void ObSortVecOpParallelWorkers::release()
+{
+  if (nullptr != pools_) {
+    pools_->release_helper_threads(acquired_cnt_);
+  }
+  pools_ = nullptr;
+  pool_ = nullptr;
+  acquired_cnt_ = 0;
+  submitted_cnt_ = 0;
+  finished_cnt_ = 0;
+  task_ret_ = OB_SUCCESS;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,331 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_SORT_SORT_VEC_OP_PARALLEL_SORTER_H_
+#define OCEANBASE_SQL_ENGINE_SORT_SORT_VEC_OP_PARALLEL_SORTER_H_
+
+#include <functional>
+#include "lib/container/ob_loser_tree.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/utility/ob_sort.h"
+
+namespace oceanbase {
+namespace omt {
+class ObPxPools;
+class ObPxPool;
+}
+namespace sql {
+
+// Threads borrowed from the tenant PX pool for the parallel in-memory sort.
+// The number of borrowed threads of the whole tenant is bounded by the tenant cpu count,
+// tasks beyond the acquired threads are run by the caller thread.
+class ObSortVecOpParallelWorkers
+{
+public:
+  typedef std::function<int (const int64_t)> TaskFunc;
+
+  ObSortVecOpParallelWorkers();
+  ~ObSortVecOpParallelWorkers();
+  // acquire at most %max_cnt threads, no thread is acquired outside of tenant context.
+  int acquire(const int64_t max_cnt);
+  int64_t get_acquired_cnt() const { return acquired_cnt_; }
+  // run %func(task_idx) on an acquired thread, or on the caller thread if all acquired
+  // threads are in use.
+  int submit(const int64_t task_idx, const TaskFunc &func);
+  // wait all submitted tasks and return the first error of them.
+  int wait();
+
+private:
+  static const int64_t MAX_SUBMIT_RETRY_TIMES = 3;
+  static const int64_t WAIT_INTERVAL_US = 10 * 1000;
+  void finish_task(const int task_ret);
+  // threads are given back after all submitted tasks finished.
+  void release();
+
+private:
+  omt::ObPxPools *pools_;
+  omt::ObPxPool *pool_;
+  int64_t acquired_cnt_;
+  int64_t submitted_cnt_;
+  int64_t finished_cnt_;
+  int task_ret_;
+  common::ObThreadCond cond_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObSortVecOpParallelWorkers);
+};
+
+// Intra-operator parallel in-memory sort.
+// The rows array is cut into %degree runs, run 0 is sorted by the caller (which keeps
+// checking the query status), the others are sorted by threads of ObSortVecOpParallelWorkers
+// with their own comparators. Sorted runs are k-way merged with ObLoserTree afterwards.
+template <typename Compare, typename Store_Row>
+class ObSortVecOpParallelSorter
+{
+public:
+  static const int64_t MAX_SORT_THREAD_CNT = 64;
+  static const int64_t MIN_ROWS_PER_RUN = 64 * 1024;
+
+  explicit ObSortVecOpParallelSorter(common::ObIAllocator &allocator) :
+    allocator_(allocator), degree_(0), comps_(nullptr), run_rets_(nullptr),
+    rows_(nullptr), row_cnt_(0)
+  {}
+  ~ObSortVecOpParallelSorter()
+  {
+    reset();
+  }
+  void reset()
+  {
+    if (nullptr != comps_) {
+      for (int64_t i = 0; i < degree_; i++) {
+        if (nullptr != comps_[i]) {
+          comps_[i]->~Compare();
+          allocator_.free(comps_[i]);
+          comps_[i] = nullptr;
+        }
+      }
+      allocator_.free(comps_);
+      comps_ = nullptr;
+    }
+    if (nullptr != run_rets_) {
+      allocator_.free(run_rets_);
+      run_rets_ = nullptr;
+    }
+    degree_ = 0;
+    rows_ = nullptr;
+    row_cnt_ = 0;
+  }
+  static int64_t get_run_cnt(const int64_t degree, const int64_t row_cnt)
+  {
+    return std::min(std::min(degree, static_cast<int64_t>(MAX_SORT_THREAD_CNT)),
+                    row_cnt / MIN_ROWS_PER_RUN);
+  }
+  // %comp is the initialized comparator of the sort operator, per thread comparators are
+  // built with the same sort keys and collations.
+  int init(const int64_t degree, Compare &comp);
+  // sort %rows[0, row_cnt) in place, %comp is used by the caller thread.
+  // %merged_rows is the buffer of the merge, which holds %row_cnt row pointers.
+  int sort(Store_Row **rows, const int64_t row_cnt, Store_Row **merged_rows, Compare &comp,
+           ObSortVecOpParallelWorkers &workers);
+  static int64_t get_merge_buf_size(const int64_t row_cnt)
+  {
+    return static_cast<int64_t>(sizeof(Store_Row *)) * row_cnt;
+  }
+
+private:
+  struct RunItem
+  {
+    Store_Row *row_;
+    int64_t run_idx_;
+    TO_STRING_KV(KP_(row), K_(run_idx));
+  };
+  struct RunItemCmp
+  {
+    explicit RunItemCmp(Compare &comp) : comp_(comp) {}
+    // compare once, draw is not distinguished since the champion is never checked to be unique.
+    int cmp(const RunItem &l, const RunItem &r, int64_t &cmp_ret)
+    {
+      cmp_ret = comp_(l.row_, r.row_) ? -1 : 1;
+      return comp_.ret_;
+    }
+    Compare &comp_;
+  };
+  typedef common::ObLoserTree<RunItem, RunItemCmp, MAX_SORT_THREAD_CNT> RunMerger;
+
+  OB_INLINE int64_t run_begin(const int64_t run_idx) const
+  {
+    return row_cnt_ * run_idx / degree_;
+  }
+  int sort_run(const int64_t run_idx, Compare &comp);
+  int merge_runs(Store_Row **merged_rows, Compare &comp);
+
+private:
+  common::ObIAllocator &allocator_;
+  int64_t degree_;
+  Compare **comps_;
+  int *run_rets_;
+  Store_Row **rows_;
+  int64_t row_cnt_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObSortVecOpParallelSorter);
+};
+
+template <typename Compare, typename Store_Row>
+int ObSortVecOpParallelSorter<Compare, Store_Row>::init(const int64_t degree, Compare &comp)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(degree <= 1 || degree > MAX_SORT_THREAD_CNT)) {
+    ret = OB_INVALID_ARGUMENT;
+    SQL_ENG_LOG(WARN, "invalid argument", K(ret), K(degree));
+  } else if (OB_UNLIKELY(nullptr != comps_)) {
+    ret = OB_INIT_TWICE;
+    SQL_ENG_LOG(WARN, "init twice", K(ret));
+  } else if (OB_ISNULL(comps_ = static_cast<Compare **>(
+                         allocator_.alloc(sizeof(Compare *) * degree)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SQL_ENG_LOG(WARN, "allocate memory failed", K(ret), K(degree));
+  } else if (OB_ISNULL(run_rets_ = static_cast<int *>(allocator_.alloc(sizeof(int) * degree)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SQL_ENG_LOG(WARN, "allocate memory failed", K(ret), K(degree));
+  } else {
+    degree_ = degree;
+    MEMSET(comps_, 0, sizeof(Compare *) * degree);
+    // comps_[0] stays null, run 0 is sorted by the caller with the operator comparator.
+    for (int64_t i = 1; OB_SUCC(ret) && i < degree; i++) {
+      if (OB_ISNULL(comps_[i] = OB_NEWx(Compare, (&allocator_), allocator_))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        SQL_ENG_LOG(WARN, "allocate memory failed", K(ret));
+      } else if (OB_FAIL(comps_[i]->init(comp.cmp_sk_exprs_, comp.sk_row_meta_,
+                                         comp.addon_row_meta_, comp.cmp_sort_collations_,
+                                         comp.exec_ctx_, false /*enable_encode_sortkey*/))) {
+        SQL_ENG_LOG(WARN, "failed to init compare functions", K(ret));
+      } else {
+        // keep the same encode sortkey fallback state as the operator comparator and
+        // leave status check to the caller thread, exec ctx is not thread safe.
+        comps_[i]->encode_sk_state_ = comp.encode_sk_state_;
+        comps_[i]->disable_check_status();
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    reset();
+  }
+  return ret;
+}
+
+template <typename Compare, typename Store_Row>
+int ObSortVecOpParallelSorter<Compare, Store_Row>::sort_run(const int64_t run_idx, Compare &comp)
+{
+  int ret = OB_SUCCESS;
+  const int64_t begin = run_begin(run_idx);
+  const int64_t end = run_begin(run_idx + 1);
+  if (end - begin > 1) {
+    lib::ob_sort(rows_ + begin, rows_ + end,
+                 [&comp](const Store_Row *l, const Store_Row *r) { return comp(l, r); });
+  }
+  if (OB_SUCCESS != comp.ret_) {
+    ret = comp.ret_;
+    SQL_ENG_LOG(WARN, "compare failed", K(ret), K(run_idx), K(begin), K(end));
+  }
+  return ret;
+}
+
+template <typename Compare, typename Store_Row>
+int ObSortVecOpParallelSorter<Compare, Store_Row>::merge_runs(Store_Row **merged_rows,
+                                                              Compare &comp)
+{
+  int ret = OB_SUCCESS;
+  RunItemCmp run_cmp(comp);
+  RunMerger merger(run_cmp);
+  int64_t run_pos[MAX_SORT_THREAD_CNT];
+  int64_t merged_cnt = 0;
+  if (OB_FAIL(merger.init(degree_, allocator_))) {
+    SQL_ENG_LOG(WARN, "failed to init loser tree", K(ret), K(degree_));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < degree_; i++) {
+      run_pos[i] = run_begin(i);
+      if (run_pos[i] < run_begin(i + 1)) {
+        RunItem item;
+        item.row_ = rows_[run_pos[i]];
+        item.run_idx_ = i;
+        if (OB_FAIL(merger.push(item))) {
+          SQL_ENG_LOG(WARN, "failed to push run item", K(ret), K(i));
+        }
+      }
+    }
+    if (OB_SUCC(ret) && !merger.empty() && OB_FAIL(merger.rebuild())) {
+      SQL_ENG_LOG(WARN, "failed to rebuild loser tree", K(ret));
+    }
+    while (OB_SUCC(ret) && !merger.empty()) {
+      const RunItem *top = nullptr;
+      int64_t run_idx = 0;
+      if (OB_FAIL(merger.top(top))) {
+        SQL_ENG_LOG(WARN, "failed to get top run item", K(ret));
+      } else if (FALSE_IT(run_idx = top->run_idx_)) {
+      } else if (FALSE_IT(merged_rows[merged_cnt++] = top->row_)) {
+      } else if (OB_FAIL(merger.pop())) {
+        SQL_ENG_LOG(WARN, "failed to pop run item", K(ret));
+      } else if (++run_pos[run_idx] < run_begin(run_idx + 1)) {
+        RunItem item;
+        item.row_ = rows_[run_pos[run_idx]];
+        item.run_idx_ = run_idx;
+        if (OB_FAIL(merger.push(item))) {
+          SQL_ENG_LOG(WARN, "failed to push run item", K(ret), K(run_idx));
+        }
+      }
+      if (OB_SUCC(ret) && !merger.empty() && OB_FAIL(merger.rebuild())) {
+        SQL_ENG_LOG(WARN, "failed to rebuild loser tree", K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_UNLIKELY(merged_cnt != row_cnt_)) {
+      ret = OB_ERR_UNEXPECTED;
+      SQL_ENG_LOG(WARN, "merged row count mismatch", K(ret), K(merged_cnt), K(row_cnt_));
+    } else {
+      MEMCPY(rows_, merged_rows, sizeof(Store_Row *) * row_cnt_);
+    }
+  }
+  return ret;
+}
+
+template <typename Compare, typename Store_Row>
+int ObSortVecOpParallelSorter<Compare, Store_Row>::sort(Store_Row **rows, const int64_t row_cnt,
+                                                        Store_Row **merged_rows, Compare &comp,
+                                                        ObSortVecOpParallelWorkers &workers)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(comps_)) {
+    ret = OB_NOT_INIT;
+    SQL_ENG_LOG(WARN, "not init", K(ret));
+  } else if (OB_ISNULL(rows) || OB_ISNULL(merged_rows) || OB_UNLIKELY(row_cnt < degree_)) {
+    ret = OB_INVALID_ARGUMENT;
+    SQL_ENG_LOG(WARN, "invalid argument", K(ret), KP(rows), KP(merged_rows), K(row_cnt), K(degree_));
+  } else {
+    rows_ = rows;
+    row_cnt_ = row_cnt;
+    for (int64_t i = 0; i < degree_; i++) {
+      run_rets_[i] = OB_SUCCESS;
+    }
+    ObSortVecOpParallelWorkers::TaskFunc sort_task = [this](const int64_t run_idx) {
+      return sort_run(run_idx, *comps_[run_idx]);
+    };
+    for (int64_t i = 1; i < degree_; i++) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = workers.submit(i, sort_task))) {
+        run_rets_[i] = tmp_ret;
+        SQL_ENG_LOG_RET(WARN, tmp_ret, "failed to submit sort task", K(tmp_ret), K(i));
+      }
+    }
+    run_rets_[0] = sort_run(0, comp);
+    // always wait, the submitted tasks reference the rows and the comparators.
+    if (OB_FAIL(workers.wait())) {
+      SQL_ENG_LOG(WARN, "sort task failed", K(ret), K(degree_));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < degree_; i++) {
+      if (OB_SUCCESS != run_rets_[i]) {
+        ret = run_rets_[i];
+        SQL_ENG_LOG(WARN, "sort run failed", K(ret), K(i));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(merge_runs(merged_rows, comp))) {
+      SQL_ENG_LOG(WARN, "failed to merge sorted runs", K(ret), K(degree_), K(row_cnt_));
+    }
+    rows_ = nullptr;
+    row_cnt_ = 0;
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif /* OCEANBASE_SQL_ENGINE_SORT_SORT_VEC_OP_PARALLEL_SORTER_H_ */
@@ -579,29 +579,36 @@ ObParquetTableRowIterator::DataLoader::LOAD_FUNC ObParquetTableRowIterator::Data
 #define IS_PARQUET_COL_NOT_NULL (0 == max_def_level)
 #define IS_PARQUET_COL_VALUE_IS_NULL(V) (V < max_def_level)
 
-int ObParquetTableRowIterator::DataLoader::load_int32_to_int32_vec()
+// decode values into the data of fixed length vector directly, without temp buffer and memcpy.
+// if there are nulls, values are decoded densely, and the value of row i is at or before i,
+// so they can be moved to their rows backward in place.
+template <typename ReaderType, typename ValueType>
+int ObParquetTableRowIterator::DataLoader::load_fixed_col_in_place()
 {
   int ret = OB_SUCCESS;
   int64_t values_cnt = 0;
-  ObEvalCtx::TempAllocGuard tmp_alloc_g(eval_ctx_);
-  ObFixedLengthBase *dec_vec = static_cast<ObFixedLengthBase *>(file_col_expr_->get_vector(eval_ctx_));
   int16_t max_def_level = reader_->descr()->max_definition_level();
-  ObArrayWrap<int32_t> values;
+  ObFixedLengthBase *fixed_vec = static_cast<ObFixedLengthBase *>(file_col_expr_->get_vector(eval_ctx_));
 
-  OZ (values.allocate_array(tmp_alloc_g.get_allocator(), batch_size_));
+  CK (VEC_FIXED == fixed_vec->get_format());
+  CK (sizeof(ValueType) == fixed_vec->get_length());
   if (OB_SUCC(ret)) {
-    row_count_ = static_cast<parquet::Int32Reader*>(reader_)->ReadBatch(
+    ValueType *values = pointer_cast<ValueType *>(fixed_vec->get_data());
+    row_count_ = static_cast<ReaderType *>(reader_)->ReadBatch(
           batch_size_, def_levels_buf_.get_data(), rep_levels_buf_.get_data(),
-          values.get_data(), &values_cnt);
-    int j = 0;
-    if (IS_PARQUET_COL_NOT_NULL && values_cnt == row_count_) {
-      MEMCPY(pointer_cast<int32_t*>(dec_vec->get_data()), values.get_data(), sizeof(int32_t) * row_count_);
+          values, &values_cnt);
+    if (OB_UNLIKELY(values_cnt > row_count_)) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("repeated data not support");
+    } else if (IS_PARQUET_COL_NOT_NULL || values_cnt == row_count_) {
+      // values are already at their rows
     } else {
-      for (int i = 0; OB_SUCC(ret) && i < row_count_; i++) {
+      int64_t j = values_cnt - 1;
+      for (int64_t i = row_count_ - 1; i >= 0; i--) {
         if (IS_PARQUET_COL_VALUE_IS_NULL(def_levels_buf_.at(i))) {
-          file_col_expr_->get_vector(eval_ctx_)->set_null(i);
+          fixed_vec->set_null(i);
         } else {
-          dec_vec->set_int32(i, values.at(j++));
+          values[i] = values[j--];
         }
       }
     }
@@ -609,6 +616,11 @@ int ObParquetTableRowIterator::DataLoader::load_int32_to_int32_vec()
   return ret;
 }
 
+int ObParquetTableRowIterator::DataLoader::load_int32_to_int32_vec()
+{
+  return load_fixed_col_in_place<parquet::Int32Reader, int32_t>();
+}
+
 // convert int value to decimal int or number
 int ObParquetTableRowIterator::DataLoader::to_numeric(const int64_t idx, const int64_t int_value)
 {
@@ -958,36 +970,7 @@ int ObParquetTableRowIterator::DataLoader::load_int32_to_int64_vec()
 
 int ObParquetTableRowIterator::DataLoader::load_int64_to_int64_vec()
 {
-  int ret = OB_SUCCESS;
-  int64_t values_cnt = 0;
-  ObEvalCtx::TempAllocGuard tmp_alloc_g(eval_ctx_);
-  int16_t max_def_level = reader_->descr()->max_definition_level();
-  ObFixedLengthBase *int64_vec = static_cast<ObFixedLengthBase *>(file_col_expr_->get_vector(eval_ctx_));
-  ObArrayWrap<int64_t> values;
-
-  CK (VEC_FIXED == int64_vec->get_format());
-  OZ (values.allocate_array(tmp_alloc_g.get_allocator(), batch_size_));
-  if (OB_SUCC(ret)) {
-    row_count_ = static_cast<parquet::Int64Reader*>(reader_)->ReadBatch(
-          batch_size_, def_levels_buf_.get_data(), rep_levels_buf_.get_data(),
-          values.get_data(), &values_cnt);
-    if (OB_UNLIKELY(values_cnt > row_count_)) {
-      ret = OB_NOT_SUPPORTED;
-      LOG_WARN("repeated data not support");
-    } else if (IS_PARQUET_COL_NOT_NULL && values_cnt == row_count_) {
-      MEMCPY(pointer_cast<int64_t*>(int64_vec->get_data()), values.get_data(), sizeof(int64_t) * row_count_);
-    } else {
-      int j = 0;
-      for (int i = 0; i < row_count_; i++) {
-        if (IS_PARQUET_COL_VALUE_IS_NULL(def_levels_buf_.at(i))) {
-          int64_vec->set_null(i);
-        } else {
-          int64_vec->set_int(i, values.at(j++));
-        }
-      }
-    }
-  }
-  return ret;
+  return load_fixed_col_in_place<parquet::Int64Reader, int64_t>();
 }
 
 int ObParquetTableRowIterator::DataLoader::load_date_col_to_datetime()
@@ -1233,70 +1216,12 @@ int ObParquetTableRowIterator::DataLoader::load_timestamp_hive()
 
 int ObParquetTableRowIterator::DataLoader::load_float()
 {
-  int ret = OB_SUCCESS;
-  int64_t values_cnt = 0;
-  ObEvalCtx::TempAllocGuard tmp_alloc_g(eval_ctx_);
-  int16_t max_def_level = reader_->descr()->max_definition_level();
-  ObFixedLengthBase *float_vec = static_cast<ObFixedLengthBase *>(file_col_expr_->get_vector(eval_ctx_));
-  ObArrayWrap<float> values;
-
-  CK (VEC_FIXED == float_vec->get_format());
-  OZ (values.allocate_array(tmp_alloc_g.get_allocator(), batch_size_));
-  if (OB_SUCC(ret)) {
-    row_count_ = static_cast<parquet::FloatReader*>(reader_)->ReadBatch(
-          batch_size_, def_levels_buf_.get_data(), rep_levels_buf_.get_data(),
-          values.get_data(), &values_cnt);
-    if (OB_UNLIKELY(values_cnt > row_count_)) {
-      ret = OB_NOT_SUPPORTED;
-      LOG_WARN("repeated data not support");
-    } else if (IS_PARQUET_COL_NOT_NULL && values_cnt == row_count_) {
-      MEMCPY(pointer_cast<float*>(float_vec->get_data()), values.get_data(), sizeof(float) * row_count_);
-    } else {
-      int j = 0;
-      for (int i = 0; i < row_count_; i++) {
-        if (IS_PARQUET_COL_VALUE_IS_NULL(def_levels_buf_.at(i))) {
-          float_vec->set_null(i);
-        } else {
-          float_vec->set_float(i, values.at(j++));
-        }
-      }
-    }
-  }
-  return ret;
+  return load_fixed_col_in_place<parquet::FloatReader, float>();
 }
 
 int ObParquetTableRowIterator::DataLoader::load_double()
 {
-  int ret = OB_SUCCESS;
-  int64_t values_cnt = 0;
-  ObEvalCtx::TempAllocGuard tmp_alloc_g(eval_ctx_);
-  int16_t max_def_level = reader_->descr()->max_definition_level();
-  ObFixedLengthBase *double_vec = static_cast<ObFixedLengthBase *>(file_col_expr_->get_vector(eval_ctx_));
-  ObArrayWrap<double> values;
-
-  CK (VEC_FIXED == double_vec->get_format());
-  OZ (values.allocate_array(tmp_alloc_g.get_allocator(), batch_size_));
-  if (OB_SUCC(ret)) {
-    row_count_ = static_cast<parquet::DoubleReader*>(reader_)->ReadBatch(
-          batch_size_, def_levels_buf_.get_data(), rep_levels_buf_.get_data(),
-          values.get_data(), &values_cnt);
-    if (OB_UNLIKELY(values_cnt > row_count_)) {
-      ret = OB_NOT_SUPPORTED;
-      LOG_WARN("repeated data not support");
-    } else if (IS_PARQUET_COL_NOT_NULL && values_cnt == row_count_) {
-      MEMCPY(pointer_cast<double*>(double_vec->get_data()), values.get_data(), sizeof(double) * row_count_);
-    } else {
-      int j = 0;
-      for (int i = 0; i < row_count_; i++) {
-        if (IS_PARQUET_COL_VALUE_IS_NULL(def_levels_buf_.at(i))) {
-          double_vec->set_null(i);
-        } else {
-          double_vec->set_double(i, values.at(j++));
-        }
-      }
-    }
-  }
-  return ret;
+  return load_fixed_col_in_place<parquet::DoubleReader, double>();
 }
 
 #undef IS_PARQUET_COL_NOT_NULL
@@ -189,6 +189,9 @@ private:
     int load_float();
     int load_double();
 
+    template <typename ReaderType, typename ValueType>
+    int load_fixed_col_in_place();
+
     int to_numeric(const int64_t idx, const int64_t int_value);
     int to_numeric(const int64_t idx, const char *str, const int32_t length);
     int to_numeric_hive(const int64_t idx, const char *str, const int32_t length, char *buf, const int64_t data_len);
@@ -0,0 +1,356 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_OPT
+#include "ob_log_group_join.h"
+#include "ob_log_join.h"
+#include "ob_join_order.h"
+#include "ob_optimizer_context.h"
+#include "ob_optimizer_util.h"
+#include "ob_opt_est_cost.h"
+#include "ob_opt_selectivity.h"
+#include "common/ob_smart_call.h"
+#include "sql/resolver/expr/ob_raw_expr_replacer.h"
+#include "sql/rewrite/ob_transform_utils.h"
+
+using namespace oceanbase;
+using namespace sql;
+using namespace oceanbase::common;
+
+int ObLogGroupJoin::set_join(ObLogJoin *join, const ObIArray<ObRawExpr *> &probe_keys)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(join)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(join));
+  } else if (OB_FAIL(probe_keys_.assign(probe_keys))) {
+    LOG_WARN("failed to assign probe keys", K(ret));
+  } else {
+    join_ = join;
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::get_op_exprs(ObIArray<ObRawExpr*> &all_exprs)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ObLogGroupBy::get_op_exprs(all_exprs))) {
+    LOG_WARN("failed to get group by op exprs", K(ret));
+  } else if (OB_FAIL(append_array_no_dup(all_exprs, probe_keys_))) {
+    LOG_WARN("failed to append probe keys", K(ret));
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::est_cost()
+{
+  int ret = OB_SUCCESS;
+  double group_cnt = 0.0;
+  double selectivity = 1.0;
+  double op_cost = 0.0;
+  ObLogicalOperator *build_child = get_child(ObLogicalOperator::first_child);
+  ObLogicalOperator *probe_child = get_child(ObLogicalOperator::second_child);
+  if (OB_ISNULL(build_child) || OB_ISNULL(probe_child)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(build_child), K(probe_child));
+  } else if (OB_FAIL(inner_est_cost(get_parallel(),
+                                    build_child->get_card(),
+                                    probe_child->get_card(),
+                                    group_cnt,
+                                    op_cost))) {
+    LOG_WARN("failed to est group join cost", K(ret));
+  } else if (OB_FAIL(get_having_selectivity(group_cnt, selectivity))) {
+    LOG_WARN("failed to get having selectivity", K(ret));
+  } else {
+    set_distinct_card(group_cnt);
+    set_card(group_cnt * selectivity);
+    set_op_cost(op_cost);
+    set_cost(build_child->get_cost() + probe_child->get_cost() + op_cost);
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::do_re_est_cost(EstimateCostInfo &param, double &card, double &op_cost, double &cost)
+{
+  int ret = OB_SUCCESS;
+  EstimateCostInfo build_param;
+  EstimateCostInfo probe_param;
+  double build_card = 0.0;
+  double probe_card = 0.0;
+  double build_cost = 0.0;
+  double probe_cost = 0.0;
+  double group_cnt = 0.0;
+  double selectivity = 1.0;
+  ObLogicalOperator *build_child = get_child(ObLogicalOperator::first_child);
+  ObLogicalOperator *probe_child = get_child(ObLogicalOperator::second_child);
+  if (OB_ISNULL(build_child) || OB_ISNULL(probe_child)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(build_child), K(probe_child));
+  } else {
+    // all build and probe rows are needed before the first group is returned
+    build_param.need_parallel_ = param.need_parallel_;
+    build_param.override_ = param.override_;
+    probe_param.need_parallel_ = param.need_parallel_;
+    probe_param.override_ = param.override_;
+    if (OB_FAIL(SMART_CALL(build_child->re_est_cost(build_param, build_card, build_cost)))) {
+      LOG_WARN("failed to re est build child cost", K(ret));
+    } else if (OB_FAIL(SMART_CALL(probe_child->re_est_cost(probe_param, probe_card, probe_cost)))) {
+      LOG_WARN("failed to re est probe child cost", K(ret));
+    } else if (OB_FAIL(inner_est_cost(param.need_parallel_,
+                                      build_card,
+                                      probe_card,
+                                      group_cnt,
+                                      op_cost))) {
+      LOG_WARN("failed to est group join cost", K(ret));
+    } else if (OB_FAIL(get_having_selectivity(group_cnt, selectivity))) {
+      LOG_WARN("failed to get having selectivity", K(ret));
+    } else {
+      cost = build_cost + probe_cost + op_cost;
+      card = group_cnt * selectivity;
+      if (param.need_row_count_ >= 0 && param.need_row_count_ < card) {
+        card = param.need_row_count_;
+      }
+      if (param.override_) {
+        set_distinct_card(group_cnt);
+      }
+    }
+  }
+  return ret;
+}
+
+// build rows are inserted as the groups of the hash table, every probe row is looked up in it
+// and aggregated into the matched group.
+int ObLogGroupJoin::inner_est_cost(const int64_t parallel,
+                                   const double build_card,
+                                   const double probe_card,
+                                   double &group_cnt,
+                                   double &op_cost)
+{
+  int ret = OB_SUCCESS;
+  ObLogicalOperator *build_child = get_child(ObLogicalOperator::first_child);
+  ObLogicalOperator *probe_child = get_child(ObLogicalOperator::second_child);
+  if (OB_ISNULL(get_plan()) || OB_ISNULL(build_child) || OB_ISNULL(probe_child)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(build_child), K(probe_child));
+  } else if (OB_UNLIKELY(parallel < 1)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected parallel", K(ret), K(parallel));
+  } else {
+    ObOptimizerContext &opt_ctx = get_plan()->get_optimizer_context();
+    const double per_dop_build_card = build_card / parallel;
+    const double per_dop_probe_card = probe_card / parallel;
+    op_cost = ObOptEstCost::cost_hash_group(per_dop_build_card,
+                                            per_dop_build_card,
+                                            build_child->get_width(),
+                                            get_group_by_exprs(),
+                                            0,
+                                            opt_ctx)
+              + ObOptEstCost::cost_hash_group(per_dop_probe_card,
+                                              per_dop_build_card,
+                                              probe_child->get_width(),
+                                              probe_keys_,
+                                              get_aggr_funcs().count(),
+                                              opt_ctx);
+    // build keys are unique, only the groups matched by the inner join are returned
+    group_cnt = get_total_ndv() >= 0 ? std::min(build_card, get_total_ndv()) : build_card;
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::get_having_selectivity(const double group_cnt, double &selectivity)
+{
+  int ret = OB_SUCCESS;
+  selectivity = 1.0;
+  if (OB_ISNULL(get_plan())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (get_filter_exprs().empty()) {
+    /* do nothing */
+  } else if (OB_FALSE_IT(get_plan()->get_selectivity_ctx().init_row_count(get_origin_child_card(),
+                                                                          group_cnt))) {
+  } else if (OB_FAIL(ObOptSelectivity::calculate_selectivity(get_plan()->get_update_table_metas(),
+                                                             get_plan()->get_selectivity_ctx(),
+                                                             get_filter_exprs(),
+                                                             selectivity,
+                                                             get_plan()->get_predicate_selectivities()))) {
+    LOG_WARN("failed to calculate selectivity", K(ret));
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::compute_const_exprs()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(join_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (OB_FAIL(append(get_output_const_exprs(), join_->get_output_const_exprs()))) {
+    LOG_WARN("failed to append exprs", K(ret));
+  } else if (OB_FAIL(ObOptimizerUtil::compute_const_exprs(get_filter_exprs(),
+                                                          get_output_const_exprs()))) {
+    LOG_WARN("failed to compute const conditionexprs", K(ret));
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::compute_equal_set()
+{
+  int ret = OB_SUCCESS;
+  EqualSets *ordering_esets = NULL;
+  if (OB_ISNULL(join_) || OB_ISNULL(get_plan())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(join_));
+  } else if (get_filter_exprs().empty()) {
+    set_output_equal_sets(&join_->get_output_equal_sets());
+  } else if (OB_ISNULL(ordering_esets = get_plan()->create_equal_sets())) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to create equal sets", K(ret));
+  } else if (OB_FAIL(ObEqualAnalysis::compute_equal_set(&get_plan()->get_allocator(),
+                                                        get_filter_exprs(),
+                                                        join_->get_output_equal_sets(),
+                                                        *ordering_esets))) {
+    LOG_WARN("failed to compute ordering output equal set", K(ret));
+  } else {
+    set_output_equal_sets(ordering_esets);
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::compute_fd_item_set()
+{
+  int ret = OB_SUCCESS;
+  ObFdItemSet *fd_item_set = NULL;
+  ObTableFdItem *fd_item = NULL;
+  if (OB_ISNULL(join_) || OB_ISNULL(get_plan())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(join_));
+  } else if (OB_FAIL(get_plan()->get_fd_item_factory().create_fd_item_set(fd_item_set))) {
+    LOG_WARN("failed to create fd item set", K(ret));
+  } else if (OB_FAIL(fd_item_set->assign(join_->get_fd_item_set()))) {
+    LOG_WARN("failed to assign fd item set", K(ret));
+  } else if (!ObTransformUtils::need_compute_fd_item_set(get_group_by_exprs())) {
+    // do nothing
+  } else if (OB_FAIL(get_plan()->get_fd_item_factory().create_table_fd_item(fd_item,
+                                                                           true,
+                                                                           get_group_by_exprs(),
+                                                                           get_table_set()))) {
+    LOG_WARN("failed to create fd item", K(ret));
+  } else if (OB_FAIL(fd_item_set->push_back(fd_item))) {
+    LOG_WARN("failed to push back fd item", K(ret));
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(deduce_const_exprs_and_ft_item_set(*fd_item_set))) {
+    LOG_WARN("falied to deduce fd item set", K(ret));
+  } else {
+    set_fd_item_set(fd_item_set);
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::compute_sharding_info()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(join_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (OB_FAIL(weak_sharding_.assign(join_->get_weak_sharding()))) {
+    LOG_WARN("failed to assign sharding info", K(ret));
+  } else {
+    strong_sharding_ = join_->get_strong_sharding();
+    inherit_sharding_index_ = join_->get_inherit_sharding_index();
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::compute_op_parallel_and_server_info()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(join_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (OB_FAIL(get_server_list().assign(join_->get_server_list()))) {
+    LOG_WARN("failed to assign server list", K(ret));
+  } else {
+    set_parallel(join_->get_parallel());
+    set_server_cnt(join_->get_server_cnt());
+    if (is_single()) {
+      set_available_parallel(join_->get_available_parallel());
+    }
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::get_plan_item_info(PlanText &plan_text,
+                                       ObSqlPlanItem &plan_item)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(join_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (OB_FAIL(ObLogGroupBy::get_plan_item_info(plan_text, plan_item))) {
+    LOG_WARN("failed to get plan item info", K(ret));
+  } else {
+    // special predicates of group by are printed last, append the join conditions to them
+    BEGIN_BUF_PRINT;
+    const ObIArray<ObRawExpr *> &equal_conds = join_->get_equal_join_conditions();
+    if (OB_FAIL(BUF_PRINTF(", "))) {
+      LOG_WARN("BUF_PRINTF fails", K(ret));
+    } else {
+      EXPLAIN_PRINT_EXPRS(equal_conds, type);
+    }
+    if (OB_SUCC(ret)) {
+      plan_item.special_predicates_len_ += pos - start_pos;
+    }
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::inner_replace_op_exprs(ObRawExprReplacer &replacer)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ObLogGroupBy::inner_replace_op_exprs(replacer))) {
+    LOG_WARN("failed to replace group by exprs", K(ret));
+  } else if (OB_FAIL(replace_exprs_action(replacer, probe_keys_))) {
+    LOG_WARN("failed to replace probe keys", K(ret));
+  }
+  return ret;
+}
+
+// the outline of the fused join (leading, use_hash, ...) is printed with the group by outline,
+// so that the same plan is generated from the outline.
+int ObLogGroupJoin::print_outline_data(PlanText &plan_text)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(join_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (OB_FAIL(ObLogGroupBy::print_outline_data(plan_text))) {
+    LOG_WARN("failed to print group by outline", K(ret));
+  } else if (OB_FAIL(static_cast<ObLogicalOperator *>(join_)->print_outline_data(plan_text))) {
+    LOG_WARN("failed to print join outline", K(ret));
+  }
+  return ret;
+}
+
+int ObLogGroupJoin::print_used_hint(PlanText &plan_text)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(join_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (OB_FAIL(ObLogGroupBy::print_used_hint(plan_text))) {
+    LOG_WARN("failed to print group by used hint", K(ret));
+  } else if (OB_FAIL(static_cast<ObLogicalOperator *>(join_)->print_used_hint(plan_text))) {
+    LOG_WARN("failed to print join used hint", K(ret));
+  }
+  return ret;
+}
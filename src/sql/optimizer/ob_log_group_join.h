@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_OB_LOG_GROUP_JOIN_H
+#define OCEANBASE_SQL_OB_LOG_GROUP_JOIN_H
+#include "ob_log_group_by.h"
+namespace oceanbase
+{
+namespace sql
+{
+class ObLogJoin;
+
+/**
+ * Hash group by fused with the inner hash join below it, the group exprs are the unique build
+ * keys of the join. Build rows are the groups and probe rows are aggregated into the matched
+ * group directly, the join result is never materialized, see ObHashGroupJoinVecOp.
+ *
+ * The first child is the build side and the second child is the probe side of the fused join.
+ * The join itself is not in the plan tree, it is only kept to derive the properties of the join
+ * result and to print the join outline.
+ */
+class ObLogGroupJoin : public ObLogGroupBy
+{
+public:
+  ObLogGroupJoin(ObLogPlan &plan)
+      : ObLogGroupBy(plan),
+        join_(NULL),
+        probe_keys_()
+  {}
+  virtual ~ObLogGroupJoin()
+  {}
+
+  int set_join(ObLogJoin *join, const common::ObIArray<ObRawExpr *> &probe_keys);
+  inline ObLogJoin *get_join() { return join_; }
+  // right join keys of the fused join, in the same order as the group exprs
+  inline common::ObIArray<ObRawExpr *> &get_probe_keys() { return probe_keys_; }
+
+  virtual int get_op_exprs(ObIArray<ObRawExpr*> &all_exprs) override;
+  virtual int est_cost() override;
+  virtual int do_re_est_cost(EstimateCostInfo &param, double &card, double &op_cost, double &cost) override;
+  virtual int compute_const_exprs() override;
+  virtual int compute_equal_set() override;
+  virtual int compute_fd_item_set() override;
+  virtual int compute_sharding_info() override;
+  virtual int compute_op_parallel_and_server_info() override;
+  virtual int get_plan_item_info(PlanText &plan_text,
+                                 ObSqlPlanItem &plan_item) override;
+private:
+  int inner_est_cost(const int64_t parallel,
+                     const double build_card,
+                     const double probe_card,
+                     double &group_cnt,
+                     double &op_cost);
+  int get_having_selectivity(const double group_cnt, double &selectivity);
+  virtual int inner_replace_op_exprs(ObRawExprReplacer &replacer) override;
+  virtual int print_outline_data(PlanText &plan_text) override;
+  virtual int print_used_hint(PlanText &plan_text) override;
+private:
+  ObLogJoin *join_;
+  common::ObSEArray<ObRawExpr *, 4, common::ModulePageAllocator, true> probe_keys_;
+  DISALLOW_COPY_AND_ASSIGN(ObLogGroupJoin);
+};
+} // end of namespace sql
+} // end of namespace oceanbase
+
+#endif // OCEANBASE_SQL_OB_LOG_GROUP_JOIN_H
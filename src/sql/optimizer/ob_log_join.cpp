@@ -1195,6 +1195,67 @@ int ObLogJoin::is_left_unique(bool &left_unique) const
   return ret;
 }
 
+int ObLogJoin::get_group_join_keys(const ObIArray<ObRawExpr*> &group_exprs,
+                                   ObIArray<ObRawExpr*> &probe_keys,
+                                   bool &is_valid) const
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObRawExpr*, 8> left_exprs;
+  ObSEArray<ObRawExpr*, 8> right_exprs;
+  ObSEArray<bool, 8> null_safe_info;
+  ObLogicalOperator *left_child = NULL;
+  bool left_unique = false;
+  is_valid = false;
+  probe_keys.reuse();
+  if (OB_ISNULL(left_child = get_child(first_child))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Get unexpected null", K(ret), K(get_child(first_child)));
+  } else if (HASH_JOIN != join_algo_ || INNER_JOIN != join_type_ || is_shared_hash_join()
+             || !join_filter_infos_.empty()
+             || !join_filters_.empty() || !filter_exprs_.empty() || group_exprs.empty()
+             || join_conditions_.count() != group_exprs.count()) {
+    /* do nothing */
+  } else if (OB_FAIL(ObOptimizerUtil::get_equal_keys(join_conditions_,
+                                                     left_child->get_table_set(),
+                                                     left_exprs,
+                                                     right_exprs,
+                                                     null_safe_info))) {
+    LOG_WARN("failed to get equal keys", K(ret));
+  } else if (left_exprs.count() != group_exprs.count()) {
+    /* do nothing */
+  } else if (OB_FAIL(is_left_unique(left_unique))) {
+    LOG_WARN("failed to check left unique", K(ret));
+  } else if (left_unique) {
+    is_valid = true;
+    for (int64_t i = 0; OB_SUCC(ret) && is_valid && i < group_exprs.count(); ++i) {
+      int64_t idx = -1;
+      if (!ObOptimizerUtil::find_item(left_exprs, group_exprs.at(i), &idx)
+          || idx < 0 || idx >= right_exprs.count() || null_safe_info.at(idx)) {
+        is_valid = false;
+      } else if (OB_ISNULL(left_exprs.at(idx)) || OB_ISNULL(right_exprs.at(idx))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("get unexpected null", K(ret), K(idx));
+      } else if (left_exprs.at(idx)->get_result_type().get_type() !=
+                 right_exprs.at(idx)->get_result_type().get_type()
+                 || left_exprs.at(idx)->get_result_type().get_collation_type() !=
+                 right_exprs.at(idx)->get_result_type().get_collation_type()
+                 || left_exprs.at(idx)->get_result_type().get_accuracy() !=
+                 right_exprs.at(idx)->get_result_type().get_accuracy()) {
+        // build keys and probe keys are compared in stored format directly, e.g. decimal int
+        // of different precision has different width, datetime of different scale is not
+        // rounded the same way
+        is_valid = false;
+      } else if (OB_FAIL(probe_keys.push_back(right_exprs.at(idx)))) {
+        LOG_WARN("failed to push back probe key", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && !is_valid) {
+      probe_keys.reuse();
+    }
+  }
+  return ret;
+}
+
 int ObLogJoin::compute_table_set()
 {
   int ret = OB_SUCCESS;
@@ -65,6 +65,11 @@ namespace sql
     inline bool is_shared_hash_join() const
     { return HASH_JOIN == join_algo_ && DIST_BC2HOST_NONE == join_dist_algo_; }
     int is_left_unique(bool &left_unique) const;
+    // check whether group by %group_exprs above this join can be fused into the hash join build
+    // side, %probe_keys returns the right join keys in the same order as %group_exprs.
+    int get_group_join_keys(const common::ObIArray<ObRawExpr *> &group_exprs,
+                            common::ObIArray<ObRawExpr *> &probe_keys,
+                            bool &is_valid) const;
     inline int add_join_condition(ObRawExpr *expr) { return join_conditions_.push_back(expr); }
     inline int add_join_filter(ObRawExpr *expr) { return join_filters_.push_back(expr); }
     const common::ObIArray<ObRawExpr *> &get_equal_join_conditions() const { return join_conditions_; }
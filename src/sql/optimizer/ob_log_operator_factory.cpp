@@ -17,6 +17,7 @@
 #include "ob_log_join_filter.h"
 #include "ob_log_sort.h"
 #include "ob_log_group_by.h"
+#include "ob_log_group_join.h"
 #include "ob_log_exchange.h"
 #include "ob_log_limit.h"
 #include "ob_log_subplan_scan.h"
@@ -366,6 +367,13 @@ ObLogicalOperator *ObLogOperatorFactory::allocate(ObLogPlan &plan, ObLogOpType t
     } else { /* do nothing */ }
     break;
   }
+  case LOG_GROUP_JOIN: {
+    ptr = allocator_.alloc(sizeof(ObLogGroupJoin));
+    if (NULL != ptr) {
+      ret_op = new (ptr) ObLogGroupJoin(plan);
+    } else { /* do nothing */ }
+    break;
+  }
   default: {
     break;
   }
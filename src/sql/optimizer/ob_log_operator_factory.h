@@ -53,6 +53,7 @@ LOG_OP_DEF(LOG_ERR_LOG, "ERROR LOGGING")
 LOG_OP_DEF(LOG_STAT_COLLECTOR, "STAT COLLECTOR")
 LOG_OP_DEF(LOG_OPTIMIZER_STATS_GATHERING, "OPTIMIZER STATISTICS GATHERING")
 LOG_OP_DEF(LOG_VALUES_TABLE_ACCESS, "VALUES TABLE ACCESS")
+LOG_OP_DEF(LOG_GROUP_JOIN, "GROUP JOIN")
 /* end of logical operator type */
 LOG_OP_DEF(LOG_OP_END, "OP_DEF_END")
 #endif /*LOG_OP_DEF*/
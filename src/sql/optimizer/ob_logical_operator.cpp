@@ -1749,7 +1749,7 @@ int ObLogicalOperator::do_plan_tree_traverse(const TraverseOp &operation, void *
 int ObLogicalOperator::should_allocate_gi_for_dml(bool &is_valid)
 {
   int ret = OB_SUCCESS;
-  if (LOG_JOIN == get_type() || LOG_SET == get_type()) {
+  if (LOG_JOIN == get_type() || LOG_SET == get_type() || LOG_GROUP_JOIN == get_type()) {
     is_valid = false;
   } else if (LOG_INSERT == get_type()) {
     const ObLogInsert *log_insert = static_cast<const ObLogInsert *>(this);
@@ -2250,6 +2250,7 @@ int ObLogicalOperator::check_need_pushdown_expr(const uint64_t producer_id,
   } else if (child_.empty()) {
     // do nothing
   } else if (ObLogOpType::LOG_GROUP_BY == get_type() ||
+             ObLogOpType::LOG_GROUP_JOIN == get_type() ||
              ObLogOpType::LOG_SORT == get_type() ||
              ObLogOpType::LOG_JOIN == get_type() ||
              ObLogOpType::LOG_DISTINCT == get_type() ||
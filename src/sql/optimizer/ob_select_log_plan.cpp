@@ -25,6 +25,7 @@
 #include "sql/optimizer/ob_log_table_scan.h"
 #include "sql/optimizer/ob_log_join.h"
 #include "sql/optimizer/ob_log_group_by.h"
+#include "sql/optimizer/ob_log_group_join.h"
 #include "sql/optimizer/ob_log_sort.h"
 #include "sql/optimizer/ob_log_exchange.h"
 #include "sql/optimizer/ob_log_subplan_filter.h"
@@ -48,6 +49,7 @@
 #include "sql/optimizer/ob_log_link_scan.h"
 #include "common/ob_smart_call.h"
 #include "share/system_variable/ob_sys_var_class_type.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 using namespace oceanbase;
 using namespace sql;
@@ -764,8 +766,12 @@ int ObSelectLogPlan::create_hash_group_plan(const ObIArray<ObRawExpr*> &reduce_e
                                          origin_child_card,
                                          is_partition_wise))) {
       LOG_WARN("failed to allocate group by as top", K(ret));
-    } else {
-      static_cast<ObLogGroupBy*>(top)->set_group_by_outline_info(is_basic, is_partition_wise, true, false);
+    } else if (OB_FALSE_IT(static_cast<ObLogGroupBy*>(top)->set_group_by_outline_info(is_basic,
+                                                                                     is_partition_wise,
+                                                                                     true,
+                                                                                     false))) {
+    } else if (is_basic && OB_FAIL(try_allocate_group_join_as_top(aggr_items, top))) {
+      LOG_WARN("failed to try allocate group join as top", K(ret));
     }
   } else if (!groupby_helper.allow_dist_hash()) {
     top = NULL;
@@ -832,6 +838,138 @@ int ObSelectLogPlan::create_hash_group_plan(const ObIArray<ObRawExpr*> &reduce_e
   return ret;
 }
 
+// replace hash group by %top and the inner hash join below it by a hash group join if it is
+// cheaper, see ObLogGroupJoin.
+int ObSelectLogPlan::try_allocate_group_join_as_top(const ObIArray<ObAggFunRawExpr*> &aggr_items,
+                                                    ObLogicalOperator *&top)
+{
+  int ret = OB_SUCCESS;
+  ObLogGroupBy *group_by = NULL;
+  ObLogJoin *join = NULL;
+  ObLogGroupJoin *group_join = NULL;
+  ObSEArray<ObRawExpr*, 4> probe_keys;
+  bool is_valid = false;
+  if (OB_ISNULL(top)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (log_op_def::LOG_GROUP_BY != top->get_type()
+             || OB_ISNULL(top->get_child(ObLogicalOperator::first_child))
+             || log_op_def::LOG_JOIN != top->get_child(ObLogicalOperator::first_child)->get_type()) {
+    /* do nothing */
+  } else if (OB_FALSE_IT(group_by = static_cast<ObLogGroupBy*>(top))) {
+  } else if (OB_FALSE_IT(join = static_cast<ObLogJoin*>(group_by->get_child(ObLogicalOperator::first_child)))) {
+  } else if (OB_FAIL(check_can_use_group_join(*group_by, *join, probe_keys, is_valid))) {
+    LOG_WARN("failed to check can use group join", K(ret));
+  } else if (!is_valid) {
+    /* do nothing */
+  } else if (OB_ISNULL(group_join = static_cast<ObLogGroupJoin*>(
+                       get_log_op_factory().allocate(*this, LOG_GROUP_JOIN)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("failed to allocate group join operator", K(ret));
+  } else {
+    ObLogicalOperator *build_child = join->get_child(ObLogicalOperator::first_child);
+    ObLogicalOperator *probe_child = join->get_child(ObLogicalOperator::second_child);
+    group_join->set_child(ObLogicalOperator::first_child, build_child);
+    group_join->set_child(ObLogicalOperator::second_child, probe_child);
+    group_join->set_algo_type(AggregateAlgo::HASH_AGGREGATE);
+    group_join->set_total_ndv(group_by->get_total_ndv());
+    group_join->set_origin_child_card(group_by->get_origin_child_card());
+    group_join->set_group_by_outline_info(true, false, true, false);
+    if (OB_FAIL(group_join->set_join(join, probe_keys))) {
+      LOG_WARN("failed to set join", K(ret));
+    } else if (OB_FAIL(group_join->set_group_by_exprs(group_by->get_group_by_exprs()))) {
+      LOG_WARN("failed to set group by columns", K(ret));
+    } else if (OB_FAIL(group_join->set_aggr_exprs(aggr_items))) {
+      LOG_WARN("failed to set aggregation exprs", K(ret));
+    } else if (OB_FAIL(group_join->get_filter_exprs().assign(group_by->get_filter_exprs()))) {
+      LOG_WARN("failed to set filter exprs", K(ret));
+    } else if (OB_FAIL(group_join->compute_property())) {
+      LOG_WARN("failed to compute property", K(ret));
+    } else if (group_join->get_cost() < group_by->get_cost()) {
+      OPT_TRACE("use hash group join, cost:", group_join->get_cost(), "group by cost:", group_by->get_cost());
+      top = group_join;
+    } else {
+      OPT_TRACE("hash group join is not cheaper, cost:", group_join->get_cost(),
+                "group by cost:", group_by->get_cost());
+    }
+    if (top != group_join) {
+      // children are shared with the join kept in the plan
+      build_child->set_parent(join);
+      probe_child->set_parent(join);
+    }
+  }
+  return ret;
+}
+
+// group by above an inner hash join can be fused into the hash table of the join build side if
+// the group exprs are the unique build keys and the aggregates only use the probe side columns.
+int ObSelectLogPlan::check_can_use_group_join(ObLogGroupBy &group_by,
+                                              ObLogJoin &join,
+                                              ObIArray<ObRawExpr*> &probe_keys,
+                                              bool &is_valid)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = NULL;
+  ObLogicalOperator *build_child = NULL;
+  ObLogicalOperator *probe_child = NULL;
+  is_valid = false;
+  probe_keys.reuse();
+  if (OB_ISNULL(session = get_optimizer_context().get_session_info())
+      || OB_ISNULL(build_child = join.get_child(ObLogicalOperator::first_child))
+      || OB_ISNULL(probe_child = join.get_child(ObLogicalOperator::second_child))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(session), K(build_child), K(probe_child));
+  } else if (ObOptEstCost::VECTOR_MODEL != get_optimizer_context().get_cost_model_type()
+             || !session->use_rich_format()
+             || GET_MIN_CLUSTER_VERSION() < CLUSTER_VERSION_4_3_3_0) {
+    // hash group join only has the vectorized rich format implementation, plans are always
+    // vectorized since 4.3.3 if rowsets are enabled and the operator is registered as vec op.
+  } else if (HASH_AGGREGATE != group_by.get_algo() || group_by.has_rollup()
+             || group_by.from_pivot() || group_by.get_group_by_exprs().empty()
+             || DIST_BASIC_METHOD != join.get_join_distributed_method()) {
+    /* do nothing */
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session->get_effective_tenant_id()));
+    is_valid = tenant_config.is_valid() && tenant_config->_enable_hash_group_join;
+  }
+  // only aggregates that can be calculated row by row on the probe side
+  for (int64_t i = 0; OB_SUCC(ret) && is_valid && i < group_by.get_aggr_funcs().count(); ++i) {
+    ObAggFunRawExpr *aggr = static_cast<ObAggFunRawExpr *>(group_by.get_aggr_funcs().at(i));
+    if (OB_ISNULL(aggr) || OB_UNLIKELY(!aggr->is_aggr_expr())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected aggr expr", K(ret), KPC(aggr));
+    } else if ((T_FUN_COUNT != aggr->get_expr_type() && T_FUN_SUM != aggr->get_expr_type()
+                && T_FUN_MIN != aggr->get_expr_type() && T_FUN_MAX != aggr->get_expr_type())
+               || aggr->is_param_distinct()) {
+      is_valid = false;
+    }
+    for (int64_t j = 0; OB_SUCC(ret) && is_valid && j < aggr->get_real_param_count(); ++j) {
+      const ObRawExpr *param = aggr->get_real_param_exprs().at(j);
+      if (OB_ISNULL(param)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("get unexpected null", K(ret));
+      } else if (param->has_flag(CNT_SUB_QUERY)
+                 || !param->get_relation_ids().is_subset(probe_child->get_table_set())) {
+        is_valid = false;
+      }
+    }
+  }
+  if (OB_FAIL(ret) || !is_valid) {
+  } else if (OB_FAIL(join.get_group_join_keys(group_by.get_group_by_exprs(), probe_keys, is_valid))) {
+    LOG_WARN("failed to get group join keys", K(ret));
+  } else if (is_valid) {
+    // build rows are kept in memory without dump, fall back to hash join and hash group by if
+    // they are not expected to fit in the hash area
+    const double build_size = build_child->get_card() * build_child->get_width()
+                              / std::max(join.get_parallel(), 1L);
+    is_valid = build_size <= static_cast<double>(session->get_tenant_hash_area_size());
+    if (!is_valid) {
+      OPT_TRACE("build side of hash group join exceeds hash area size:", build_size);
+    }
+  }
+  return ret;
+}
+
 int ObSelectLogPlan::allocate_topk_for_hash_group_plan(ObLogicalOperator *&top)
 {
   int ret = OB_SUCCESS;
@@ -27,6 +27,7 @@ struct JoinInfo;
 class Path;
 class JoinPath;
 class ObLogGroupBy;
+class ObLogJoin;
 class ObLogSet;
 class ObLogWindowFunction;
 struct MergeKeyInfo;
@@ -116,6 +117,14 @@ private:
                              GroupingOpHelper &groupby_helper,
                              ObLogicalOperator *&top);
 
+  int try_allocate_group_join_as_top(const ObIArray<ObAggFunRawExpr*> &aggr_items,
+                                     ObLogicalOperator *&top);
+
+  int check_can_use_group_join(ObLogGroupBy &group_by,
+                               ObLogJoin &join,
+                               ObIArray<ObRawExpr*> &probe_keys,
+                               bool &is_valid);
+
   int allocate_topk_for_hash_group_plan(ObLogicalOperator *&top);
 
   int allocate_topk_sort_as_top(ObLogicalOperator *&top,
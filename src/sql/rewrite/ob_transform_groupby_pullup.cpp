@@ -938,7 +938,8 @@ int ObTransformGroupByPullup::has_group_by_op(ObLogicalOperator *op, bool &bret)
   if (OB_ISNULL(op)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("op is null", K(ret));
-  } else if (log_op_def::LOG_GROUP_BY == op->get_type()) {
+  } else if (log_op_def::LOG_GROUP_BY == op->get_type()
+             || log_op_def::LOG_GROUP_JOIN == op->get_type()) {
     bret = true;
   } else if (op->get_num_of_child() != 1) {
     //do nothing
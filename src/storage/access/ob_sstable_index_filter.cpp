@@ -160,7 +160,9 @@ int ObSSTableIndexFilter::extract_skipping_filter_from_tree(
 {
   int ret = OB_SUCCESS;
   sql::ObPhysicalFilterExecutor &physical_filter = static_cast<sql::ObPhysicalFilterExecutor &>(filter);
-  if (physical_filter.is_filter_white_node() || static_cast<sql::ObBlackFilterExecutor &>(physical_filter).is_monotonic()) {
+  if (physical_filter.is_filter_white_node()
+      || static_cast<sql::ObBlackFilterExecutor &>(physical_filter).is_monotonic()
+      || static_cast<sql::ObBlackFilterExecutor &>(physical_filter).has_bloom_runtime_filter()) {
     IndexList index_list;
     if (OB_FAIL(find_skipping_index(read_info, physical_filter, index_list))) {
       LOG_WARN("Fail to find useful skipping index", K(ret));
@@ -477,18 +477,34 @@ int ObIntegerColumnDecoder::tranverse_integer_between_op(
         right_filter_base_diff = INTEGER_MASK_TABLE[store_width_size]; // right > MAX_RANGE, right = MAX_RANGE.
       }
       uint64_t filter_vals[] = {left_filter_base_diff, right_filter_base_diff};
+      const uint8_t store_width_tag = stream_meta.get_width_tag();
 
+      // bounds are in the base diff domain now, so the stored values are compared directly
       if (ctx.is_null_replaced()) {
         const uint64_t null_replace_val = ctx.null_replaced_value_ - base_value;
-        if (OB_FAIL(ObCSFilterFunctionFactory::instance().integer_bt_tranverse_with_null(ctx.data_, store_width_size,
-            filter_vals, null_replace_val, row_start, row_cnt, parent, result_bitmap))) {
-          LOG_WARN("fail to exe integer bt tranverse with null", KR(ret), K(store_width_size));
+        raw_between_function_with_null bt_func =
+            RawCompareFunctionFactory::instance().get_cs_between_function_with_null(store_width_tag);
+        if (OB_ISNULL(bt_func)) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected nullptr between function", KR(ret), K(store_width_tag));
+        } else {
+          bt_func(reinterpret_cast<const unsigned char *>(ctx.data_), left_filter_base_diff,
+              right_filter_base_diff, null_replace_val, result_bitmap.get_data(), row_start, row_start + row_cnt);
         }
-      } else {
-        const bool exist_null_bitmap = ctx.has_null_bitmap();
+      } else if (ctx.has_null_bitmap()) {
         if (OB_FAIL(ObCSFilterFunctionFactory::instance().integer_bt_tranverse(ctx.data_, store_width_size,
-            filter_vals, row_start, row_cnt, exist_null_bitmap, parent, result_bitmap))) {
-          LOG_WARN("fail to exe integer bt tranverse", KR(ret), K(exist_null_bitmap), K(store_width_size));
+            filter_vals, row_start, row_cnt, true/*exist_null_bitmap*/, parent, result_bitmap))) {
+          LOG_WARN("fail to exe integer bt tranverse", KR(ret), K(store_width_size));
+        }
+      } else {
+        raw_between_function bt_func =
+            RawCompareFunctionFactory::instance().get_cs_between_function(store_width_tag);
+        if (OB_ISNULL(bt_func)) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected nullptr between function", KR(ret), K(store_width_tag));
+        } else {
+          bt_func(reinterpret_cast<const unsigned char *>(ctx.data_), left_filter_base_diff,
+              right_filter_base_diff, result_bitmap.get_data(), row_start, row_start + row_cnt);
         }
       }
     }
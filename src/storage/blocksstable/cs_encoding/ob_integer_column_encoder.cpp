@@ -118,6 +118,9 @@ int ObIntegerColumnEncoder::do_init_()
         ctx_->encoding_ctx_->previous_cs_encoding_.get_column_encoding(column_index_),
         0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_, ctx_->allocator_))) {
       LOG_WARN("fail to build_stream_encoder_info", K(ret));
+    } else {
+      const ObObjTypeClass tc = column_type_.get_type_class();
+      enc_ctx_.info_.is_floating_ = (ObFloatTC == tc || ObDoubleTC == tc);
     }
   }
 
@@ -300,13 +300,28 @@ private:
     }
 
     TO_STRING_KV(K_(type), "name", ObIntegerStream::get_encoding_type_name(type_),
-                 K_(time_cost_us), K_(space_cost), K_(percent_to_best));
+                 K_(time_cost_us), K_(space_cost), K_(percent_to_best), K_(decode_cost_rank));
     ObIntegerStream::EncodingType type_;
     int64_t time_cost_us_;
     int64_t space_cost_;
     int64_t percent_to_best_;
+    int64_t decode_cost_rank_;
   };
 
+  // the encoding type whose space cost is within SPACE_COST_TOLERANCE_PERCENT of the
+  // most space-saving one is preferred if it is cheaper to decode
+  static constexpr int64_t SPACE_COST_TOLERANCE_PERCENT = 5;
+
+  template<typename T>
+  bool is_sample_monotonic_inc(const T *int_arr, const int64_t sample_count) const
+  {
+    bool is_monotonic_inc = true;
+    for (int64_t i = 1; is_monotonic_inc && i < sample_count; i++) {
+      is_monotonic_inc = int_arr[i] >= int_arr[i - 1];
+    }
+    return is_monotonic_inc;
+  }
+
   template<typename T>
   int dectect_candidate_codec(const T *int_arr, const int64_t arr_count,
                               ObMicroBufferWriter &buf_writer)
@@ -315,9 +330,17 @@ private:
     static constexpr int64_t min_sample_count = 1024;
     int ret = OB_SUCCESS;
 
+    int64_t sample_count = 0;
+    if (arr_count < min_sample_count) {
+      sample_count = arr_count;
+    } else {
+      sample_count = std::max(arr_count * sample_ratio / 100, min_sample_count);
+    }
+    const bool is_monotonic_inc = ctx_->info_.is_monotonic_inc_
+        || (!ctx_->info_.is_floating_ && is_sample_monotonic_inc<T>(int_arr, sample_count));
     ObIntegerStream::EncodingType candidate_list[ObIntegerStream::EncodingType::MAX_TYPE];
     int32_t candidate_count = 0;
-    build_candidate_codec_list<T>(candidate_list, candidate_count);
+    build_candidate_codec_list<T>(is_monotonic_inc, candidate_list, candidate_count);
 
     // RAW encoding can't be disabled
     int32_t raw_encoding_idx = candidate_count;
@@ -328,12 +351,6 @@ private:
       ctx_->meta_.set_encoding_type(candidate_list[0]);
       STORAGE_LOG(INFO, "only one codec enabled", K(ret), "type", candidate_list[0]);
     } else {
-      int64_t sample_count = 0;
-      if (arr_count < min_sample_count) {
-        sample_count = arr_count;
-      } else {
-        sample_count = std::max(arr_count * sample_ratio / 100, min_sample_count);
-      }
       const int64_t orig_pos = buf_writer.length();
       const int64_t remain_size = buf_writer.remain_buffer_size();
       const int64_t raw_encoding_len = sizeof(T) * sample_count;
@@ -348,6 +365,8 @@ private:
         cost_arr[raw_encoding_idx].type_ = ObIntegerStream::EncodingType::RAW;
         cost_arr[raw_encoding_idx].time_cost_us_ = 0;
         cost_arr[raw_encoding_idx].space_cost_ = raw_encoding_len;
+        cost_arr[raw_encoding_idx].decode_cost_rank_ =
+            ObIntegerStream::get_decode_cost_rank(ObIntegerStream::EncodingType::RAW);
 
         int tmp_ret = OB_SUCCESS;
         for (int64_t i = 0; OB_SUCC(ret) && i < raw_encoding_idx; i++) {
@@ -370,6 +389,7 @@ private:
             cost_arr[i].time_cost_us_ = ObTimeUtility::current_time() - start_time_us;
             cost_arr[i].space_cost_ = buf_writer.length() - orig_pos;
           }
+          cost_arr[i].decode_cost_rank_ = ObIntegerStream::get_decode_cost_rank(candidate_list[i]);
 
           if (OB_SUCC(ret)) {
             if (OB_FAIL(buf_writer.set_length(orig_pos))) {
@@ -382,18 +402,23 @@ private:
 
         if (OB_SUCC(ret)) {
           lib::ob_sort(cost_arr, cost_arr + candidate_count);
-          // use most space-saving encoding type
-          const ObCodecCost &best_codec = cost_arr[0];
+          // use the cheapest-to-decode encoding type among the ones close to the most space-saving one
+          int64_t best_idx = 0;
           for (int64_t i = 0; i < candidate_count; i++) {
-            cost_arr[i].percent_to_best_ = cost_arr[i].space_cost_ * 100 / best_codec.space_cost_;
+            cost_arr[i].percent_to_best_ = cost_arr[i].space_cost_ * 100 / MAX(cost_arr[0].space_cost_, 1);
+            if (cost_arr[i].percent_to_best_ <= 100 + SPACE_COST_TOLERANCE_PERCENT
+                && cost_arr[i].decode_cost_rank_ < cost_arr[best_idx].decode_cost_rank_) {
+              best_idx = i;
+            }
           }
+          const ObCodecCost &best_codec = cost_arr[best_idx];
           ctx_->meta_.set_encoding_type(best_codec.type_);
 
           STORAGE_LOG(INFO, "detect codec",
                       "best_codec", ObIntegerStream::get_encoding_type_name(best_codec.type_),
                       "best_codec_space_cost", best_codec.space_cost_,
                       "cost_list", ObArrayWrap<ObCodecCost>(cost_arr, candidate_count),
-                      KPC(ctx_), K(arr_count), K(sample_count));
+                      K(is_monotonic_inc), KPC(ctx_), K(arr_count), K(sample_count));
         }
       }
     }
@@ -401,36 +426,55 @@ private:
     return ret;
   }
 
+  // candidate encoding types are tiered by the statistics of the stream:
+  // 1. monotonic increasing stream, delta encodings first, xor and universal compression never win;
+  // 2. floating stream, delta of bit patterns is meaningless, only xor and pfor encodings are tried;
+  // 3. others, try all enabled encoding types.
   template<typename T>
-  void build_candidate_codec_list(ObIntegerStream::EncodingType *list, int32_t &count)
+  void build_candidate_codec_list(const bool is_monotonic_inc, ObIntegerStream::EncodingType *list, int32_t &count)
   {
-    count = 0;
-    if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::SIMD_FIXEDPFOR)) {
-      list[count++] = ObIntegerStream::EncodingType::SIMD_FIXEDPFOR;
-    }
-    if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_RLE)) {
-      list[count++] = ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_RLE;
-    }
-    if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_PFOR)) {
-      list[count++] = ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_PFOR;
-    }
-    if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::DELTA_ZIGZAG_RLE)) {
-      list[count++] = ObIntegerStream::EncodingType::DELTA_ZIGZAG_RLE;
-    }
-    if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::DELTA_ZIGZAG_PFOR)) {
-      list[count++] = ObIntegerStream::EncodingType::DELTA_ZIGZAG_PFOR;
+    static const ObIntegerStream::EncodingType MONOTONIC_TIER[] = {
+      ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_RLE,
+      ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_PFOR,
+      ObIntegerStream::EncodingType::DELTA_ZIGZAG_RLE,
+      ObIntegerStream::EncodingType::DELTA_ZIGZAG_PFOR,
+      ObIntegerStream::EncodingType::SIMD_FIXEDPFOR,
+    };
+    static const ObIntegerStream::EncodingType FLOATING_TIER[] = {
+      ObIntegerStream::EncodingType::XOR_FIXED_PFOR,
+      ObIntegerStream::EncodingType::SIMD_FIXEDPFOR,
+      ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS,
+    };
+    static const ObIntegerStream::EncodingType DEFAULT_TIER[] = {
+      ObIntegerStream::EncodingType::SIMD_FIXEDPFOR,
+      ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_RLE,
+      ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_PFOR,
+      ObIntegerStream::EncodingType::DELTA_ZIGZAG_RLE,
+      ObIntegerStream::EncodingType::DELTA_ZIGZAG_PFOR,
+      ObIntegerStream::EncodingType::XOR_FIXED_PFOR,
+      ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS,
+    };
+    const ObIntegerStream::EncodingType *tier = DEFAULT_TIER;
+    int64_t tier_count = ARRAYSIZEOF(DEFAULT_TIER);
+    if (is_monotonic_inc) {
+      tier = MONOTONIC_TIER;
+      tier_count = ARRAYSIZEOF(MONOTONIC_TIER);
+    } else if (ctx_->info_.is_floating_) {
+      tier = FLOATING_TIER;
+      tier_count = ARRAYSIZEOF(FLOATING_TIER);
     }
 
-    if (ctx_->info_.is_monotonic_inc_) {
-      // no other
-    } else {
-      if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::XOR_FIXED_PFOR)) {
-        list[count++] = ObIntegerStream::EncodingType::XOR_FIXED_PFOR;
-      }
-      if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS)
-        && (ctx_->info_.compressor_type_ != ObCompressorType::INVALID_COMPRESSOR)
-        && (ctx_->info_.compressor_type_ != ObCompressorType::NONE_COMPRESSOR)) {
-        list[count++] = ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS;
+    count = 0;
+    for (int64_t i = 0; i < tier_count; i++) {
+      const ObIntegerStream::EncodingType type = tier[i];
+      if (!ctx_->info_.encoding_opt_->is_enabled(type)) {
+        // disabled by encoding option
+      } else if (ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS == type
+          && (ctx_->info_.compressor_type_ == ObCompressorType::INVALID_COMPRESSOR
+              || ctx_->info_.compressor_type_ == ObCompressorType::NONE_COMPRESSOR)) {
+        // universal compression depends on compressor
+      } else {
+        list[count++] = type;
       }
     }
   }
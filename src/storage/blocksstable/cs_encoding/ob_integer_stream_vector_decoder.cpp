@@ -336,42 +336,94 @@ struct ConvertUintToVec_T<ObFixedLengthFormat<ValueType>, ValueType,
     const uint64_t base = ctx.meta_.is_use_base() * ctx.meta_.base_value_;
     uint64_t value = 0;
     uint32_t vec_len = 0;
-    for (int64_t i = 0; i < vector_ctx.row_cap_; i++) {
-      const int64_t curr_vec_offset = vector_ctx.vec_offset_ + i;
-      ValueType &vec_value = vec_value_arr[curr_vec_offset];
-      if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::HAS_NO_NULL) {
-        GET_SRC_VALUE(value);
-        HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
+    if (vector_ctx.row_cap_ <= 0) {
+      // nothing to decode
+    } else if (ref_width_V == ObVecDecodeRefWidth::VDRW_NOT_REF
+        && null_flag_V != ObBaseColumnDecoderCtx::ObNullFlag::IS_NULL_REPLACED_REF
+        && vector_ctx.row_ids_[vector_ctx.row_cap_ - 1] - vector_ctx.row_ids_[0] == vector_ctx.row_cap_ - 1) {
+      process_continuous_(base_col_ctx, store_uint_arr + vector_ctx.row_ids_[0], base,
+          vector_ctx, vec_value_arr + vector_ctx.vec_offset_, vector);
+    } else {
+      for (int64_t i = 0; i < vector_ctx.row_cap_; i++) {
+        const int64_t curr_vec_offset = vector_ctx.vec_offset_ + i;
+        ValueType &vec_value = vec_value_arr[curr_vec_offset];
+        if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::HAS_NO_NULL) {
+          GET_SRC_VALUE(value);
+          HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
 
-      } else if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::HAS_NULL_BITMAP) {
-        if (ObCSDecodingUtil::test_bit(base_col_ctx.null_bitmap_, vector_ctx.row_ids_[i])) {
-          vector.set_null(curr_vec_offset);
-        } else {
+        } else if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::HAS_NULL_BITMAP) {
+          if (ObCSDecodingUtil::test_bit(base_col_ctx.null_bitmap_, vector_ctx.row_ids_[i])) {
+            vector.set_null(curr_vec_offset);
+          } else {
+            OB_ASSERT(ref_width_V == ObVecDecodeRefWidth::VDRW_NOT_REF);
+            value = store_uint_arr[vector_ctx.row_ids_[i]] + base;
+            HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
+          }
+
+        } else if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::IS_NULL_REPLACED) {
           OB_ASSERT(ref_width_V == ObVecDecodeRefWidth::VDRW_NOT_REF);
           value = store_uint_arr[vector_ctx.row_ids_[i]] + base;
-          HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
-        }
+          if (value == base_col_ctx.null_replaced_value_) {
+            vector.set_null(curr_vec_offset);
+          } else {
+            HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
+          }
+
+        } else if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::IS_NULL_REPLACED_REF) {
+          GET_DICT_REF(ref);
+          if (ref == base_col_ctx.null_replaced_ref_) {
+            vector.set_null(curr_vec_offset); // must enter next loop, row_id maybe out of range of store_uint_arr
+          } else {
+            value = store_uint_arr[ref] + base;
+            HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
+          }
 
-      } else if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::IS_NULL_REPLACED) {
-        OB_ASSERT(ref_width_V == ObVecDecodeRefWidth::VDRW_NOT_REF);
-        value = store_uint_arr[vector_ctx.row_ids_[i]] + base;
-        if (value == base_col_ctx.null_replaced_value_) {
-          vector.set_null(curr_vec_offset);
         } else {
-          HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
+          ob_abort();
         }
+      }
+    }
+  }
 
-      } else if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::IS_NULL_REPLACED_REF) {
-        GET_DICT_REF(ref);
-        if (ref == base_col_ctx.null_replaced_ref_) {
-          vector.set_null(curr_vec_offset); // must enter next loop, row_id maybe out of range of store_uint_arr
+private:
+  // Row ids are continuous, so the store array is read sequentially and the base is added in
+  // a branch-free loop which can be vectorized by compiler. Values of null rows are written
+  // too and then covered by null flags of vector.
+  template<typename StoreIntType>
+  static void process_continuous_(
+      const ObBaseColumnDecoderCtx &base_col_ctx,
+      const StoreIntType *store_uint_arr,
+      const uint64_t base,
+      ObVectorDecodeCtx &vector_ctx,
+      ValueType *vec_value_arr,
+      ObFixedLengthFormat<ValueType> &vector)
+  {
+    const int64_t row_cap = vector_ctx.row_cap_;
+    for (int64_t i = 0; i < row_cap; i++) {
+      HANDLE_FIXED_VALUE_ASSIGN(vec_value_arr[i], store_uint_arr[i] + base);
+    }
+
+    if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::HAS_NULL_BITMAP) {
+      const uint8_t *null_bitmap = reinterpret_cast<const uint8_t *>(base_col_ctx.null_bitmap_);
+      const int64_t start_row_id = vector_ctx.row_ids_[0];
+      int64_t i = 0;
+      while (i < row_cap) {
+        const int64_t row_id = start_row_id + i;
+        if (0 == (row_id & 7) && i + 8 <= row_cap && 0 == null_bitmap[row_id >> 3]) {
+          i += 8; // skip 8 rows without null
         } else {
-          value = store_uint_arr[ref] + base;
-          HANDLE_FIXED_VALUE_ASSIGN(vec_value, value);
+          if (ObCSDecodingUtil::test_bit(base_col_ctx.null_bitmap_, row_id)) {
+            vector.set_null(vector_ctx.vec_offset_ + i);
+          }
+          i++;
+        }
+      }
+    } else if (null_flag_V == ObBaseColumnDecoderCtx::ObNullFlag::IS_NULL_REPLACED) {
+      const uint64_t null_replaced_value = base_col_ctx.null_replaced_value_;
+      for (int64_t i = 0; i < row_cap; i++) {
+        if (store_uint_arr[i] + base == null_replaced_value) {
+          vector.set_null(vector_ctx.vec_offset_ + i);
         }
-
-      } else {
-        ob_abort();
       }
     }
   }
@@ -22,6 +22,7 @@
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
 #include "storage/ob_i_store.h"
+#include "storage/compaction/ob_sstable_merge_history.h"
 
 namespace oceanbase
 {
@@ -240,6 +241,20 @@ void ObMicroBlockCSEncoder::reuse()
   all_string_data_len_ = 0;
 }
 
+void ObMicroBlockCSEncoder::fill_integer_codec_info(compaction::ObCSIntegerCodecInfo &info) const
+{
+  if (IS_INIT && OB_NOT_NULL(ctx_.col_descs_)) {
+    for (int32_t i = 0; i < ctx_.column_cnt_ && i < ctx_.col_descs_->count(); ++i) {
+      const ObPreviousColumnEncoding *previous = ctx_.previous_cs_encoding_.get_column_encoding(i);
+      if (previous->is_valid_
+          && ObCSColumnHeader::INTEGER == previous->identifier_.column_encoding_type_
+          && previous->identifier_.int_stream_count_ > 0) {
+        info.add(ctx_.col_descs_->at(i).col_id_, previous->stream_encoding_types_[0]);
+      }
+    }
+  }
+}
+
 void ObMicroBlockCSEncoder::dump_diagnose_info() const
 {
   int ret = OB_SUCCESS;
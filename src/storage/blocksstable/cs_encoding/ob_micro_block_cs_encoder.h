@@ -25,6 +25,10 @@
 
 namespace oceanbase
 {
+namespace compaction
+{
+struct ObCSIntegerCodecInfo;
+}
 namespace blocksstable
 {
 
@@ -63,6 +67,8 @@ public:
   }
   virtual int64_t get_original_size() const override { return all_headers_size_ + estimate_size_; }
   virtual void dump_diagnose_info() const override;
+  // integer stream codec of the last encoded micro block for each integer column
+  void fill_integer_codec_info(compaction::ObCSIntegerCodecInfo &info) const;
 
 private:
   int inner_init_();
@@ -91,6 +91,24 @@ struct ObIntegerStream
     }
   }
 
+  // relative cost of decoding one value, only used to break ties between encoding types
+  // with similar space cost. It must not depend on runtime measurement, otherwise replicas
+  // may choose different encoding types for the same data.
+  OB_INLINE static int64_t get_decode_cost_rank(const uint8_t type)
+  {
+    switch (type) {
+      case RAW:                        { return 0; }
+      case SIMD_FIXEDPFOR:             { return 1; }
+      case DELTA_ZIGZAG_PFOR:          { return 2; }
+      case XOR_FIXED_PFOR:             { return 2; }
+      case DOUBLE_DELTA_ZIGZAG_PFOR:   { return 3; }
+      case DELTA_ZIGZAG_RLE:           { return 4; }
+      case DOUBLE_DELTA_ZIGZAG_RLE:    { return 5; }
+      case UNIVERSAL_COMPRESS:         { return 8; }
+      default:                         { return INT64_MAX; }
+    }
+  }
+
   enum UintWidth: uint8_t
   {
     UW_1_BYTE     = 0,
@@ -279,18 +297,20 @@ struct ObIntegerStreamEncoderInfo
   {
     has_null_datum_ = false;
     is_monotonic_inc_ = false;
+    is_floating_ = false;
     encoding_opt_ = nullptr;
     previous_encoding_ = nullptr;
     stream_idx_ = -1;
     ObIAllocator *allocator_ = nullptr;
     compressor_type_ = ObCompressorType::INVALID_COMPRESSOR;
   }
-  TO_STRING_KV(K_(has_null_datum), K_(is_monotonic_inc),
+  TO_STRING_KV(K_(has_null_datum), K_(is_monotonic_inc), K_(is_floating),
       KP_(encoding_opt), KPC_(previous_encoding), K_(stream_idx),
       KP_(allocator), "compressor_type", all_compressor_name[compressor_type_]);
 
   bool has_null_datum_;
   bool is_monotonic_inc_;
+  bool is_floating_; // values are bit patterns of float/double
   const ObCSEncodingOpt *encoding_opt_;
   const ObPreviousColumnEncoding *previous_encoding_;
   int32_t stream_idx_;
@@ -1384,6 +1384,58 @@ public:
   }))
 };
 
+template <typename DataType>
+class RawBetweenFunctionImpl {
+public:
+  // left <= a <= right is evaluated as (a - left) <= (right - left) on unsigned data,
+  // so only one comparison is needed and GCC can vectorize the loop.
+  OB_MULTITARGET_FUNCTION_AVX2_SSE42(
+  OB_MULTITARGET_FUNCTION_HEADER(static void), raw_between_function, OB_MULTITARGET_FUNCTION_BODY((
+      const unsigned char* raw_data,
+      const uint64_t left_value,
+      const uint64_t right_value,
+      uint8_t* selection,
+      uint32_t from,
+      uint32_t to)
+  {
+    const DataType left = static_cast<DataType>(left_value);
+    const DataType range = static_cast<DataType>(right_value - left_value);
+    const DataType *start_pos = reinterpret_cast<const DataType *>(raw_data);
+    const DataType *a_end = start_pos + to;
+    const DataType * __restrict a_pos = start_pos + from;
+    uint8_t * __restrict c_pos = selection;
+    while (a_pos < a_end) {
+      *c_pos = static_cast<DataType>(*a_pos - left) <= range;
+      ++a_pos;
+      ++c_pos;
+    }
+  }))
+
+  OB_MULTITARGET_FUNCTION_AVX2_SSE42(
+  OB_MULTITARGET_FUNCTION_HEADER(static void), raw_between_function_with_null, OB_MULTITARGET_FUNCTION_BODY((
+      const unsigned char* raw_data,
+      const uint64_t left_value,
+      const uint64_t right_value,
+      const uint64_t null_node_value,
+      uint8_t* selection,
+      uint32_t from,
+      uint32_t to)
+  {
+    const DataType left = static_cast<DataType>(left_value);
+    const DataType range = static_cast<DataType>(right_value - left_value);
+    const DataType null_value = static_cast<DataType>(null_node_value);
+    const DataType *start_pos = reinterpret_cast<const DataType *>(raw_data);
+    const DataType *a_end = start_pos + to;
+    const DataType * __restrict a_pos = start_pos + from;
+    uint8_t * __restrict c_pos = selection;
+    while (a_pos < a_end) {
+      *c_pos = (uint8_t)(*a_pos != null_value) & (uint8_t)(static_cast<DataType>(*a_pos - left) <= range);
+      ++a_pos;
+      ++c_pos;
+    }
+  }))
+};
+
 template <bool IS_SIGNED, int32_t LEN_TAG>
 struct RawCompareFunctionProducer
 {
@@ -1468,6 +1520,30 @@ struct RawCompareFunctionProducer
     return cmp_funtion;
   }
 
+  static raw_between_function produce_between_for_cs()
+  {
+    typedef typename ObEncodingTypeInference<IS_SIGNED, LEN_TAG>::Type DataType;
+    raw_between_function bt_function = RawBetweenFunctionImpl<DataType>::raw_between_function;
+#if OB_USE_MULTITARGET_CODE
+    if (is_arch_supported(ObTargetArch::AVX2)) {
+      bt_function = RawBetweenFunctionImpl<DataType>::raw_between_function_avx2;
+    }
+#endif
+    return bt_function;
+  }
+
+  static raw_between_function_with_null produce_between_with_null_for_cs()
+  {
+    typedef typename ObEncodingTypeInference<IS_SIGNED, LEN_TAG>::Type DataType;
+    raw_between_function_with_null bt_function = RawBetweenFunctionImpl<DataType>::raw_between_function_with_null;
+#if OB_USE_MULTITARGET_CODE
+    if (is_arch_supported(ObTargetArch::AVX2)) {
+      bt_function = RawBetweenFunctionImpl<DataType>::raw_between_function_with_null_avx2;
+    }
+#endif
+    return bt_function;
+  }
+
   static raw_compare_function_with_null produce_with_null_for_cs(
       const sql::ObWhiteFilterOperatorType op_type)
   {
@@ -1580,6 +1656,15 @@ RawCompareFunctionFactory::RawCompareFunctionFactory()
     cs_functions_with_null_array_[3][k] = RawCompareFunctionProducer<0, 3>::produce_with_null_for_cs(
         static_cast<sql::ObWhiteFilterOperatorType>(k));
   }
+
+  cs_between_functions_[0] = RawCompareFunctionProducer<0, 0>::produce_between_for_cs();
+  cs_between_functions_[1] = RawCompareFunctionProducer<0, 1>::produce_between_for_cs();
+  cs_between_functions_[2] = RawCompareFunctionProducer<0, 2>::produce_between_for_cs();
+  cs_between_functions_[3] = RawCompareFunctionProducer<0, 3>::produce_between_for_cs();
+  cs_between_functions_with_null_[0] = RawCompareFunctionProducer<0, 0>::produce_between_with_null_for_cs();
+  cs_between_functions_with_null_[1] = RawCompareFunctionProducer<0, 1>::produce_between_with_null_for_cs();
+  cs_between_functions_with_null_[2] = RawCompareFunctionProducer<0, 2>::produce_between_with_null_for_cs();
+  cs_between_functions_with_null_[3] = RawCompareFunctionProducer<0, 3>::produce_between_with_null_for_cs();
 }
 
 RawCompareFunctionFactory &RawCompareFunctionFactory::instance()
@@ -1614,6 +1699,27 @@ raw_compare_function_with_null RawCompareFunctionFactory::get_cs_cmp_function_wi
   return cmp_function;
 }
 
+raw_between_function RawCompareFunctionFactory::get_cs_between_function(const int32_t fix_len_tag)
+{
+  raw_between_function bt_function = nullptr;
+  if (OB_UNLIKELY(fix_len_tag < 0 || fix_len_tag >= FIX_LEN_TAG_CNT)) {
+  } else {
+    bt_function = cs_between_functions_[fix_len_tag];
+  }
+  return bt_function;
+}
+
+raw_between_function_with_null RawCompareFunctionFactory::get_cs_between_function_with_null(
+    const int32_t fix_len_tag)
+{
+  raw_between_function_with_null bt_function = nullptr;
+  if (OB_UNLIKELY(fix_len_tag < 0 || fix_len_tag >= FIX_LEN_TAG_CNT)) {
+  } else {
+    bt_function = cs_between_functions_with_null_[fix_len_tag];
+  }
+  return bt_function;
+}
+
 template <typename DataType, typename Op>
 class RawAggFunctionImpl
 {
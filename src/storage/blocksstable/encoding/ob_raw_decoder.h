@@ -66,6 +66,24 @@ typedef void (*raw_compare_function_with_null)(
             uint32_t from,
             uint32_t to);
 
+// left_value <= value <= right_value, both bounds are in the stored domain
+typedef void (*raw_between_function)(
+            const unsigned char* raw_data,
+            const uint64_t left_value,
+            const uint64_t right_value,
+            uint8_t* selection,
+            uint32_t from,
+            uint32_t to);
+
+typedef void (*raw_between_function_with_null)(
+            const unsigned char* raw_data,
+            const uint64_t left_value,
+            const uint64_t right_value,
+            const uint64_t null_node_value,
+            uint8_t* selection,
+            uint32_t from,
+            uint32_t to);
+
 typedef void (*raw_min_max_function)(
             const unsigned char *raw_data,
             uint32_t from,
@@ -100,6 +118,8 @@ public:
   raw_compare_function_with_null get_cs_cmp_function_with_null(
       const int32_t fix_len_tag,
       const sql::ObWhiteFilterOperatorType op_type);
+  raw_between_function get_cs_between_function(const int32_t fix_len_tag);
+  raw_between_function_with_null get_cs_between_function_with_null(const int32_t fix_len_tag);
 private:
   RawCompareFunctionFactory();
   ~RawCompareFunctionFactory() = default;
@@ -107,6 +127,8 @@ private:
 private:
   ObMultiDimArray_T<raw_compare_function, IS_SIGNED_CNT, FIX_LEN_TAG_CNT, OP_TYPE_CNT> functions_array_;
   ObMultiDimArray_T<raw_compare_function_with_null, FIX_LEN_TAG_CNT, OP_TYPE_CNT> cs_functions_with_null_array_;
+  raw_between_function cs_between_functions_[FIX_LEN_TAG_CNT];
+  raw_between_function_with_null cs_between_functions_with_null_[FIX_LEN_TAG_CNT];
 };
 
 class RawAggFunctionFactory
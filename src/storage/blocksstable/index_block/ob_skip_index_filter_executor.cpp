@@ -590,7 +590,7 @@ int ObSkipIndexFilterExecutor::black_filter_on_min_max(
   ObStorageDatum null_count;
   ObStorageDatum min_datum;
   ObStorageDatum max_datum;
-  if (OB_UNLIKELY(!filter.is_monotonic())) {
+  if (OB_UNLIKELY(!filter.is_monotonic() && !filter.has_bloom_runtime_filter())) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid black filter, filter is not monotonic", K(ret), K(filter));
   } else if (OB_FAIL(read_aggregate_data(col_idx, allocator, col_param,
@@ -615,6 +615,12 @@ int ObSkipIndexFilterExecutor::black_filter_on_min_max(
     const bool has_null = null_count.get_int() > 0 && null_count.get_int() < row_count;
     if (is_all_null) {
       fal_desc.set_always_false();
+    } else if (!filter.is_monotonic()) {
+      // bloom runtime filter, the block can be skipped only if its min/max is out of the
+      // join key range, otherwise the bloom filter is still checked row by row
+      if (OB_FAIL(filter.check_runtime_filter_key_range(min_datum, max_datum, fal_desc))) {
+        LOG_WARN("Failed to check runtime filter key range", K(ret), K(min_datum), K(max_datum));
+      }
     } else if (OB_FAIL(check_skip_by_monotonicity(filter,
                                                   min_datum,
                                                   max_datum,
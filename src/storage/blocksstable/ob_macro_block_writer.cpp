@@ -635,6 +635,7 @@ int ObMacroBlockWriter::append(const ObDataMacroBlockMeta &macro_meta,
     merge_block_info_.macro_block_count_++;
     merge_block_info_.total_row_count_ += macro_meta.val_.row_count_;
     merge_block_info_.occupy_size_ += macro_meta.val_.occupy_size_;
+    merge_block_info_.multiplexed_size_ += macro_meta.val_.occupy_size_;
   }
 
   if (OB_SUCC(ret) && !data_store_desc_->is_cg()) {
@@ -775,6 +776,7 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block, cons
         STORAGE_LOG(WARN, "Failed to write micro block, ", K(ret), K(micro_block_desc));
       } else {
         merge_block_info_.multiplexed_micro_count_in_new_macro_++;
+        merge_block_info_.multiplexed_size_ += micro_block_desc.get_block_size();
       }
 
       if (OB_SUCC(ret) && nullptr != data_aggregator_) {
@@ -882,6 +884,11 @@ int ObMacroBlockWriter::close()
       }
     }
 
+    if (OB_SUCC(ret) && data_store_desc_->encoding_enabled()
+        && ObStoreFormat::is_row_store_type_with_cs_encoding(data_store_desc_->get_row_store_type())) {
+      static_cast<ObMicroBlockCSEncoder *>(micro_writer_)->fill_integer_codec_info(
+          merge_block_info_.cs_integer_codec_info_);
+    }
     if (OB_SUCC(ret) && OB_NOT_NULL(builder_)) {
       if (OB_FAIL(builder_->close(last_key_, &block_write_ctx_))) {
         STORAGE_LOG(WARN, "fail to close data index builder", K(ret), K(last_key_));
@@ -331,6 +331,40 @@ int ObCOTabletMergeCtx::collect_running_info_in_batch(
 {
   int ret = OB_SUCCESS;
   ObSSTableMergeHistory &merge_history = cg_merge_info_array_[start_cg_idx]->get_merge_history();
+  // record reused/rewritten size(KB) of the batch and the cgs reusing most before block info of the batch
+  // is aggregated into start cg, batch size may grow adaptively, so cgs are not listed one by one
+  char cg_reuse_info[MAX_CG_REUSE_INFO_LENGTH] = "\0";
+  int64_t pos = 0;
+  int64_t total_reuse_size = 0;
+  int64_t total_rewrite_size = 0;
+  int64_t top_cg_idxs[MAX_CG_REUSE_INFO_TOP_CNT];
+  int64_t top_cg_cnt = 0;
+  for (int64_t idx = start_cg_idx; idx < end_cg_idx; ++idx) {
+    const ObMergeBlockInfo &block_info = cg_merge_info_array_[idx]->get_merge_history().block_info_;
+    total_reuse_size += block_info.multiplexed_size_;
+    total_rewrite_size += block_info.get_rewrite_size();
+    if (block_info.multiplexed_size_ <= 0) {
+    } else if (top_cg_cnt < MAX_CG_REUSE_INFO_TOP_CNT
+        || block_info.multiplexed_size_ > cg_merge_info_array_[top_cg_idxs[top_cg_cnt - 1]]->get_merge_history().block_info_.multiplexed_size_) {
+      // keep top_cg_idxs sorted by reused size in descending order
+      int64_t insert_pos = top_cg_cnt < MAX_CG_REUSE_INFO_TOP_CNT ? top_cg_cnt++ : top_cg_cnt - 1;
+      while (insert_pos > 0 && block_info.multiplexed_size_
+          > cg_merge_info_array_[top_cg_idxs[insert_pos - 1]]->get_merge_history().block_info_.multiplexed_size_) {
+        top_cg_idxs[insert_pos] = top_cg_idxs[insert_pos - 1];
+        --insert_pos;
+      }
+      top_cg_idxs[insert_pos] = idx;
+    }
+  }
+  (void) databuff_printf(cg_reuse_info, sizeof(cg_reuse_info), pos, "total:%ld/%ld",
+      total_reuse_size >> 10, total_rewrite_size >> 10);
+  for (int64_t i = 0; i < top_cg_cnt; ++i) {
+    const ObMergeBlockInfo &block_info = cg_merge_info_array_[top_cg_idxs[i]]->get_merge_history().block_info_;
+    (void) databuff_printf(cg_reuse_info, sizeof(cg_reuse_info), pos, "|%ld:%ld/%ld",
+        top_cg_idxs[i], block_info.multiplexed_size_ >> 10, block_info.get_rewrite_size() >> 10);
+  }
+  ADD_COMPACTION_INFO_PARAM(merge_history.running_info_.comment_, sizeof(merge_history.running_info_.comment_),
+      "cg_reuse_kb", cg_reuse_info);
   for (int64_t idx = start_cg_idx + 1; OB_SUCC(ret) && idx < end_cg_idx; ++idx) {
     const ObSSTableMergeHistory &tmp = cg_merge_info_array_[idx]->get_merge_history();
     if (OB_FAIL(merge_history.update_block_info(tmp.block_info_, true/*without_row_cnt*/))) {
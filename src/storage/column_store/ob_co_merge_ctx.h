@@ -155,6 +155,8 @@ struct ObCOTabletMergeCtx : public ObBasicTabletMergeCtx
       K_(array_count), K_(exe_stat));
   virtual int mark_cg_finish(const int64_t start_cg_idx, const int64_t end_cg_idx) { return OB_SUCCESS; }
   static const int64_t DEFAULT_CG_MERGE_BATCH_SIZE = 10;
+  static const int64_t MAX_CG_REUSE_INFO_TOP_CNT = 3;
+  static const int64_t MAX_CG_REUSE_INFO_LENGTH = 128;
   static const int64_t SCHEDULE_MINOR_CG_CNT_THREASHOLD = 20;
   static const int64_t SCHEDULE_MINOR_TABLE_CNT_THREASHOLD = 3;
   static const int64_t SCHEDULE_MINOR_ROW_CNT_THREASHOLD = 100 * 1000L;
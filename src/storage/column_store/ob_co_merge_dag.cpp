@@ -27,6 +27,7 @@
 #include "storage/meta_mem/ob_tenant_meta_mem_mgr.h"
 #include "storage/column_store/ob_co_merge_ctx.h"
 #include "observer/ob_server_event_history_table_operator.h"
+#include "storage/compaction/ob_compaction_memory_pool.h"
 
 namespace oceanbase
 {
@@ -106,6 +107,34 @@ void ObCOMergeDag::set_dag_error_location()
   }
 }
 
+bool ObCOMergeDag::check_can_schedule()
+{
+  bool bret = true;
+  ObCOMergeDagNet *dag_net = static_cast<ObCOMergeDagNet*>(get_dag_net());
+  if (OB_ISNULL(dag_net) || !dag_net->is_admitted()) {
+    bret = ObTabletMergeDag::check_can_schedule();
+  }
+  return bret;
+}
+
+bool ObCOMergeDag::try_admit()
+{
+  bool bret = true;
+  ObCOMergeDagNet *dag_net = static_cast<ObCOMergeDagNet*>(get_dag_net());
+  ObTenantCompactionMemPool *mem_pool = nullptr;
+  int64_t estimate_mem = 0;
+  bool force = false;
+  if (OB_ISNULL(dag_net)) {
+    bret = ObTabletMergeDag::try_admit();
+  } else if (dag_net->is_admitted()) {
+    // admitted by the prior dag of the dag net
+  } else if (!need_admission_(mem_pool, estimate_mem, force)) {
+  } else {
+    bret = dag_net->try_admit(mem_pool->get_mem_broker(), estimate_mem, force);
+  }
+  return bret;
+}
+
 /*
  * ObCOMergePrepareDag
  * */
@@ -1013,6 +1042,8 @@ ObCOMergeDagNet::ObCOMergeDagNet()
     ObMergeDagHash(),
     is_inited_(false),
     finish_added_(false),
+    is_admitted_(false),
+    admitted_mem_(0),
     batch_reduced_(false),
     ctx_lock_(),
     merge_batch_size_(ObCOTabletMergeCtx::DEFAULT_CG_MERGE_BATCH_SIZE),
@@ -1034,6 +1065,7 @@ ObCOMergeDagNet::ObCOMergeDagNet()
 ObCOMergeDagNet::~ObCOMergeDagNet()
 {
   finish_dag_ = nullptr;
+  release_admission_();
   if (OB_NOT_NULL(co_merge_ctx_)) {
     co_merge_ctx_->~ObCOTabletMergeCtx();
     tmp_allocator_.free(co_merge_ctx_);
@@ -1120,9 +1152,39 @@ int ObCOMergeDagNet::schedule_rest_dag()
  */
 int ObCOMergeDagNet::clear_dag_net_ctx()
 {
+  release_admission_();
   return ObIDagNet::clear_dag_net_ctx();
 }
 
+bool ObCOMergeDagNet::try_admit(
+    ObCompactionMemBroker &mem_broker,
+    const int64_t estimate_mem,
+    const bool force)
+{
+  bool bret = true;
+  if (is_admitted()) {
+  } else if (!mem_broker.try_admit(estimate_mem, force)) {
+    bret = false;
+    LOG_DEBUG("compaction memory is not enough, co merge should wait", K(estimate_mem),
+        K(mem_broker), K_(ls_id), K_(tablet_id));
+  } else if (ATOMIC_BCAS(&is_admitted_, false, true)) {
+    ATOMIC_STORE(&admitted_mem_, estimate_mem);
+  } else {
+    // admitted by another dag of the dag net concurrently
+    mem_broker.release(estimate_mem);
+  }
+  return bret;
+}
+
+void ObCOMergeDagNet::release_admission_()
+{
+  const int64_t admitted_mem = ATOMIC_TAS(&admitted_mem_, 0);
+  ObTenantCompactionMemPool *mem_pool = nullptr;
+  if (admitted_mem > 0 && OB_NOT_NULL(mem_pool = MTL(ObTenantCompactionMemPool *))) {
+    mem_pool->get_mem_broker().release(admitted_mem);
+  }
+}
+
 #define MARK_CG_SCHEDULE_STATUS(start_cg_idx, end_cg_idx, target_status) \
     for (int64_t i = start_cg_idx; i < end_cg_idx; ++i) { \
       if (ObCOTabletMergeCtx::CG_SCHE_STATUS_FINISHED != co_merge_ctx_->cg_schedule_status_array_[i]) { \
@@ -1621,6 +1683,7 @@ int ObCOMergeDagNet::prepare_co_merge_ctx()
   } else if (OB_ISNULL(co_merge_ctx_)) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("failed to alloc ctx", KR(ret), K_(co_merge_ctx));
+  } else if (FALSE_IT(co_merge_ctx_->mem_ctx_.set_admitted_mem(ATOMIC_LOAD(&admitted_mem_)))) {
   } else if (FALSE_IT(co_merge_ctx_->init_time_guard(get_add_time()))) {
   } else if (FALSE_IT(co_merge_ctx_->time_guard_click(ObStorageCompactionTimeGuard::DAG_WAIT_TO_SCHEDULE))) {
   } else if (OB_FAIL(co_merge_ctx_->build_ctx(finish_flag))) {
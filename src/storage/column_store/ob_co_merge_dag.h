@@ -28,6 +28,7 @@ struct ObUpdateTableStoreParam;
 namespace compaction
 {
 class ObCOMergeDagNet;
+class ObCompactionMemBroker;
 // [start_cg_idx_, end_cg_idx_)
 struct ObCOMergeDagParam : public ObTabletMergeDagParam
 {
@@ -51,6 +52,9 @@ public:
   virtual int fill_info_param(compaction::ObIBasicInfoParam *&out_param, ObIAllocator &allocator) const override;
   virtual ObBasicTabletMergeCtx *get_ctx() override { return nullptr; } // always return nullptr in co dag.
   virtual void set_dag_error_location() override;
+  // all dags of co merge share one merge ctx, the memory is admitted once for the dag net
+  virtual bool check_can_schedule() override;
+  virtual bool try_admit() override;
 };
 /*
  * Prepare DAG
@@ -217,6 +221,8 @@ public:
   virtual int init_by_param(const share::ObIDagInitParam *param) override;
   virtual int create_first_task() override;
   virtual bool check_can_schedule() override;
+  // finish dag only waits for the exe dags, it never waits for compaction memory
+  virtual bool try_admit() override { return true; }
 
   INHERIT_TO_STRING_KV("ObTabletMergeDag", ObTabletMergeDag, K_(dag_net_id));
 private:
@@ -297,6 +303,8 @@ public:
   int get_compat_mode();
   int swap_tablet_after_minor();
   ObCOTabletMergeCtx *get_merge_ctx() const { return co_merge_ctx_; }
+  bool is_admitted() const { return ATOMIC_LOAD(&is_admitted_); }
+  bool try_admit(ObCompactionMemBroker &mem_broker, const int64_t estimate_mem, const bool force);
   const ObCOMergeDagParam& get_dag_param() const { return basic_param_; }
   void collect_running_info(const uint32_t start_cg_idx, const uint32_t end_cg_idx, const int64_t hash,
       const share::ObDagId &dag_id, const ObCompactionTimeGuard &time_guard);
@@ -308,7 +316,7 @@ public:
     share::ObIDag *parent = nullptr,
     const bool add_scheduler_flag = true);
   INHERIT_TO_STRING_KV("ObIDagNet", ObIDagNet, K_(is_inited), K_(merge_status), K_(finish_added),
-      K_(merge_batch_size), K_(basic_param), KP_(finish_dag));
+      K_(merge_batch_size), K_(is_admitted), K_(admitted_mem), K_(basic_param), KP_(finish_dag));
 private:
   static const int64_t DELAY_SCHEDULE_FINISH_DAG_CG_CNT = 150;
   static const int64_t DEFAULT_MAX_RETRY_TIMES = 2;
@@ -345,9 +353,12 @@ private:
       common::ObIArray<ObCOMergeBatchExeDag *> &dag_array,
       ObCOMergeBatchExeDag *&dag);
   void inner_free_exe_dag(ObCOMergeBatchExeDag *&dag); // lock in inner_free_exe_dags
+  void release_admission_();
 private:
   bool is_inited_;
   bool finish_added_;
+  bool is_admitted_;
+  int64_t admitted_mem_; // compaction memory admitted for the whole co merge
   bool batch_reduced_; // only reduce batch_size one time in a round // locked by ctx_lock_
   lib::ObMutex ctx_lock_;
   int64_t merge_batch_size_; // will decrease when meet memory allocate failed
@@ -304,9 +304,10 @@ ObMergeLevel ObStaticMergeParam::get_merge_level_for_sstable(
 {
   ObMergeLevel ret_merge_level = merge_level_;
   if (!is_full_merge_ && data_version_ >= DATA_VERSION_4_3_3_0) { // expect full merge
-    if (MACRO_BLOCK_MERGE_LEVEL == ret_merge_level && sstable.is_cg_sstable()) {
+    // micro blocks written with old schema can't be reused when schema changed
+    if (MACRO_BLOCK_MERGE_LEVEL == ret_merge_level && sstable.is_cg_sstable() && !is_schema_changed_) {
       ret_merge_level = MICRO_BLOCK_MERGE_LEVEL;
-      LOG_INFO("for cg sstable, ignore macro merge level when progressive", K(sstable), K(ret_merge_level));
+      LOG_TRACE("for cg sstable, ignore macro merge level when progressive", K(sstable), K(ret_merge_level));
 #ifdef ERRSIM
       SERVER_EVENT_SYNC_ADD("merge_errsim", "cg_disable_progressive", "tablet_id", get_tablet_id(),
           "sstable", sstable.get_key());
@@ -785,6 +786,9 @@ void ObBasicTabletMergeCtx::add_sstable_merge_info(
   if (running_info.execute_time_ > 30_s && (get_concurrent_cnt() > 1 || end_cg_idx > 0)) {
     ADD_COMMENT("execute_time", running_info.execute_time_);
   }
+  if (get_concurrent_cnt() > 1) {
+    parallel_merge_ctx_.fill_split_comment(running_info.comment_, sizeof(running_info.comment_));
+  }
   int64_t mem_peak_mb = mem_ctx_.get_total_mem_peak() >> 20;
   if (mem_peak_mb > 0) {
     ADD_COMMENT("cost_mb", mem_peak_mb);
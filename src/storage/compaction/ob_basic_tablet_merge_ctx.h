@@ -53,7 +53,8 @@ struct ObStaticMergeParam final
     is_full_merge_ = is_full_merge;
     merge_level_ = MACRO_BLOCK_MERGE_LEVEL;
   }
-  ObMergeLevel get_merge_level_for_sstable(const ObSSTable &sstable) const; // unused
+  // cg sstable reuses unchanged micro blocks even when macro merge level is chosen for progressive merge
+  ObMergeLevel get_merge_level_for_sstable(const ObSSTable &sstable) const;
 private:
   int init_multi_version_column_descs();
 
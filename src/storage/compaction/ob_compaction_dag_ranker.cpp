@@ -58,6 +58,24 @@ int ObCompactionEstimator::estimate_compaction_memory(
   return ret;
 }
 
+int ObCompactionEstimator::estimate_merge_peak_memory(
+    const int64_t priority,
+    const ObCompactionParam &param,
+    int64_t &estimate_mem_usage)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(estimate_compaction_memory(priority, param, estimate_mem_usage))) {
+    LOG_WARN("failed to estimate compaction memory", K(ret), K(priority), K(param));
+  } else if (param.column_cnt_ > 0) {
+    int64_t column_mem = COMPACTION_COLUMN_MEM * param.column_cnt_;
+    if (param.is_encoding_) {
+      column_mem *= ENCODING_COLUMN_MEM_FACTOR;
+    }
+    estimate_mem_usage += column_mem * MAX(1, param.estimate_concurrent_cnt_);
+  }
+  return ret;
+}
+
 int64_t ObCompactionEstimator::estimate_compaction_batch_size(
     const compaction::ObMergeType merge_type,
     const int64_t compaction_mem_limit,
@@ -78,6 +96,30 @@ int64_t ObCompactionEstimator::estimate_compaction_batch_size(
   return mem_allow_batch_size;
 }
 
+uint64_t ObCompactionEstimator::estimate_read_amp_benefit(
+    const int64_t query_cnt,
+    const int64_t exist_row_table_cnt,
+    const int64_t table_cnt,
+    const int64_t reduced_table_cnt,
+    const int64_t write_size)
+{
+  uint64_t benefit = 0;
+
+  if (query_cnt <= 0 && exist_row_table_cnt <= 0) {
+    // cold tablet, compaction saves nothing for queries
+  } else if (table_cnt <= 1 || reduced_table_cnt <= 0) {
+    // no read amplification to reduce
+  } else {
+    // every scan and get reads reduced_cnt less tables after compaction,
+    // the exist row checks are assumed to be spread evenly over the tables.
+    const int64_t reduced_cnt = MIN(reduced_table_cnt, table_cnt - 1);
+    const int64_t saved_read_cnt = MAX(query_cnt, 0) * reduced_cnt
+                                 + MAX(exist_row_table_cnt, 0) * reduced_cnt / table_cnt;
+    benefit = saved_read_cnt * READ_AMP_BENEFIT_UNIT_SIZE / MAX(write_size, READ_AMP_BENEFIT_UNIT_SIZE);
+  }
+  return benefit;
+}
+
 
 #define CALCULATE_NORMALIZED_RANK_SCORE(dimension, val, weight, score)             \
   ({                                                                               \
@@ -231,7 +273,9 @@ int ObMiniCompactionRankHelper::get_rank_weighed_score(
 ObMinorCompactionRankHelper::ObMinorCompactionRankHelper(const int64_t rank_time)
   : ObCompactionRankHelper(rank_time),
     max_parallel_dag_cnt_(0),
-    min_parallel_dag_cnt_(INT64_MAX)
+    min_parallel_dag_cnt_(INT64_MAX),
+    max_read_amp_benefit_(0),
+    min_read_amp_benefit_(UINT64_MAX)
 {
 }
 
@@ -239,7 +283,8 @@ bool ObMinorCompactionRankHelper::is_valid() const
 {
   bool bret = true;
   if (!ObCompactionRankHelper::is_valid() ||
-      max_parallel_dag_cnt_ < min_parallel_dag_cnt_) {
+      max_parallel_dag_cnt_ < min_parallel_dag_cnt_ ||
+      max_read_amp_benefit_ < min_read_amp_benefit_) {
     bret = false;
   }
   return bret;
@@ -249,7 +294,8 @@ bool ObMinorCompactionRankHelper::check_need_rank() const
 {
   bool bret = true;
   if (ObCompactionRankHelper::check_need_rank()) {
-  } else if (max_parallel_dag_cnt_ <= min_parallel_dag_cnt_) {
+  } else if (max_parallel_dag_cnt_ <= min_parallel_dag_cnt_ &&
+             max_read_amp_benefit_ <= min_read_amp_benefit_) {
     bret = false;
   }
   return bret;
@@ -264,6 +310,9 @@ void ObMinorCompactionRankHelper::update(
 
     max_parallel_dag_cnt_ = MAX(max_parallel_dag_cnt_, param.parallel_dag_cnt_);
     min_parallel_dag_cnt_ = MIN(min_parallel_dag_cnt_, param.parallel_dag_cnt_);
+
+    max_read_amp_benefit_ = MAX(max_read_amp_benefit_, param.read_amp_benefit_);
+    min_read_amp_benefit_ = MIN(min_read_amp_benefit_, param.read_amp_benefit_);
   }
 }
 
@@ -276,6 +325,7 @@ int ObMinorCompactionRankHelper::get_rank_weighed_score(
   const int8_t SSTABLE_CNT_WEIGHT = -5;
   const int8_t PARALLEL_DAG_CNT_WEIGHT = 3;
   const int8_t PARALLEL_SSTABLE_CNT_WEIGHT = -1;
+  const int8_t READ_AMP_BENEFIT_WEIGHT = -6; // prefer the dag saving most table reads per written byte
 
   if (OB_UNLIKELY(!is_valid())) {
     ret = OB_INVALID_ARGUMENT;
@@ -299,6 +349,8 @@ int ObMinorCompactionRankHelper::get_rank_weighed_score(
         LOG_WARN("failed to calculate rank score for parallel dag cnt", K(ret));
       } else if (OB_FAIL(CALCULATE_NORMALIZED_RANK_SCORE(wait_time, rank_time_ - param.add_time_, FIFO_WIEGHT, param.score_))) {
         LOG_WARN("failed to calculate rank score for wait time", K(ret));
+      } else if (OB_FAIL(CALCULATE_NORMALIZED_RANK_SCORE(read_amp_benefit, param.read_amp_benefit_, READ_AMP_BENEFIT_WEIGHT, param.score_))) {
+        LOG_WARN("failed to calculate rank score for read amp benefit", K(ret));
       } else {
         param.score_ += param.parallel_sstable_cnt_ * 10000 / param.sstable_cnt_ * PARALLEL_SSTABLE_CNT_WEIGHT;
       }
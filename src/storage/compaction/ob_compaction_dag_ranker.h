@@ -32,11 +32,30 @@ public:
     const int64_t priority,
     const ObCompactionParam &param,
     int64_t &estimate_mem_usage);
+  // peak memory used for admission, adds the row buffers and micro block writers of wide rows
+  static int estimate_merge_peak_memory(
+    const int64_t priority,
+    const ObCompactionParam &param,
+    int64_t &estimate_mem_usage);
   static int64_t estimate_compaction_batch_size(
     const compaction::ObMergeType merge_type,
     const int64_t compaction_mem_limit,
     const int64_t concurrent_cnt,
     const int64_t sstable_cnt);
+  /*
+   * Read amplification benefit of a compaction: table reads saved for the recent queries of the tablet
+   * if the compaction were finished, divided by the data size the compaction has to write (in MB).
+   * query_cnt: scan and get count of the tablet in the latest stat period
+   * exist_row_table_cnt: tables accessed by the exist row checks in the latest stat period
+   * table_cnt: tables each query has to read now, including memtables
+   * reduced_table_cnt: tables eliminated by the compaction
+   */
+  static uint64_t estimate_read_amp_benefit(
+    const int64_t query_cnt,
+    const int64_t exist_row_table_cnt,
+    const int64_t table_cnt,
+    const int64_t reduced_table_cnt,
+    const int64_t write_size);
 
 public:
   static constexpr int64_t DEFAULT_MERGE_THREAD_CNT = 6;
@@ -51,7 +70,10 @@ public:
   static constexpr int64_t COMPACTION_RESERVED_MEM = 2 * 1024L * 1024L; // 2MB
   static constexpr int64_t COMPACTION_CONCURRENT_MEM_FACTOR = 6 * 1024L * 1024L; // 6MB
   static constexpr int64_t DEFAULT_COMPACTION_MEM = 22 * 1024L * 1024L; // 22MB
+  static constexpr int64_t COMPACTION_COLUMN_MEM = 32 * 1024L; // 32KB
+  static constexpr int64_t ENCODING_COLUMN_MEM_FACTOR = 2;
   static constexpr int64_t DEFAULT_BATCH_SIZE = 10;
+  static constexpr int64_t READ_AMP_BENEFIT_UNIT_SIZE = 1024L * 1024L; // 1MB
 };
 
 
@@ -112,10 +134,13 @@ public:
   virtual int get_rank_weighed_score(
       common::ObSEArray<compaction::ObTabletMergeDag *, 32> &dags) const override;
   INHERIT_TO_STRING_KV("ObMinorCompactionRankHelper", ObCompactionRankHelper,
-                       K_(max_parallel_dag_cnt), K_(min_parallel_dag_cnt));
+                       K_(max_parallel_dag_cnt), K_(min_parallel_dag_cnt),
+                       K_(max_read_amp_benefit), K_(min_read_amp_benefit));
 public:
   uint64_t max_parallel_dag_cnt_;
   uint64_t min_parallel_dag_cnt_;
+  uint64_t max_read_amp_benefit_;
+  uint64_t min_read_amp_benefit_;
 };
 
 
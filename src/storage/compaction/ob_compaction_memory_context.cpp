@@ -20,6 +20,7 @@
 #include "share/rc/ob_tenant_base.h"
 #include "share/scheduler/ob_tenant_dag_scheduler.h"
 #include "ob_tablet_merge_task.h"
+#include "ob_compaction_memory_pool.h"
 
 
 namespace oceanbase
@@ -69,6 +70,8 @@ ObCompactionMemoryContext::ObCompactionMemoryContext(
     free_alloc_(),
     mem_monitor_(),
     mem_peak_total_(0),
+    admitted_mem_(0),
+    borrowed_mem_(0),
     is_reserve_mode_(false)
 {
   inner_init(param);
@@ -84,6 +87,8 @@ ObCompactionMemoryContext::ObCompactionMemoryContext(
     free_alloc_("FreeAlloc", MTL_ID()),
     mem_monitor_(),
     mem_peak_total_(0),
+    admitted_mem_(0),
+    borrowed_mem_(0),
     is_reserve_mode_(false)
 {
 }
@@ -97,6 +102,7 @@ void ObCompactionMemoryContext::destroy()
 {
   safe_arena_.clear();
   inner_arena_.reset();
+  return_mem();
 }
 
 void ObCompactionMemoryContext::inner_init(const ObTabletMergeDagParam &param)
@@ -160,6 +166,59 @@ void ObCompactionMemoryContext::mem_click()
   mem_total += mem_monitor_.get_hold_mem();
 
   mem_peak_total_ = MAX(mem_peak_total_, mem_total);
+  const int64_t mem_quota = ATOMIC_LOAD(&admitted_mem_) + ATOMIC_LOAD(&borrowed_mem_);
+  if (ObCtxIds::DEFAULT_CTX_ID == ctx_id_) {
+  } else if (mem_total > mem_quota) {
+    borrow_mem(mem_total - mem_quota);
+  } else if (mem_quota - mem_total >= MEM_BORROW_UNIT) {
+    // usage drops, give back the borrowed part so that waiting dags could be admitted earlier
+    return_mem(mem_quota - mem_total);
+  }
+}
+
+void ObCompactionMemoryContext::borrow_mem(const int64_t size)
+{
+  ObTenantCompactionMemPool *mem_pool = MTL(ObTenantCompactionMemPool *);
+  if (OB_NOT_NULL(mem_pool)) {
+    // borrow by unit to avoid touching the broker at every click
+    const int64_t borrow_size = upper_align(size, MEM_BORROW_UNIT);
+    ObCompactionMemBroker &mem_broker = mem_pool->get_mem_broker();
+    mem_broker.borrow(borrow_size);
+    (void) ATOMIC_AAF(&borrowed_mem_, borrow_size);
+    if (mem_broker.is_over_budget()) {
+      LOG_INFO("compaction memory is over budget, new merge dags will wait", K(borrow_size),
+          K_(admitted_mem), K_(borrowed_mem), K_(mem_peak_total), K(mem_broker));
+    }
+  }
+}
+
+void ObCompactionMemoryContext::return_mem()
+{
+  const int64_t borrowed_mem = ATOMIC_TAS(&borrowed_mem_, 0);
+  ObTenantCompactionMemPool *mem_pool = nullptr;
+  if (borrowed_mem > 0 && OB_NOT_NULL(mem_pool = MTL(ObTenantCompactionMemPool *))) {
+    mem_pool->get_mem_broker().release(borrowed_mem);
+  }
+}
+
+void ObCompactionMemoryContext::return_mem(const int64_t size)
+{
+  int64_t return_size = 0;
+  bool need_retry = true;
+  // dags of co merge share the ctx and may click concurrently
+  while (need_retry) {
+    const int64_t borrowed_mem = ATOMIC_LOAD(&borrowed_mem_);
+    return_size = MIN(borrowed_mem, lower_align(size, MEM_BORROW_UNIT));
+    if (return_size <= 0) {
+      need_retry = false;
+    } else if (ATOMIC_BCAS(&borrowed_mem_, borrowed_mem, borrowed_mem - return_size)) {
+      need_retry = false;
+    }
+  }
+  ObTenantCompactionMemPool *mem_pool = nullptr;
+  if (return_size > 0 && OB_NOT_NULL(mem_pool = MTL(ObTenantCompactionMemPool *))) {
+    mem_pool->get_mem_broker().release(return_size);
+  }
 }
 
  /**
@@ -91,15 +91,22 @@ public:
   ObSafeArenaAllocator &get_safe_arena() { return safe_arena_; }
   void mem_click();
   int64_t get_total_mem_peak() const { return mem_peak_total_; }
+  // memory admitted for the dag, the part beyond it is borrowed from ObCompactionMemBroker in mem_click
+  void set_admitted_mem(const int64_t admitted_mem) { ATOMIC_STORE(&admitted_mem_, admitted_mem); }
+  int64_t get_borrowed_mem() const { return ATOMIC_LOAD(&borrowed_mem_); }
 
   MONITOR_MERGE_MEM(local_hold_mem);
   MONITOR_MERGE_MEM(local_free_mem);
   MONITOR_MERGE_MEM(buffer_hold_mem);
   MONITOR_MERGE_MEM(buffer_free_mem);
 
-  TO_STRING_KV(K_(is_reserve_mode));
+  TO_STRING_KV(K_(is_reserve_mode), K_(admitted_mem), K_(borrowed_mem));
 private:
   void inner_init(const ObTabletMergeDagParam &param);
+  void borrow_mem(const int64_t size);
+  void return_mem();
+  void return_mem(const int64_t size);
+  static constexpr int64_t MEM_BORROW_UNIT = 4 * 1024L * 1024L; // 4MB
 private:
   common::ObArenaAllocator &arena_;
   int64_t ctx_id_;
@@ -109,6 +116,8 @@ private:
   common::DefaultPageAllocator free_alloc_;
   ObCompactionMemMonitor mem_monitor_;
   int64_t mem_peak_total_;
+  int64_t admitted_mem_;
+  int64_t borrowed_mem_;
   bool is_reserve_mode_;
   DISABLE_COPY_ASSIGN(ObCompactionMemoryContext);
 };
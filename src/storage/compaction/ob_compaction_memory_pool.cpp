@@ -17,6 +17,7 @@
 #include "share/ob_force_print_log.h"
 #include "share/ob_thread_mgr.h"
 #include "lib/allocator/ob_mod_define.h"
+#include "lib/alloc/alloc_func.h"
 #include "share/rc/ob_tenant_base.h"
 #include "share/scheduler/ob_tenant_dag_scheduler.h"
 #include "storage/compaction/ob_compaction_memory_context.h"
@@ -189,6 +190,79 @@ int ObCompactionBufferChunk::free_block(ObCompactionBufferBlock &block)
 }
 
 
+/* ***************************************** ObCompactionMemBroker ***************************************** */
+ObCompactionMemBroker::ObCompactionMemBroker()
+  : used_mem_(0),
+    admit_cnt_(0),
+    reject_cnt_(0),
+    borrow_cnt_(0)
+{
+}
+
+void ObCompactionMemBroker::reset()
+{
+  used_mem_ = 0;
+  admit_cnt_ = 0;
+  reject_cnt_ = 0;
+  borrow_cnt_ = 0;
+}
+
+int64_t ObCompactionMemBroker::get_mem_limit() const
+{
+  const int64_t tenant_mem_limit = lib::get_tenant_memory_limit(MTL_ID());
+  return MAX(tenant_mem_limit / 100 * COMPACTION_MEM_LIMIT_PERCENT, MIN_COMPACTION_MEM_LIMIT);
+}
+
+bool ObCompactionMemBroker::can_admit_(
+    const int64_t used_mem,
+    const int64_t estimate_mem,
+    const bool force) const
+{
+  // always admit the first merge, otherwise a merge larger than the budget never runs
+  return force || 0 == used_mem || used_mem + estimate_mem <= get_mem_limit();
+}
+
+bool ObCompactionMemBroker::try_admit(const int64_t estimate_mem, const bool force)
+{
+  bool bret = false;
+  bool need_retry = true;
+
+  while (need_retry) {
+    const int64_t used_mem = ATOMIC_LOAD(&used_mem_);
+    if (!can_admit_(used_mem, estimate_mem, force)) {
+      need_retry = false;
+    } else if (ATOMIC_BCAS(&used_mem_, used_mem, used_mem + estimate_mem)) {
+      bret = true;
+      need_retry = false;
+    }
+  }
+  if (bret) {
+    (void) ATOMIC_AAF(&admit_cnt_, 1);
+  } else {
+    (void) ATOMIC_AAF(&reject_cnt_, 1);
+  }
+  return bret;
+}
+
+void ObCompactionMemBroker::borrow(const int64_t size)
+{
+  if (size > 0) {
+    (void) ATOMIC_AAF(&used_mem_, size);
+    (void) ATOMIC_AAF(&borrow_cnt_, 1);
+  }
+}
+
+void ObCompactionMemBroker::release(const int64_t size)
+{
+  if (size > 0) {
+    const int64_t used_mem = ATOMIC_SAF(&used_mem_, size);
+    if (OB_UNLIKELY(used_mem < 0)) {
+      LOG_ERROR_RET(OB_ERR_UNEXPECTED, "compaction memory is released more than used", K(size), KPC(this));
+    }
+  }
+}
+
+
 /* ***************************************** ObTenantCompactionMemPool ***************************************** */
 int ObTenantCompactionMemPool::mtl_init(ObTenantCompactionMemPool* &mem_pool)
 {
@@ -212,6 +286,7 @@ int ObTenantCompactionMemPool::mtl_init(ObTenantCompactionMemPool* &mem_pool)
 
 ObTenantCompactionMemPool::ObTenantCompactionMemPool()
   : mem_shrink_task_(*this),
+    mem_broker_(),
     chunk_allocator_("MrgMemPoolChk"),
     piece_allocator_("MrgMemPoolPce"),
     chunk_lock_(),
@@ -273,6 +348,7 @@ void ObTenantCompactionMemPool::reset()
     used_block_num_ = 0;
     reserve_mode_signal_ = 0;
     mem_mode_ = MemoryMode::NORMAL_MODE;
+    mem_broker_.reset();
     is_inited_ = false;
   }
 
@@ -19,6 +19,8 @@
 #include "lib/lock/ob_spin_lock.h"
 #include "lib/allocator/page_arena.h"
 #include "lib/literals/ob_literals.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/utility/ob_print_utils.h"
 #include "storage/blocksstable/ob_data_buffer.h"
 
 
@@ -90,6 +92,47 @@ public:
 };
 
 
+/*
+ * Tenant level memory budget of compaction.
+ * A merge dag is admitted with its estimated peak memory before it starts running, and the
+ * memory context of the merge borrows more when it grows beyond the estimation.
+ * Borrowing always succeeds since the memory is in use already, but new dags wait in the
+ * waiting list until running merges return memory, so the compaction concurrency follows
+ * the available memory instead of the thread limit only.
+ */
+class ObCompactionMemBroker
+{
+public:
+  ObCompactionMemBroker();
+  ~ObCompactionMemBroker() = default;
+  void reset();
+  int64_t get_mem_limit() const;
+  OB_INLINE int64_t get_used_mem() const { return ATOMIC_LOAD(&used_mem_); }
+  OB_INLINE bool is_over_budget() const { return get_used_mem() > get_mem_limit(); }
+  // force: admit even if over budget, used by the merges releasing memstore
+  OB_INLINE bool can_admit(const int64_t estimate_mem, const bool force) const
+  {
+    return can_admit_(get_used_mem(), estimate_mem, force);
+  }
+  bool try_admit(const int64_t estimate_mem, const bool force);
+  void borrow(const int64_t size);
+  void release(const int64_t size);
+  TO_STRING_KV(K_(used_mem), K_(admit_cnt), K_(reject_cnt), K_(borrow_cnt));
+
+public:
+  static constexpr int64_t COMPACTION_MEM_LIMIT_PERCENT = 20;
+  static constexpr int64_t MIN_COMPACTION_MEM_LIMIT = 256_MB;
+private:
+  bool can_admit_(const int64_t used_mem, const int64_t estimate_mem, const bool force) const;
+private:
+  int64_t used_mem_;
+  int64_t admit_cnt_;
+  int64_t reject_cnt_;
+  int64_t borrow_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObCompactionMemBroker);
+};
+
+
 class ObTenantCompactionMemPool
 {
 public:
@@ -113,6 +156,7 @@ public:
   bool release_reserve_mem();
   void set_memory_mode(const MemoryMode mem_mode) { ATOMIC_STORE(&mem_mode_, mem_mode); }
   bool is_emergency_mode() { return MemoryMode::EMERGENCY_MODE == ATOMIC_LOAD(&mem_mode_); }
+  ObCompactionMemBroker &get_mem_broker() { return mem_broker_; }
 
   OB_INLINE int64_t get_total_block_num() const { return total_block_num_; }
   OB_INLINE int64_t get_max_block_num() const { return max_block_num_; }
@@ -145,6 +189,7 @@ public:
   static constexpr int64_t CHECK_SHRINK_INTERVAL = 120_s;
 private:
   MemPoolShrinkTask mem_shrink_task_;
+  ObCompactionMemBroker mem_broker_;
   common::DefaultPageAllocator chunk_allocator_;
   common::DefaultPageAllocator piece_allocator_;
   common::ObSpinLock chunk_lock_;
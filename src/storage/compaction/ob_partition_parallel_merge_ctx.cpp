@@ -22,6 +22,7 @@
 #include "storage/tablet/ob_tablet.h"
 #include "storage/column_store/ob_column_oriented_sstable.h"
 #include "storage/compaction/ob_compaction_dag_ranker.h"
+#include "storage/compaction/ob_compaction_diagnose.h"
 
 namespace oceanbase
 {
@@ -39,6 +40,9 @@ ObParallelMergeCtx::ObParallelMergeCtx(common::ObIAllocator &allocator)
     range_array_(OB_MALLOC_NORMAL_BLOCK_SIZE, allocator_),
     parallel_type_(INVALID_PARALLEL_TYPE),
     concurrent_cnt_(0),
+    sample_row_cnt_(0),
+    sample_data_size_(0),
+    origin_degree_(0),
     is_inited_(false)
 {
 }
@@ -53,6 +57,9 @@ void ObParallelMergeCtx::reset()
   parallel_type_ = INVALID_PARALLEL_TYPE;
   range_array_.reset();
   concurrent_cnt_ = 0;
+  sample_row_cnt_ = 0;
+  sample_data_size_ = 0;
+  origin_degree_ = 0;
   is_inited_ = false;
 }
 
@@ -265,7 +272,7 @@ int ObParallelMergeCtx::init_parallel_mini_merge(compaction::ObBasicTabletMergeC
   int ret = OB_SUCCESS;
   ObIMemtable *memtable = nullptr;
   int64_t total_bytes = 0;
-  int64_t total_rows = 0; // placeholder
+  int64_t total_rows = 0;
 
   if (OB_UNLIKELY(MINI_MERGE != merge_ctx.get_merge_type())) {
     ret = OB_INVALID_ARGUMENT;
@@ -274,14 +281,19 @@ int ObParallelMergeCtx::init_parallel_mini_merge(compaction::ObBasicTabletMergeC
     STORAGE_LOG(WARN, "failed to get first memtable", K(ret), "merge tables", merge_ctx.get_tables_handle());
   } else if (memtable->is_data_memtable()) { // only data memtable has mt stat
     total_bytes = static_cast<memtable::ObMemtable *>(memtable)->get_mt_stat().row_size_;
+    total_rows = static_cast<memtable::ObMemtable *>(memtable)->get_physical_row_cnt();
   } else if (OB_FAIL(memtable->estimate_phy_size(nullptr, nullptr, total_bytes, total_rows))) {
     STORAGE_LOG(WARN, "failed to estimate size from memtable", K(ret));
   }
 
   if (OB_SUCC(ret)) {
+    sample_row_cnt_ = total_rows;
+    sample_data_size_ = total_bytes;
+    origin_degree_ = MAX((total_bytes + ObCompactionEstimator::MINI_PARALLEL_BASE_MEM - 1) / ObCompactionEstimator::MINI_PARALLEL_BASE_MEM,
+                         (total_rows + PARALLEL_MERGE_ROW_CNT_PER_TASK - 1) / PARALLEL_MERGE_ROW_CNT_PER_TASK);
     calc_adaptive_parallel_degree(ObDagPrio::DAG_PRIO_COMPACTION_HIGH,
                                   ObCompactionEstimator::MINI_MEM_PER_THREAD,
-                                  (total_bytes + ObCompactionEstimator::MINI_PARALLEL_BASE_MEM - 1) / ObCompactionEstimator::MINI_PARALLEL_BASE_MEM,
+                                  origin_degree_,
                                   concurrent_cnt_);
 
     ObArray<ObStoreRange> store_ranges;
@@ -315,7 +327,7 @@ int ObParallelMergeCtx::init_parallel_mini_merge(compaction::ObBasicTabletMergeC
       }
       parallel_type_ = PARALLEL_MINI;
       STORAGE_LOG(INFO, "Succ to get parallel mini merge ranges", K(ret),
-            K_(concurrent_cnt), K(total_bytes), K_(range_array));
+            K_(concurrent_cnt), K(total_bytes), K(total_rows), K_(range_array));
     }
   }
   return ret;
@@ -347,10 +359,20 @@ int ObParallelMergeCtx::init_parallel_mini_minor_merge(compaction::ObBasicTablet
       STORAGE_LOG(WARN, "Invalid argument to calc mini minor parallel degree", K(ret), K(tablet_size),
                 K(range_info), K(tables.count()), K(merge_ctx));
     } else {
+      // row count of sstable is accumulated from its index blocks, no need to scan the data
+      for (int64_t i = 0; i < tables.count(); ++i) {
+        sample_row_cnt_ += static_cast<ObSSTable *>(tables.at(i))->get_row_count();
+      }
+      sample_data_size_ = range_info.total_size_;
+      origin_degree_ = MAX((range_info.total_size_ / tables.count() + tablet_size - 1) / tablet_size,
+                           (sample_row_cnt_ + PARALLEL_MERGE_ROW_CNT_PER_TASK - 1) / PARALLEL_MERGE_ROW_CNT_PER_TASK);
       calc_adaptive_parallel_degree(ObDagPrio::DAG_PRIO_COMPACTION_MID,
                                     ObCompactionEstimator::MINOR_MEM_PER_THREAD,
-                                    (range_info.total_size_ / tables.count() + tablet_size - 1) / tablet_size,
+                                    origin_degree_,
                                     range_info.parallel_target_count_);
+      // split points are sampled from macro endkeys, more ranges than the macro blocks of the
+      // largest sstable make the sample count zero and fall back to serial merge
+      range_info.parallel_target_count_ = MIN(range_info.parallel_target_count_, range_info.max_macro_block_count_);
     }
 
     if (OB_FAIL(ret)) {
@@ -379,7 +401,8 @@ int ObParallelMergeCtx::init_parallel_mini_minor_merge(compaction::ObBasicTablet
           STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(datum_range));
         }
       }
-      STORAGE_LOG(INFO, "Succ to get parallel mini minor merge ranges", K_(concurrent_cnt), K_(range_array));
+      STORAGE_LOG(INFO, "Succ to get parallel mini minor merge ranges", K_(concurrent_cnt),
+          K_(sample_row_cnt), K_(sample_data_size), K_(origin_degree), K_(range_array));
     }
   }
   return ret;
@@ -539,6 +562,16 @@ int ObParallelMergeCtx::get_major_parallel_ranges(
   return ret;
 }
 
+void ObParallelMergeCtx::fill_split_comment(char *buf, const int64_t buf_len) const
+{
+  if ((PARALLEL_MINI == parallel_type_ || PARALLEL_MINOR == parallel_type_) && origin_degree_ > 0) {
+    ADD_COMPACTION_INFO_PARAM(buf, buf_len,
+        "split_rows", sample_row_cnt_,
+        "split_mb", sample_data_size_ >> 20,
+        "split_degree", origin_degree_);
+  }
+}
+
 int64_t ObParallelMergeCtx::to_string(char* buf, const int64_t buf_len) const
 {
   int64_t pos = 0;
@@ -548,7 +581,8 @@ int64_t ObParallelMergeCtx::to_string(char* buf, const int64_t buf_len) const
     if (SERIALIZE_MERGE == parallel_type_) {
       J_KV(K_(concurrent_cnt));
     } else {
-      J_KV(K_(parallel_type), K_(concurrent_cnt), "array_cnt", range_array_.count(), K_(range_array));
+      J_KV(K_(parallel_type), K_(concurrent_cnt), K_(sample_row_cnt), K_(sample_data_size), K_(origin_degree),
+          "array_cnt", range_array_.count(), K_(range_array));
     }
     J_COMMA();
     J_OBJ_END();
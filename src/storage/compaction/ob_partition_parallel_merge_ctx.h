@@ -53,6 +53,9 @@ public:
   int init(compaction::ObBasicTabletMergeCtx &merge_ctx);
   int init(const compaction::ObMediumCompactionInfo &medium_info);
   OB_INLINE int64_t get_concurrent_cnt() const { return concurrent_cnt_; }
+  OB_INLINE ParallelMergeType get_parallel_type() const { return parallel_type_; }
+  // record the split decision of mini/minor merge into the comment of merge history
+  void fill_split_comment(char *buf, const int64_t buf_len) const;
   int get_merge_range(const int64_t parallel_idx, blocksstable::ObDatumRange &merge_range);
   static int get_concurrent_cnt(
       const int64_t tablet_size,
@@ -63,6 +66,9 @@ private:
   static const int64_t MIN_PARALLEL_MINOR_MERGE_THREASHOLD = 2;
   static const int64_t MIN_PARALLEL_MERGE_BLOCKS = 32;
   static const int64_t PARALLEL_MERGE_TARGET_TASK_CNT = 20;
+  // rows merged by one parallel task of mini/minor merge, hot tablets with small rows
+  // are split by row count even if the data size is small
+  static const int64_t PARALLEL_MERGE_ROW_CNT_PER_TASK = 4L * 1000L * 1000L;
 
   //TODO @hanhui parallel in ai
   int init_serial_merge();
@@ -84,6 +90,10 @@ private:
   common::ObSEArray<blocksstable::ObDatumRange, 16, common::ObIAllocator&> range_array_;
   ParallelMergeType parallel_type_;
   int64_t concurrent_cnt_;
+  // sampled workload of mini/minor merge, used to decide the parallel degree
+  int64_t sample_row_cnt_;
+  int64_t sample_data_size_;
+  int64_t origin_degree_;
   bool is_inited_;
 };
 
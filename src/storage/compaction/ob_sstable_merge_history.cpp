@@ -9,6 +9,7 @@
 // See the Mulan PubL v2 for more details.
 #define USING_LOG_PREFIX STORAGE_COMPACTION
 #include "storage/compaction/ob_sstable_merge_history.h"
+#include "storage/blocksstable/cs_encoding/ob_stream_encoding_struct.h"
 
 namespace oceanbase
 {
@@ -218,6 +219,42 @@ void ObMergeRunningInfo::shallow_copy(const ObMergeRunningInfo &other)
   MEMSET(comment_, '\0', sizeof(comment_));
   strncpy(comment_, other.comment_, strlen(other.comment_));
 }
+/**
+ * -------------------------------------------------------------------ObCSIntegerCodecInfo-------------------------------------------------------------------
+ */
+void ObCSIntegerCodecInfo::add(const uint64_t column_id, const uint8_t codec)
+{
+  bool exist = false;
+  for (int64_t i = 0; !exist && i < count_; ++i) {
+    exist = (column_ids_[i] == column_id);
+  }
+  if (!exist && count_ < MAX_COLUMN_CNT) {
+    column_ids_[count_] = column_id;
+    codecs_[count_] = codec;
+    ++count_;
+  }
+}
+
+void ObCSIntegerCodecInfo::add(const ObCSIntegerCodecInfo &other)
+{
+  for (int64_t i = 0; i < other.count_; ++i) {
+    add(other.column_ids_[i], other.codecs_[i]);
+  }
+}
+
+int64_t ObCSIntegerCodecInfo::to_string(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  if (OB_ISNULL(buf) || buf_len <= 0) {
+  } else {
+    for (int64_t i = 0; i < count_; ++i) {
+      BUF_PRINTF("%s%lu:%s", 0 == i ? "" : ",", column_ids_[i],
+                 blocksstable::ObIntegerStream::get_encoding_type_name(codecs_[i]));
+    }
+  }
+  return pos;
+}
+
 /**
  * -------------------------------------------------------------------ObMergeBlockInfo-------------------------------------------------------------------
  */
@@ -229,11 +266,13 @@ ObMergeBlockInfo::ObMergeBlockInfo()
     multiplexed_macro_block_count_(0),
     new_micro_count_in_new_macro_(0),
     multiplexed_micro_count_in_new_macro_(0),
+    multiplexed_size_(0),
     total_row_count_(0),
     incremental_row_count_(0),
     new_flush_data_rate_(0),
     new_micro_info_(),
     block_io_us_(0),
+    cs_integer_codec_info_(),
     macro_id_list_("\0")
 {}
 
@@ -246,11 +285,13 @@ void ObMergeBlockInfo::reset()
   multiplexed_macro_block_count_ = 0;
   new_micro_count_in_new_macro_ = 0;
   multiplexed_micro_count_in_new_macro_ = 0;
+  multiplexed_size_ = 0;
   total_row_count_ = 0;
   incremental_row_count_ = 0;
   new_flush_data_rate_ = 0;
   new_micro_info_.reset();
   block_io_us_ = 0;
+  cs_integer_codec_info_.reset();
   MEMSET(macro_id_list_, '\0', sizeof(macro_id_list_));
 }
 
@@ -268,11 +309,13 @@ void ObMergeBlockInfo::shallow_copy(const ObMergeBlockInfo &other)
   multiplexed_macro_block_count_ = other.multiplexed_macro_block_count_;
   new_micro_count_in_new_macro_ = other.new_micro_count_in_new_macro_;
   multiplexed_micro_count_in_new_macro_ = other.multiplexed_micro_count_in_new_macro_;
+  multiplexed_size_ = other.multiplexed_size_;
   total_row_count_ = other.total_row_count_;
   incremental_row_count_ = other.incremental_row_count_;
   new_flush_data_rate_ = other.new_flush_data_rate_;
   new_micro_info_ = other.new_micro_info_;
   block_io_us_ = other.block_io_us_;
+  cs_integer_codec_info_ = other.cs_integer_codec_info_;
   MEMSET(macro_id_list_, '\0', sizeof(macro_id_list_));
   strncpy(macro_id_list_, other.macro_id_list_, strlen(other.macro_id_list_));
 }
@@ -295,9 +338,11 @@ void ObMergeBlockInfo::add_without_row_cnt(const ObMergeBlockInfo &other)
   macro_block_count_ += other.macro_block_count_;
   multiplexed_macro_block_count_ += other.multiplexed_macro_block_count_;
   multiplexed_micro_count_in_new_macro_ += other.multiplexed_micro_count_in_new_macro_;
+  multiplexed_size_ += other.multiplexed_size_;
   new_micro_count_in_new_macro_ += other.new_micro_count_in_new_macro_;
   block_io_us_ += other.block_io_us_;
   new_micro_info_.add(other.new_micro_info_);
+  cs_integer_codec_info_.add(other.cs_integer_codec_info_);
 }
 
 void ObMergeBlockInfo::add_index_block_info(const ObMergeBlockInfo &block_info)
@@ -160,6 +160,27 @@ struct ObMergeRunningInfo
   char comment_[MERGE_INFO_COMMENT_LENGTH];
 };
 
+// integer stream codec last chosen by cs encoding for each integer column,
+// see ObIntegerStream::EncodingType
+struct ObCSIntegerCodecInfo
+{
+public:
+  static const int64_t MAX_COLUMN_CNT = 16;
+  ObCSIntegerCodecInfo() { reset(); }
+  ~ObCSIntegerCodecInfo() {}
+  void reset() { MEMSET(this, 0, sizeof(*this)); }
+  // columns beyond MAX_COLUMN_CNT or already recorded are ignored
+  void add(const uint64_t column_id, const uint8_t codec);
+  void add(const ObCSIntegerCodecInfo &other);
+  bool is_empty() const { return 0 == count_; }
+  // column_id:codec_name,...
+  int64_t to_string(char *buf, const int64_t buf_len) const;
+
+  int64_t count_;
+  uint64_t column_ids_[MAX_COLUMN_CNT];
+  uint8_t codecs_[MAX_COLUMN_CNT];
+};
+
 struct ObMergeBlockInfo
 {
 public:
@@ -171,9 +192,12 @@ public:
   void add(const ObMergeBlockInfo &block_info);
   void add_without_row_cnt(const ObMergeBlockInfo &block_info);
   void add_index_block_info(const ObMergeBlockInfo &block_info);
+  // size of data blocks written by merge instead of reused from old sstable
+  int64_t get_rewrite_size() const { return MAX(0, occupy_size_ - multiplexed_size_); }
   TO_STRING_KV(K_(occupy_size), K_(original_size), K_(macro_block_count), K_(multiplexed_macro_block_count),
-    K_(new_micro_count_in_new_macro), K_(multiplexed_micro_count_in_new_macro),
-    K_(total_row_count), K_(incremental_row_count), K_(new_micro_info), K_(block_io_us));
+    K_(new_micro_count_in_new_macro), K_(multiplexed_micro_count_in_new_macro), K_(multiplexed_size),
+    K_(total_row_count), K_(incremental_row_count), K_(new_micro_info), K_(block_io_us),
+    K_(cs_integer_codec_info));
 
   int64_t occupy_size_; // including lob_macro
   int64_t original_size_;
@@ -182,11 +206,13 @@ public:
   int64_t multiplexed_macro_block_count_;
   int64_t new_micro_count_in_new_macro_;
   int64_t multiplexed_micro_count_in_new_macro_;
+  int64_t multiplexed_size_; // size of reused macro blocks and micro blocks
   int64_t total_row_count_;
   int64_t incremental_row_count_;
   int64_t new_flush_data_rate_; // KB per second
   ObNewMicroInfo new_micro_info_;
   int64_t block_io_us_;
+  ObCSIntegerCodecInfo cs_integer_codec_info_;
   char macro_id_list_[common::OB_MACRO_ID_INFO_LENGTH];
 };
 
@@ -117,10 +117,16 @@ int ObTabletMergeCtx::update_block_info(
     const int64_t cost_time)
 {
   int ret = OB_SUCCESS;
-  if (OB_FAIL(merge_info_.get_merge_history().update_block_info(block_info, false/*without_row_cnt*/))) {
+  ObSSTableMergeHistory &merge_history = merge_info_.get_merge_history();
+  // parallel merge tasks of one dag finish concurrently
+  common::ObSpinLockGuard guard(merge_history_lock_);
+  if (OB_FAIL(merge_history.update_block_info(block_info, false/*without_row_cnt*/))) {
     LOG_WARN("failed to update block info", KR(ret), K(block_info));
   } else {
-    merge_info_.get_merge_history().update_execute_time(cost_time);
+    merge_history.update_execute_time(cost_time);
+    if (get_concurrent_cnt() > 1) {
+      merge_history.running_info_.parallel_merge_info_.info_[ObParalleMergeInfo::MERGE_COST_TIME].add(cost_time);
+    }
   }
   return ret;
 }
@@ -14,6 +14,7 @@
 #define STORAGE_COMPACTION_OB_TABLET_MERGE_CTX_H_
 
 #include "lib/utility/ob_print_utils.h"
+#include "lib/lock/ob_spin_lock.h"
 #include "storage/compaction/ob_partition_merge_progress.h"
 #include "storage/tx_storage/ob_ls_map.h"
 #include "storage/tx_storage/ob_ls_handle.h"
@@ -67,6 +68,7 @@ public:
   INHERIT_TO_STRING_KV("ObBasicTabletMergeCtx", ObBasicTabletMergeCtx, K_(merge_info));
   storage::ObTableHandleV2 merged_table_handle_;
   ObTabletMergeInfo merge_info_;
+  common::ObSpinLock merge_history_lock_;
 };
 
 struct ObTabletMiniMergeCtx : public ObTabletMergeCtx
@@ -36,12 +36,14 @@
 #include "share/scheduler/ob_dag_warning_history_mgr.h"
 #include "storage/column_store/ob_column_oriented_sstable.h"
 #include "storage/compaction/ob_compaction_dag_ranker.h"
+#include "storage/ob_tenant_tablet_stat_mgr.h"
 #include "storage/meta_mem/ob_tenant_meta_mem_mgr.h"
 #include "storage/multi_data_source/ob_tablet_mds_merge_ctx.h"
 #include "storage/compaction/ob_basic_tablet_merge_ctx.h"
 #include "storage/compaction/ob_tenant_compaction_progress.h"
 #include "storage/checkpoint/ob_checkpoint_diagnose.h"
 #include "storage/compaction/ob_mview_compaction_util.h"
+#include "storage/compaction/ob_compaction_memory_pool.h"
 
 namespace oceanbase
 {
@@ -225,6 +227,7 @@ ObCompactionParam::ObCompactionParam()
   : score_(0),
     occupy_size_(0),
     estimate_phy_size_(0),
+    read_amp_benefit_(0),
     replay_interval_(0),
     add_time_(0),
     last_end_scn_(),
@@ -232,7 +235,9 @@ ObCompactionParam::ObCompactionParam()
     parallel_dag_cnt_(0),
     parallel_sstable_cnt_(0),
     estimate_concurrent_cnt_(1),
-    batch_size_(ObCompactionEstimator::DEFAULT_BATCH_SIZE)
+    batch_size_(ObCompactionEstimator::DEFAULT_BATCH_SIZE),
+    column_cnt_(0),
+    is_encoding_(false)
 {
 }
 
@@ -307,7 +312,8 @@ ObTabletMergeDag::ObTabletMergeDag(
     compat_mode_(lib::Worker::CompatMode::INVALID),
     ctx_(nullptr),
     param_(),
-    allocator_("MergeDag", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID(), ObCtxIds::MERGE_NORMAL_CTX_ID)
+    allocator_("MergeDag", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID(), ObCtxIds::MERGE_NORMAL_CTX_ID),
+    admitted_mem_(0)
 {
 }
 
@@ -322,6 +328,73 @@ ObTabletMergeDag::~ObTabletMergeDag()
     allocator_.free(ctx_);
     ctx_ = nullptr;
   }
+  release_admission_();
+}
+
+bool ObTabletMergeDag::need_admission_(
+    ObTenantCompactionMemPool *&mem_pool,
+    int64_t &estimate_mem,
+    bool &force) const
+{
+  int tmp_ret = OB_SUCCESS;
+  bool bret = false;
+  mem_pool = MTL(ObTenantCompactionMemPool *);
+  estimate_mem = 0;
+  force = false;
+
+  if (admitted_mem_ > 0 || OB_ISNULL(mem_pool) || !is_compaction_dag(get_type())) {
+    // admitted already
+  } else if (OB_TMP_FAIL(ObCompactionEstimator::estimate_merge_peak_memory(
+      get_priority(), param_.compaction_param_, estimate_mem))) {
+    LOG_WARN_RET(tmp_ret, "failed to estimate merge peak memory", K_(param));
+  } else {
+    // mini merge releases memstore, it should never wait for other compactions
+    force = ObDagPrio::DAG_PRIO_COMPACTION_HIGH == get_priority() || is_reserve_mode();
+    bret = true;
+  }
+  return bret;
+}
+
+bool ObTabletMergeDag::check_can_schedule()
+{
+  bool bret = true;
+  ObTenantCompactionMemPool *mem_pool = nullptr;
+  int64_t estimate_mem = 0;
+  bool force = false;
+
+  if (need_admission_(mem_pool, estimate_mem, force)) {
+    bret = mem_pool->get_mem_broker().can_admit(estimate_mem, force);
+  }
+  return bret;
+}
+
+bool ObTabletMergeDag::try_admit()
+{
+  bool bret = true;
+  ObTenantCompactionMemPool *mem_pool = nullptr;
+  int64_t estimate_mem = 0;
+  bool force = false;
+
+  if (!need_admission_(mem_pool, estimate_mem, force)) {
+  } else if (mem_pool->get_mem_broker().try_admit(estimate_mem, force)) {
+    admitted_mem_ = estimate_mem;
+  } else {
+    bret = false;
+    LOG_DEBUG("compaction memory is not enough, dag should wait", K(estimate_mem),
+        "mem_broker", mem_pool->get_mem_broker(), K_(ls_id), K_(tablet_id));
+  }
+  return bret;
+}
+
+void ObTabletMergeDag::release_admission_()
+{
+  if (admitted_mem_ > 0) {
+    ObTenantCompactionMemPool *mem_pool = MTL(ObTenantCompactionMemPool *);
+    if (OB_NOT_NULL(mem_pool)) {
+      mem_pool->get_mem_broker().release(admitted_mem_);
+    }
+    admitted_mem_ = 0;
+  }
 }
 
 int ObTabletMergeDag::get_tablet_and_compat_mode()
@@ -490,7 +563,8 @@ int ObTabletMergeDag::fill_info_param(compaction::ObIBasicInfoParam *&out_param,
                                   static_cast<int64_t>(tablet_id_.id()),
                                   param_.merge_version_,
                                   "exec_mode", exec_mode_to_str(param_.exec_mode_),
-                                  "concurrent_cnt", concurrent_cnt))) {
+                                  "concurrent_cnt", concurrent_cnt,
+                                  "read_amp_benefit", param_.compaction_param_.read_amp_benefit_))) {
       LOG_WARN("failed to fill info param", K(ret));
     }
   }
@@ -533,9 +607,54 @@ int ObTabletMergeDag::collect_compaction_param(const ObTabletHandle &tablet_hand
   if (OB_UNLIKELY(!tablet_handle.is_valid())) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("get invalid arguments", K(ret), K(tablet_handle));
+  } else if (FALSE_IT(param_.compaction_param_.column_cnt_ =
+      MIN(tablet_handle.get_obj()->get_last_major_column_count(), UINT16_MAX))) {
+  } else if (FALSE_IT(param_.compaction_param_.is_encoding_ = ObStoreFormat::is_row_store_type_with_encoding(
+      tablet_handle.get_obj()->get_last_major_latest_row_store_type()))) {
   } else if (is_mini_merge(merge_type_)) {
     param_.compaction_param_.sstable_cnt_ = tablet_handle.get_obj()->get_minor_table_count();
     param_.compaction_param_.estimate_concurrent_count(MINI_MERGE);
+  } else if (!is_minor_merge_type(merge_type_) && !is_medium_merge(merge_type_)) {
+    // only minor and medium dags are ranked by read amplification
+  } else if (OB_FAIL(collect_read_amp_benefit(*tablet_handle.get_obj()))) {
+    LOG_WARN("failed to collect read amp benefit", K(ret), K_(ls_id), K_(tablet_id));
+  }
+  return ret;
+}
+
+int ObTabletMergeDag::collect_read_amp_benefit(const ObTablet &tablet)
+{
+  int ret = OB_SUCCESS;
+  ObTabletStat tablet_stat;
+  ObTabletStat total_tablet_stat;
+  share::schema::ObTableModeFlag mode = share::schema::ObTableModeFlag::TABLE_MODE_NORMAL;
+  ObCompactionParam &compaction_param = param_.compaction_param_;
+  // each query reads the major, all the minors and the memtables of the tablet
+  const int64_t table_cnt = tablet.get_major_table_count() + tablet.get_minor_table_count() + tablet.get_memtable_count();
+  int64_t reduced_table_cnt = 0;
+  int64_t write_size = 0;
+
+  if (is_minor_merge_type(merge_type_)) {
+    reduced_table_cnt = compaction_param.parallel_sstable_cnt_ - 1;
+    write_size = compaction_param.occupy_size_;
+  } else { // medium merge rewrites the major with all the minors
+    reduced_table_cnt = tablet.get_minor_table_count();
+    write_size = tablet.get_tablet_meta().space_usage_.all_sstable_data_occupy_size_;
+  }
+
+  if (reduced_table_cnt <= 0) {
+  } else if (OB_FAIL(MTL(ObTenantTabletStatMgr *)->get_latest_tablet_stat(
+      ls_id_, tablet_id_, tablet_stat, total_tablet_stat, mode))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      ret = OB_SUCCESS; // no query on the tablet recently
+    } else {
+      LOG_WARN("failed to get latest tablet stat", K(ret), K_(ls_id), K_(tablet_id));
+    }
+  } else {
+    compaction_param.read_amp_benefit_ = ObCompactionEstimator::estimate_read_amp_benefit(
+        tablet_stat.query_cnt_, tablet_stat.exist_row_total_table_cnt_, table_cnt, reduced_table_cnt, write_size);
+    LOG_TRACE("collect read amp benefit", K_(ls_id), K_(tablet_id), K(tablet_stat), K(table_cnt),
+        K(reduced_table_cnt), K(write_size), K(compaction_param));
   }
   return ret;
 }
@@ -833,6 +952,7 @@ int ObTabletMergeDag::alloc_merge_ctx()
     LOG_WARN("failed to allocate ctx", KR(ret), KP(ctx_));
   } else {
     ctx_->merge_dag_ = this;
+    ctx_->mem_ctx_.set_admitted_mem(admitted_mem_);
     ctx_->init_time_guard(get_add_time());
     ctx_->time_guard_click(ObStorageCompactionTimeGuard::DAG_WAIT_TO_SCHEDULE);
   }
@@ -43,6 +43,7 @@ class ObPartitionMerger;
 struct ObCachedTransStateMgr;
 class ObPartitionMergeProgress;
 class ObMviewMergeParameter;
+class ObTenantCompactionMemPool;
 /*
 DAG : *PrepareTask -> ObTabletMergeTask* -> ObTabletMergeFinishTask
 
@@ -92,12 +93,14 @@ public:
   ObCompactionParam();
   ~ObCompactionParam() = default;
   void estimate_concurrent_count(const compaction::ObMergeType merge_type);
-  TO_STRING_KV(K_(score), K_(occupy_size), K_(estimate_phy_size), K_(replay_interval), K_(add_time), K_(last_end_scn),
-      K_(sstable_cnt), K_(parallel_dag_cnt), K_(parallel_sstable_cnt), K_(estimate_concurrent_cnt), K_(batch_size));
+  TO_STRING_KV(K_(score), K_(occupy_size), K_(estimate_phy_size), K_(read_amp_benefit), K_(replay_interval), K_(add_time),
+      K_(last_end_scn), K_(sstable_cnt), K_(parallel_dag_cnt), K_(parallel_sstable_cnt), K_(estimate_concurrent_cnt), K_(batch_size),
+      K_(column_cnt), K_(is_encoding));
 public:
   int64_t score_; // used for final sort, the lower score, the higher priority.
   uint64_t occupy_size_;
   uint64_t estimate_phy_size_;
+  uint64_t read_amp_benefit_; // table reads saved for recent queries per MB written, see ObCompactionEstimator
   uint64_t replay_interval_;
   uint64_t add_time_;
   share::SCN last_end_scn_;
@@ -106,6 +109,8 @@ public:
   uint16_t parallel_sstable_cnt_;
   uint16_t estimate_concurrent_cnt_;
   uint16_t batch_size_;
+  uint16_t column_cnt_; // column count of the last major, used to estimate merge memory
+  bool is_encoding_; // the last major is encoded, encoders hold more memory per column
 };
 
 struct ObTabletMergeDagParam : public share::ObIDagInitParam
@@ -201,6 +206,11 @@ public:
   virtual const share::ObLSID & get_ls_id() const { return param_.ls_id_; }
   bool is_reserve_mode() const { return param_.is_reserve_mode_; }
   void set_reserve_mode() { param_.is_reserve_mode_ = true; }
+  // check whether the compaction memory broker of tenant could admit the dag, side effect free
+  virtual bool check_can_schedule() override;
+  // admit the dag by the compaction memory broker of tenant before it starts running
+  virtual bool try_admit() override;
+  int64_t get_admitted_mem() const { return admitted_mem_; }
   virtual bool operator == (const ObIDag &other) const override;
   virtual int64_t hash() const override;
   virtual int fill_info_param(compaction::ObIBasicInfoParam *&out_param, ObIAllocator &allocator) const override;
@@ -234,6 +244,10 @@ public:
 protected:
   int inner_init(const ObTabletMergeDagParam *param);
   int collect_compaction_param(const ObTabletHandle &tablet_handle);
+  int collect_read_amp_benefit(const ObTablet &tablet);
+  // return true if the dag isn't admitted yet and should be admitted with estimate_mem
+  bool need_admission_(ObTenantCompactionMemPool *&mem_pool, int64_t &estimate_mem, bool &force) const;
+  void release_admission_();
   void fill_compaction_progress(compaction::ObTabletCompactionProgress &progress,
       ObBasicTabletMergeCtx &ctx,
       compaction::ObPartitionMergeProgress *input_progress,
@@ -247,6 +261,7 @@ protected:
   ObBasicTabletMergeCtx *ctx_;
   ObTabletMergeDagParam param_;
   common::ObArenaAllocator allocator_;
+  int64_t admitted_mem_; // estimated peak memory held in ObCompactionMemBroker
 private:
   DISALLOW_COPY_AND_ASSIGN(ObTabletMergeDag);
 };
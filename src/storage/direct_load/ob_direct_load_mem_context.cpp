@@ -135,7 +135,17 @@ void ObDirectLoadMemContext::reset()
     }
   }
   tables_.reset();
+  range_tables_.reset();
   allocator_.reset();
+  use_sample_sort_ = false;
+  for (int64_t i = 0; i < split_rows_.count(); i ++) {
+    ObDirectLoadConstExternalMultiPartitionRow *row = split_rows_.at(i);
+    if (row != nullptr) {
+      row->~ObDirectLoadConstExternalMultiPartitionRow();
+    }
+  }
+  split_rows_.reset();
+  sample_allocator_.reset();
 }
 
 ObDirectLoadMemContext::~ObDirectLoadMemContext()
@@ -185,5 +195,55 @@ int ObDirectLoadMemContext::add_tables_from_table_compactor(
   return ret;
 }
 
+int ObDirectLoadMemContext::add_range_tables_from_table_builder(
+  const int64_t range_idx, ObIDirectLoadPartitionTableBuilder &builder)
+{
+  int ret = OB_SUCCESS;
+  lib::ObMutexGuard guard(mutex_);
+  ObArray<ObIDirectLoadPartitionTable *> table_array;
+  table_array.set_tenant_id(MTL_ID());
+  if (OB_UNLIKELY(range_idx < 0 || range_idx >= mem_dump_task_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", KR(ret), K(range_idx), K(mem_dump_task_count_));
+  } else if (OB_FAIL(builder.get_tables(table_array, allocator_))) {
+    LOG_WARN("fail to get tables", KR(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < table_array.count(); i ++) {
+    ObIDirectLoadPartitionTable *table = table_array.at(i);
+    if (OB_FAIL(tables_.push_back(table))) {
+      LOG_WARN("fail to push table", KR(ret));
+    } else if (OB_FAIL(range_tables_.push_back(std::make_pair(range_idx, table)))) {
+      LOG_WARN("fail to push range table", KR(ret));
+    }
+  }
+  return ret;
+}
+
+int ObDirectLoadMemContext::add_split_row(const ObDirectLoadConstExternalMultiPartitionRow &row)
+{
+  int ret = OB_SUCCESS;
+  ObDirectLoadConstExternalMultiPartitionRow *split_row = nullptr;
+  const int64_t buf_size = row.get_deep_copy_size();
+  char *buf = nullptr;
+  int64_t pos = 0;
+  if (OB_ISNULL(split_row = OB_NEWx(ObDirectLoadConstExternalMultiPartitionRow,
+                                    (&sample_allocator_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to new row", KR(ret));
+  } else if (OB_ISNULL(buf = static_cast<char *>(sample_allocator_.alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc buf", KR(ret), K(buf_size));
+  } else if (OB_FAIL(split_row->deep_copy(row, buf, buf_size, pos))) {
+    LOG_WARN("fail to deep copy row", KR(ret));
+  } else if (OB_FAIL(split_rows_.push_back(split_row))) {
+    LOG_WARN("fail to push row", KR(ret));
+  }
+  if (OB_FAIL(ret) && nullptr != split_row) {
+    split_row->~ObDirectLoadConstExternalMultiPartitionRow();
+    split_row = nullptr;
+  }
+  return ret;
+}
+
 }
 }
@@ -63,11 +63,16 @@ public:
                              mem_dump_task_count_(0),
                              running_dump_count_(0),
                              allocator_("TLD_mem_ctx"),
+                             use_sample_sort_(false),
+                             sample_allocator_("TLD_mem_sample"),
                              has_error_(false),
                              all_trans_finished_(false)
   {
     allocator_.set_tenant_id(MTL_ID());
     tables_.set_tenant_id(MTL_ID());
+    sample_allocator_.set_tenant_id(MTL_ID());
+    split_rows_.set_tenant_id(MTL_ID());
+    range_tables_.set_tenant_id(MTL_ID());
   }
 
   ~ObDirectLoadMemContext();
@@ -77,6 +82,10 @@ public:
   void reset();
   int add_tables_from_table_builder(ObIDirectLoadPartitionTableBuilder &builder);
   int add_tables_from_table_compactor(ObIDirectLoadTabletTableCompactor &compactor);
+  int add_range_tables_from_table_builder(const int64_t range_idx,
+                                          ObIDirectLoadPartitionTableBuilder &builder);
+  int add_split_row(const ObDirectLoadConstExternalMultiPartitionRow &row);
+  bool is_split_rows_ready() const { return split_rows_.count() + 1 == mem_dump_task_count_; }
 
 public:
   static const int64_t MIN_MEM_LIMIT = 8LL * 1024 * 1024; // 8MB
@@ -104,6 +113,13 @@ public:
   ObArray<ObIDirectLoadPartitionTable *> tables_;
   lib::ObMutex mutex_;
 
+  // sample sort: split rows are sampled once and every dump round writes one run for each range,
+  // runs of the same range are merged independently instead of being compacted per round
+  bool use_sample_sort_;
+  ObArenaAllocator sample_allocator_;
+  ObArray<ObDirectLoadConstExternalMultiPartitionRow *> split_rows_; // mem_dump_task_count_ - 1
+  ObArray<std::pair<int64_t, ObIDirectLoadPartitionTable *>> range_tables_; // owned by tables_
+
   volatile bool has_error_;
   bool all_trans_finished_;
 };
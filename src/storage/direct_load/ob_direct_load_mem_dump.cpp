@@ -183,6 +183,11 @@ int ObDirectLoadMemDump::close_table_builder(ObIDirectLoadPartitionTableBuilder
       ObSEArray<ObIDirectLoadPartitionTable *, 1> table_array;
       if (OB_FAIL(table_builder->close())) {
         LOG_WARN("fail to close sstable builder", KR(ret));
+      } else if (mem_ctx_->use_sample_sort_) {
+        // keep the run of this range, runs of the same range are merged after all rounds
+        if (OB_FAIL(mem_ctx_->add_range_tables_from_table_builder(range_idx_, *table_builder))) {
+          LOG_WARN("fail to add range tables", KR(ret), K(range_idx_));
+        }
       } else if (OB_FAIL(table_builder->get_tables(table_array, context_ptr_->safe_allocator_))) {
         LOG_WARN("fail to get tables", KR(ret));
       } else if (OB_UNLIKELY(1 != table_array.count())) {
@@ -447,7 +452,9 @@ int ObDirectLoadMemDump::do_dump()
   } else {
     int64_t finished = ATOMIC_AAF(&(context_ptr_->finished_sub_dump_count_), 1);
     if (finished == context_ptr_->sub_dump_count_) {
-      if (OB_FAIL(compact_tables())) {
+      if (mem_ctx_->use_sample_sort_) {
+        // runs are already added to mem_ctx_ by range
+      } else if (OB_FAIL(compact_tables())) {
         LOG_WARN("fail to compact tables", KR(ret));
       }
       ATOMIC_AAF(&(mem_ctx_->fly_mem_chunk_count_), -context_ptr_->mem_chunk_array_.count());
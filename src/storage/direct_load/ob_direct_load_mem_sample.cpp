@@ -32,7 +32,37 @@ ObDirectLoadMemSample::ObDirectLoadMemSample(observer::ObTableLoadTableCtx *ctx,
 }
 
 
+int ObDirectLoadMemSample::gen_ranges_by_split_rows(ObIArray<RangeType> &ranges)
+{
+  int ret = OB_SUCCESS;
+  RowType *last_row = nullptr;
+  for (int64_t i = 0; OB_SUCC(ret) && i < range_count_; i ++) {
+    RowType *row = (i + 1 < range_count_ ? mem_ctx_->split_rows_.at(i) : nullptr);
+    if (OB_FAIL(ranges.push_back(RangeType(last_row, row)))) {
+      LOG_WARN("fail to push range", KR(ret));
+    } else {
+      last_row = row;
+    }
+  }
+  return ret;
+}
+
 int ObDirectLoadMemSample::gen_ranges(ObIArray<ChunkType *> &chunks, ObIArray<RangeType> &ranges)
+{
+  int ret = OB_SUCCESS;
+  if (mem_ctx_->use_sample_sort_ && mem_ctx_->is_split_rows_ready()) {
+    // split rows are fixed after the first round, so the runs of all rounds share the same ranges
+    if (OB_FAIL(gen_ranges_by_split_rows(ranges))) {
+      LOG_WARN("fail to gen ranges by split rows", KR(ret));
+    }
+  } else if (OB_FAIL(gen_ranges_by_sample(chunks, ranges))) {
+    LOG_WARN("fail to gen ranges by sample", KR(ret));
+  }
+  return ret;
+}
+
+int ObDirectLoadMemSample::gen_ranges_by_sample(ObIArray<ChunkType *> &chunks,
+                                                ObIArray<RangeType> &ranges)
 {
   int ret = OB_SUCCESS;
   ObArray<RowType *> sample_rows;
@@ -62,6 +92,8 @@ int ObDirectLoadMemSample::gen_ranges(ObIArray<ChunkType *> &chunks, ObIArray<Ra
     if (i != range_count_) {
       if (OB_FAIL(ranges.push_back(RangeType(last_row, sample_rows[i * step])))) {
         LOG_WARN("fail to push range", KR(ret));
+      } else if (mem_ctx_->use_sample_sort_ && OB_FAIL(mem_ctx_->add_split_row(*sample_rows[i * step]))) {
+        LOG_WARN("fail to add split row", KR(ret));
       } else {
         last_row = sample_rows[i * step];
       }
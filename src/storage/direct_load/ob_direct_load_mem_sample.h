@@ -47,6 +47,9 @@ private:
                table::ObTableLoadHandle<ObDirectLoadMemDump::Context> sample_ptr);
   int gen_ranges(common::ObIArray<ChunkType *> &chunks,
                  common::ObIArray<RangeType> &ranges);
+  int gen_ranges_by_sample(common::ObIArray<ChunkType *> &chunks,
+                           common::ObIArray<RangeType> &ranges);
+  int gen_ranges_by_split_rows(common::ObIArray<RangeType> &ranges);
 
 private:
   // data members
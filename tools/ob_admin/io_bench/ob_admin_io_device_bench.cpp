@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include "ob_admin_io_device_bench.h"
+#include "lib/random/ob_random.h"
+#include "lib/time/ob_time_utility.h"
+#include "share/ob_local_device.h"
+#include "share/ob_local_io_uring_device.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+namespace oceanbase
+{
+namespace tools
+{
+
+const char *const ObAdminIODeviceBench::BENCH_FILE_NAME = "io_device_bench_file";
+
+static int64_t get_cpu_time_us(const struct rusage &usage)
+{
+  return usage.ru_utime.tv_sec * 1000000L + usage.ru_utime.tv_usec
+         + usage.ru_stime.tv_sec * 1000000L + usage.ru_stime.tv_usec;
+}
+
+int ObAdminIODeviceBench::run(const char *backend)
+{
+  int ret = OB_SUCCESS;
+  const bool run_aio = 0 == STRCMP(backend, "aio") || 0 == STRCMP(backend, "all");
+  const bool run_io_uring = 0 == STRCMP(backend, "io_uring") || 0 == STRCMP(backend, "all");
+  if (OB_UNLIKELY(!run_aio && !run_io_uring)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "unknown io backend", K(ret), K(backend));
+  } else if (OB_ISNULL(config_.data_dir_) || OB_UNLIKELY(config_.io_size_ <= 0
+             || 0 != config_.io_size_ % DIO_READ_ALIGN_SIZE || config_.io_depth_ <= 0
+             || config_.file_size_ < config_.io_size_ * config_.io_depth_
+             || config_.time_limit_s_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "invalid bench config", K(ret), K_(config));
+  } else {
+    fprintf(stdout, "%-10s %-10s %-12s %-10s %-12s %-12s %-12s %-14s\n", "backend", "io_type",
+            "io_size_byte", "io_depth", "io_ps", "avg_rt_us", "max_rt_us", "cpu_us_per_io");
+    if (run_aio) {
+      IODeviceBenchResult result;
+      if (OB_FAIL(run_backend(false/*use_io_uring*/, result))) {
+        COMMON_LOG(WARN, "fail to bench aio", K(ret), K_(config));
+      } else {
+        print_result("aio", result);
+      }
+    }
+    if (OB_SUCC(ret) && run_io_uring) {
+      IODeviceBenchResult result;
+      if (OB_FAIL(run_backend(true/*use_io_uring*/, result))) {
+        COMMON_LOG(WARN, "fail to bench io_uring", K(ret), K_(config));
+      } else {
+        print_result("io_uring", result);
+      }
+    }
+    char path[OB_MAX_FILE_NAME_LENGTH] = { 0 };
+    if (snprintf(path, sizeof(path), "%s/%s", config_.data_dir_, BENCH_FILE_NAME) > 0) {
+      ::unlink(path);
+    }
+  }
+  return ret;
+}
+
+int ObAdminIODeviceBench::run_backend(const bool use_io_uring, IODeviceBenchResult &result)
+{
+  int ret = OB_SUCCESS;
+  ObIODOpts opts; // no block file, only normal files are used
+  ObLocalDevice aio_device;
+  ObLocalIOUringDevice uring_device;
+  ObLocalDevice *device = use_io_uring ? &uring_device : &aio_device;
+  const int64_t buf_size = config_.io_size_ * config_.io_depth_;
+  char *buf = static_cast<char *>(ob_malloc_align(DIO_READ_ALIGN_SIZE, buf_size, "IODeviceBench"));
+  if (OB_ISNULL(buf)) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    COMMON_LOG(WARN, "fail to alloc io buffer", K(ret), K(buf_size));
+  } else if (FALSE_IT(MEMSET(buf, 'a', buf_size))) {
+  } else if (OB_FAIL(device->init(opts))) {
+    COMMON_LOG(WARN, "fail to init device", K(ret), K(use_io_uring));
+  } else if (use_io_uring) {
+    uring_device.set_use_sqpoll(config_.use_sqpoll_);
+  }
+  if (OB_SUCC(ret) && OB_FAIL(do_bench(*device, buf, result))) {
+    COMMON_LOG(WARN, "fail to do bench", K(ret), K(use_io_uring));
+  }
+  device->destroy();
+  if (OB_NOT_NULL(buf)) {
+    ob_free_align(buf);
+  }
+  return ret;
+}
+
+int ObAdminIODeviceBench::do_bench(ObLocalDevice &device, char *buf, IODeviceBenchResult &result)
+{
+  int ret = OB_SUCCESS;
+  const int64_t io_size = config_.io_size_;
+  const int64_t io_depth = config_.io_depth_;
+  const int64_t block_cnt = config_.file_size_ / io_size;
+  char path[OB_MAX_FILE_NAME_LENGTH] = { 0 };
+  ObIOFd fd;
+  ObIOContext *io_context = NULL;
+  ObIOEvents *io_events = NULL;
+  ObIOCB **iocbs = NULL;
+  int64_t *submit_ts = NULL;
+  int64_t inflight_cnt = 0;
+  struct timespec timeout = { 0, 100L * 1000L * 1000L }; // 100ms
+  struct rusage start_usage;
+  struct rusage end_usage;
+  int64_t start_ts = 0;
+  int64_t end_ts = 0;
+  ObArenaAllocator arena("IODeviceBench");
+
+  // slot i always uses buf + i * io_size, the callback data is slot + 1 so it's never null
+  auto submit_slot = [&](const int64_t slot) -> int {
+    int ret = OB_SUCCESS;
+    const int64_t offset = ObRandom::rand(0, block_cnt - 1) * io_size;
+    void *data = reinterpret_cast<void *>(slot + 1);
+    if (config_.is_write_) {
+      ret = device.io_prepare_pwrite(fd, buf + slot * io_size, io_size, offset, iocbs[slot], data);
+    } else {
+      ret = device.io_prepare_pread(fd, buf + slot * io_size, io_size, offset, iocbs[slot], data);
+    }
+    if (OB_FAIL(ret)) {
+      COMMON_LOG(WARN, "fail to prepare io", K(ret), K(slot), K(offset));
+    } else if (OB_FAIL(device.io_submit(io_context, iocbs[slot]))) {
+      COMMON_LOG(WARN, "fail to submit io", K(ret), K(slot), K(offset));
+    } else {
+      submit_ts[slot] = ObTimeUtility::current_time();
+      ++inflight_cnt;
+    }
+    return ret;
+  };
+
+  if (snprintf(path, sizeof(path), "%s/%s", config_.data_dir_, BENCH_FILE_NAME) <= 0) {
+    ret = OB_SIZE_OVERFLOW;
+    COMMON_LOG(WARN, "bench file path too long", K(ret), K(config_.data_dir_));
+  } else if (OB_FAIL(device.open(path, O_RDWR | O_CREAT | O_DIRECT, S_IRUSR | S_IWUSR, fd))) {
+    COMMON_LOG(WARN, "fail to open bench file", K(ret), K(path));
+  } else if (OB_FAIL(device.fallocate(fd, 0, 0, config_.file_size_))) {
+    COMMON_LOG(WARN, "fail to fallocate bench file", K(ret), K(path), K(config_.file_size_));
+  } else if (OB_FAIL(device.io_setup(static_cast<uint32_t>(io_depth), io_context))) {
+    COMMON_LOG(WARN, "fail to setup io context", K(ret), K(io_depth));
+  } else if (OB_ISNULL(io_events = device.alloc_io_events(static_cast<uint32_t>(io_depth)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    COMMON_LOG(WARN, "fail to alloc io events", K(ret), K(io_depth));
+  } else if (OB_ISNULL(iocbs = static_cast<ObIOCB **>(arena.alloc(sizeof(ObIOCB *) * io_depth)))
+             || OB_ISNULL(submit_ts = static_cast<int64_t *>(arena.alloc(sizeof(int64_t) * io_depth)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    COMMON_LOG(WARN, "fail to alloc slots", K(ret), K(io_depth));
+  } else {
+    MEMSET(iocbs, 0, sizeof(ObIOCB *) * io_depth);
+    for (int64_t i = 0; OB_SUCC(ret) && i < io_depth; ++i) {
+      if (OB_ISNULL(iocbs[i] = device.alloc_iocb(OB_SERVER_TENANT_ID))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        COMMON_LOG(WARN, "fail to alloc iocb", K(ret), K(i));
+      }
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    getrusage(RUSAGE_SELF, &start_usage);
+    start_ts = ObTimeUtility::current_time();
+    end_ts = start_ts + config_.time_limit_s_ * 1000L * 1000L;
+    for (int64_t i = 0; OB_SUCC(ret) && i < io_depth; ++i) {
+      ret = submit_slot(i);
+    }
+  }
+  // keep reaping even after failure, the buffers must not be freed while io is in flight
+  while (inflight_cnt > 0) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_TMP_FAIL(device.io_getevents(io_context, 1, io_events, &timeout))) {
+      COMMON_LOG(WARN, "fail to get io events", K(tmp_ret), K(inflight_cnt));
+      ret = OB_SUCC(ret) ? tmp_ret : ret;
+      break;
+    }
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < io_events->get_complete_cnt(); ++i) {
+      const int64_t slot = reinterpret_cast<int64_t>(io_events->get_ith_data(i)) - 1;
+      const int64_t rt_us = cur_ts - submit_ts[slot];
+      --inflight_cnt;
+      if (0 != io_events->get_ith_ret_code(i) || io_size != io_events->get_ith_ret_bytes(i)) {
+        ret = OB_SUCC(ret) ? OB_IO_ERROR : ret;
+        COMMON_LOG(WARN, "io failed", K(ret), K(slot), "sys_errno", io_events->get_ith_ret_code(i),
+                   "bytes", io_events->get_ith_ret_bytes(i));
+      } else {
+        ++result.io_cnt_;
+        result.total_rt_us_ += rt_us;
+        result.max_rt_us_ = MAX(result.max_rt_us_, rt_us);
+        if (OB_SUCC(ret) && cur_ts < end_ts) {
+          ret = submit_slot(slot);
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    result.elapsed_us_ = ObTimeUtility::current_time() - start_ts;
+    getrusage(RUSAGE_SELF, &end_usage);
+    result.cpu_us_ = get_cpu_time_us(end_usage) - get_cpu_time_us(start_usage);
+  }
+
+  for (int64_t i = 0; NULL != iocbs && i < io_depth; ++i) {
+    if (NULL != iocbs[i]) {
+      device.free_iocb(iocbs[i]);
+    }
+  }
+  if (NULL != io_events) {
+    device.free_io_events(io_events);
+  }
+  if (NULL != io_context) {
+    device.io_destroy(io_context);
+  }
+  if (fd.is_valid()) {
+    device.close(fd);
+  }
+  return ret;
+}
+
+void ObAdminIODeviceBench::print_result(const char *backend, const IODeviceBenchResult &result) const
+{
+  const int64_t io_cnt = MAX(1, result.io_cnt_);
+  const double iops = result.elapsed_us_ > 0 ? result.io_cnt_ * 1000000.0 / result.elapsed_us_ : 0;
+  fprintf(stdout, "%-10s %-10s %-12ld %-10ld %-12.0f %-12.1f %-12ld %-14.2f\n",
+          backend, config_.is_write_ ? "randwrite" : "randread", config_.io_size_, config_.io_depth_,
+          iops, static_cast<double>(result.total_rt_us_) / io_cnt, result.max_rt_us_,
+          static_cast<double>(result.cpu_us_) / io_cnt);
+  COMMON_LOG(INFO, "io device bench result", K(backend), K_(config), K(result));
+}
+
+}
+}
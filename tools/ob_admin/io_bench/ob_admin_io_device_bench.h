@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_ADMIN_IO_DEVICE_BENCH_H_
+#define OB_ADMIN_IO_DEVICE_BENCH_H_
+
+#include "lib/ob_define.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace share
+{
+class ObLocalDevice;
+}
+namespace tools
+{
+
+struct IODeviceBenchConfig
+{
+  IODeviceBenchConfig()
+    : data_dir_(NULL), file_size_(0), io_size_(4096), io_depth_(32), time_limit_s_(10),
+      is_write_(false), use_sqpoll_(false)
+  {}
+  TO_STRING_KV(K_(data_dir), K_(file_size), K_(io_size), K_(io_depth), K_(time_limit_s),
+               K_(is_write), K_(use_sqpoll));
+  const char *data_dir_;
+  int64_t file_size_;
+  int64_t io_size_;
+  int64_t io_depth_;
+  int64_t time_limit_s_;
+  bool is_write_;
+  bool use_sqpoll_;
+};
+
+struct IODeviceBenchResult
+{
+  IODeviceBenchResult() : io_cnt_(0), total_rt_us_(0), max_rt_us_(0), elapsed_us_(0), cpu_us_(0) {}
+  TO_STRING_KV(K_(io_cnt), K_(total_rt_us), K_(max_rt_us), K_(elapsed_us), K_(cpu_us));
+  int64_t io_cnt_;
+  int64_t total_rt_us_;
+  int64_t max_rt_us_;
+  int64_t elapsed_us_;
+  // user + sys time of the process, including the io_uring sq poller thread
+  int64_t cpu_us_;
+};
+
+// Drives random direct io with a fixed queue depth through the async interfaces of the
+// local device, one submit/reap thread, so that backends can be compared on iops, latency
+// and cpu cost per io.
+class ObAdminIODeviceBench
+{
+public:
+  static const char *const BENCH_FILE_NAME;
+  ObAdminIODeviceBench(const IODeviceBenchConfig &config) : config_(config) {}
+  ~ObAdminIODeviceBench() {}
+  // @backend: "aio", "io_uring" or "all"
+  int run(const char *backend);
+private:
+  int run_backend(const bool use_io_uring, IODeviceBenchResult &result);
+  int do_bench(share::ObLocalDevice &device, char *buf, IODeviceBenchResult &result);
+  void print_result(const char *backend, const IODeviceBenchResult &result) const;
+private:
+  const IODeviceBenchConfig &config_;
+  DISALLOW_COPY_AND_ASSIGN(ObAdminIODeviceBench);
+};
+
+}
+}
+
+#endif /* OB_ADMIN_IO_DEVICE_BENCH_H_ */
@@ -12,6 +12,7 @@
 
 #include "ob_admin_io_executor.h"
 #include "share/io/ob_io_manager.h"
+#include "share/config/ob_config_helper.h"
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -24,7 +25,9 @@ namespace tools
 ObAdminIOExecutor::ObAdminIOExecutor()
   : conf_dir_(NULL),
     data_dir_(NULL),
-    file_size_(NULL)
+    file_size_(NULL),
+    backend_(NULL),
+    device_bench_config_()
 {
 }
 
@@ -38,7 +41,42 @@ int ObAdminIOExecutor::execute(int argc, char *argv[])
   reset();
   if (OB_FAIL(parse_cmd(argc - 1, argv + 1))) {
     COMMON_LOG(ERROR, "Fail to parse cmd, ", K(ret));
-  } else if (OB_UNLIKELY(NULL == conf_dir_ || NULL == data_dir_)) {
+  } else if (NULL != backend_) {
+    if (OB_FAIL(run_device_bench())) {
+      COMMON_LOG(ERROR, "Fail to run io device bench", K(ret));
+    }
+  } else if (OB_FAIL(run_fio_bench())) {
+    COMMON_LOG(ERROR, "Fail to run fio bench", K(ret));
+  }
+  return ret;
+}
+
+int ObAdminIOExecutor::run_device_bench()
+{
+  int ret = OB_SUCCESS;
+  bool valid = true;
+  if (OB_UNLIKELY(NULL == data_dir_)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(ERROR, "invalid argument", K(ret), K(data_dir_));
+  } else if (FALSE_IT(device_bench_config_.file_size_ = NULL == file_size_
+      ? DEFAULT_DEVICE_BENCH_FILE_SIZE : ObConfigCapacityParser::get(file_size_, valid))) {
+  } else if (OB_UNLIKELY(!valid)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(ERROR, "invalid file size", K(ret), K(file_size_));
+  } else {
+    device_bench_config_.data_dir_ = data_dir_;
+    ObAdminIODeviceBench bench(device_bench_config_);
+    if (OB_FAIL(bench.run(backend_))) {
+      COMMON_LOG(ERROR, "io device bench failed", K(ret), K(backend_), K(device_bench_config_));
+    }
+  }
+  return ret;
+}
+
+int ObAdminIOExecutor::run_fio_bench()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(NULL == conf_dir_ || NULL == data_dir_)) {
     ret = OB_INVALID_ARGUMENT;
     COMMON_LOG(ERROR, "invalid argument", K(ret), K(data_dir_), K(conf_dir_));
   } else {
@@ -83,12 +121,19 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
 {
   int ret = OB_SUCCESS;
   int opt = 0;
-  const char* opt_string = "hc:d:f:";
+  const char* opt_string = "hc:d:f:b:s:q:t:wp";
   struct option longopts[] =
     {{"help", 0, NULL, 'h' },
      {"conf_dir", 1, NULL, 'c'},
      {"data_dir", 1, NULL, 'd'},
-     {"file_size", 1, NULL, 'f'}};
+     {"file_size", 1, NULL, 'f'},
+     {"backend", 1, NULL, 'b'},
+     {"io_size", 1, NULL, 's'},
+     {"io_depth", 1, NULL, 'q'},
+     {"time", 1, NULL, 't'},
+     {"write", 0, NULL, 'w'},
+     {"sqpoll", 0, NULL, 'p'},
+     {0, 0, 0, 0}};
 
   while ((opt = getopt_long(argc, argv, opt_string, longopts, NULL)) != -1) {
     switch (opt) {
@@ -108,6 +153,30 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
         file_size_ = optarg;
         break;
       }
+      case 'b': {
+        backend_ = optarg;
+        break;
+      }
+      case 's': {
+        device_bench_config_.io_size_ = strtoll(optarg, NULL, 10);
+        break;
+      }
+      case 'q': {
+        device_bench_config_.io_depth_ = strtoll(optarg, NULL, 10);
+        break;
+      }
+      case 't': {
+        device_bench_config_.time_limit_s_ = strtoll(optarg, NULL, 10);
+        break;
+      }
+      case 'w': {
+        device_bench_config_.is_write_ = true;
+        break;
+      }
+      case 'p': {
+        device_bench_config_.use_sqpoll_ = true;
+        break;
+      }
       default: {
         print_usage();
         ret = OB_INVALID_ARGUMENT;
@@ -119,7 +188,12 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
 
 void ObAdminIOExecutor::print_usage()
 {
-  fprintf(stderr, "\nUsage: ob_tool io_bench -c conf_dir -d data_dir\n");
+  fprintf(stderr, "\nUsage: ob_tool io_bench -c conf_dir -d data_dir\n"
+                  "       ob_tool io_bench -d data_dir -b aio|io_uring|all [-f file_size] [-s io_size]"
+                  " [-q io_depth] [-t seconds] [-w] [-p]\n"
+                  "         -b compare async io backends of local device by random direct io\n"
+                  "         -w random write instead of random read\n"
+                  "         -p io_uring with sqpoll\n");
 }
 
 void ObAdminIOExecutor::reset()
@@ -127,6 +201,8 @@ void ObAdminIOExecutor::reset()
   conf_dir_ = NULL;
   data_dir_ = NULL;
   file_size_ = NULL;
+  backend_ = NULL;
+  device_bench_config_ = IODeviceBenchConfig();
 }
 
 }
@@ -13,6 +13,7 @@
 #ifndef OB_ADMIN_IO_EXECUTOR_H_
 #define OB_ADMIN_IO_EXECUTOR_H_
 #include "../ob_admin_executor.h"
+#include "ob_admin_io_device_bench.h"
 
 namespace oceanbase
 {
@@ -28,11 +29,17 @@ public:
   void reset();
 private:
   static const int64_t DEFAULT_BENCH_FILE_SIZE = 1024L * 1024L * 1024L * 100L;
+  static const int64_t DEFAULT_DEVICE_BENCH_FILE_SIZE = 1024L * 1024L * 1024L * 10L;
   int parse_cmd(int argc, char *argv[]);
   void print_usage();
+  int run_fio_bench();
+  int run_device_bench();
   const char *conf_dir_;
   const char *data_dir_;
   const char *file_size_;
+  // compare the async io backends of local device instead of generating io_resource.conf by fio
+  const char *backend_;
+  IODeviceBenchConfig device_bench_config_;
 };
 
 }
@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/oblog/ob_log.h"
+#include <gtest/gtest.h>
+#include "ob_log_safe_arena.h"
+#include "ob_cdc_columnar_batch.h"
+#include "ob_log_part_trans_task.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace libobcdc
+{
+
+static bool is_null_at(const ObCDCColumnVector &vector, const int64_t row_idx)
+{
+  return 0 != (vector.null_bitmap_[row_idx / 8] & (1 << (row_idx % 8)));
+}
+
+static bool is_nop_at(const ObCDCColumnVector &vector, const int64_t row_idx)
+{
+  return 0 != (vector.nop_bitmap_[row_idx / 8] & (1 << (row_idx % 8)));
+}
+
+static ObString get_string_at(const ObCDCColumnVector &vector, const int64_t row_idx)
+{
+  return ObString(static_cast<int32_t>(vector.offsets_[row_idx + 1] - vector.offsets_[row_idx]),
+      vector.data_ + vector.offsets_[row_idx]);
+}
+
+TEST(ObCDCColumnarBatch, test_append_row)
+{
+  ObCdcSafeArena allocator;
+  ObLobDataOutRowCtxList lob_ctx_cols(allocator);
+  ObCDCColumnarBatch batch(allocator);
+  const int64_t ROW_CNT = 100;
+  ColValue id_cv;
+  ColValue name_cv;
+  ColValue score_cv;
+  int64_t row_idx = 0;
+
+  EXPECT_EQ(OB_SUCCESS, batch.init(1001, 500001));
+
+  for (int64_t idx = 0; idx < ROW_CNT; idx++) {
+    id_cv.reset();
+    name_cv.reset();
+    score_cv.reset();
+    id_cv.column_id_ = 16;
+    id_cv.value_.set_int(idx);
+    name_cv.column_id_ = 17;
+    // name of odd rows is NULL
+    if (0 == idx % 2) {
+      name_cv.value_.set_varchar("name");
+    } else {
+      name_cv.value_.set_null();
+    }
+    id_cv.next_ = &name_cv;
+    // score column only appears since row 10
+    if (idx >= 10) {
+      score_cv.column_id_ = 18;
+      score_cv.value_.set_double(static_cast<double>(idx) / 2);
+      name_cv.next_ = &score_cv;
+    }
+    EXPECT_EQ(OB_SUCCESS, batch.append_row(static_cast<int32_t>(idx % 3), &id_cv, lob_ctx_cols, row_idx));
+    EXPECT_EQ(idx, row_idx);
+  }
+  EXPECT_EQ(OB_SUCCESS, batch.finish());
+  EXPECT_EQ(ROW_CNT, batch.get_row_count());
+  EXPECT_EQ(3, batch.get_column_count());
+  EXPECT_EQ(NULL, batch.get_column(3));
+
+  const ObCDCColumnVector *id_vec = batch.get_column(0);
+  const ObCDCColumnVector *name_vec = batch.get_column(1);
+  const ObCDCColumnVector *score_vec = batch.get_column(2);
+  ASSERT_TRUE(NULL != id_vec && NULL != name_vec && NULL != score_vec);
+  EXPECT_EQ(OB_CDC_COLUMN_TYPE_INT64, id_vec->type_);
+  EXPECT_EQ(OB_CDC_COLUMN_TYPE_BINARY, name_vec->type_);
+  EXPECT_EQ(OB_CDC_COLUMN_TYPE_DOUBLE, score_vec->type_);
+
+  for (int64_t idx = 0; idx < ROW_CNT; idx++) {
+    EXPECT_EQ(idx % 3, batch.get_record_types()[idx]);
+    EXPECT_FALSE(is_null_at(*id_vec, idx));
+    EXPECT_FALSE(is_nop_at(*id_vec, idx));
+    EXPECT_EQ(idx, static_cast<const int64_t *>(id_vec->values_)[idx]);
+    EXPECT_EQ(1 == idx % 2, is_null_at(*name_vec, idx));
+    EXPECT_FALSE(is_nop_at(*name_vec, idx));
+    EXPECT_EQ(0 == idx % 2 ? ObString("name") : ObString(), get_string_at(*name_vec, idx));
+    // rows before the score column appears don't carry it
+    EXPECT_FALSE(is_null_at(*score_vec, idx));
+    EXPECT_EQ(idx < 10, is_nop_at(*score_vec, idx));
+    if (idx >= 10) {
+      EXPECT_EQ(static_cast<double>(idx) / 2, static_cast<const double *>(score_vec->values_)[idx]);
+    }
+  }
+  EXPECT_EQ(OB_STATE_NOT_MATCH, batch.append_row(0, &id_cv, lob_ctx_cols, row_idx));
+}
+
+TEST(ObCDCColumnarBatch, test_all_null_column)
+{
+  ObCdcSafeArena allocator;
+  ObLobDataOutRowCtxList lob_ctx_cols(allocator);
+  ObCDCColumnarBatch batch(allocator);
+  ColValue cv;
+  int64_t row_idx = 0;
+
+  EXPECT_EQ(OB_SUCCESS, batch.init(1001, 500001));
+  for (int64_t idx = 0; idx < 3; idx++) {
+    cv.reset();
+    cv.column_id_ = 16;
+    cv.value_.set_null();
+    EXPECT_EQ(OB_SUCCESS, batch.append_row(0, &cv, lob_ctx_cols, row_idx));
+  }
+  EXPECT_EQ(OB_SUCCESS, batch.finish());
+
+  const ObCDCColumnVector *vec = batch.get_column(0);
+  ASSERT_TRUE(NULL != vec);
+  EXPECT_EQ(OB_CDC_COLUMN_TYPE_UNKNOWN, vec->type_);
+  for (int64_t idx = 0; idx < 3; idx++) {
+    EXPECT_TRUE(is_null_at(*vec, idx));
+    EXPECT_FALSE(is_nop_at(*vec, idx));
+  }
+}
+
+TEST(ObCDCColumnarBatch, test_nop_column)
+{
+  ObCdcSafeArena allocator;
+  ObLobDataOutRowCtxList lob_ctx_cols(allocator);
+  ObCDCColumnarBatch batch(allocator);
+  ColValue cv;
+  int64_t row_idx = 0;
+
+  EXPECT_EQ(OB_SUCCESS, batch.init(1001, 500001));
+  // row 0 updates the column to NULL, row 1 doesn't update it in minimal mode, row 2 updates it to 1
+  for (int64_t idx = 0; idx < 3; idx++) {
+    cv.reset();
+    cv.column_id_ = 16;
+    if (0 == idx) {
+      cv.value_.set_null();
+    } else if (1 == idx) {
+      cv.is_col_nop_ = 1;
+    } else {
+      cv.value_.set_int(1);
+    }
+    EXPECT_EQ(OB_SUCCESS, batch.append_row(EUPDATE, &cv, lob_ctx_cols, row_idx));
+  }
+  EXPECT_EQ(OB_SUCCESS, batch.finish());
+
+  const ObCDCColumnVector *vec = batch.get_column(0);
+  ASSERT_TRUE(NULL != vec);
+  EXPECT_EQ(OB_CDC_COLUMN_TYPE_INT64, vec->type_);
+  EXPECT_TRUE(is_null_at(*vec, 0));
+  EXPECT_FALSE(is_nop_at(*vec, 0));
+  EXPECT_FALSE(is_null_at(*vec, 1));
+  EXPECT_TRUE(is_nop_at(*vec, 1));
+  EXPECT_FALSE(is_null_at(*vec, 2));
+  EXPECT_FALSE(is_nop_at(*vec, 2));
+  EXPECT_EQ(1, static_cast<const int64_t *>(vec->values_)[2]);
+}
+
+TEST(ObCDCColumnarBatch, test_obj_column)
+{
+  ObCdcSafeArena allocator;
+  ObLobDataOutRowCtxList lob_ctx_cols(allocator);
+  ObCDCColumnarBatch batch(allocator);
+  ColValue cv;
+  int64_t row_idx = 0;
+
+  EXPECT_EQ(OB_SUCCESS, batch.init(1001, 500001));
+  for (int64_t idx = 0; idx < 3; idx++) {
+    cv.reset();
+    cv.column_id_ = 16;
+    cv.value_.set_datetime(1700000000000000 + idx);
+    EXPECT_EQ(OB_SUCCESS, batch.append_row(EINSERT, &cv, lob_ctx_cols, row_idx));
+  }
+  EXPECT_EQ(OB_SUCCESS, batch.finish());
+
+  const ObCDCColumnVector *vec = batch.get_column(0);
+  ASSERT_TRUE(NULL != vec);
+  // the datum is kept as ObObj instead of the text of the binlog record
+  EXPECT_EQ(OB_CDC_COLUMN_TYPE_OBJ, vec->type_);
+  for (int64_t idx = 0; idx < 3; idx++) {
+    const ObString value = get_string_at(*vec, idx);
+    ObObj obj;
+    int64_t pos = 0;
+    EXPECT_EQ(OB_SUCCESS, obj.deserialize(value.ptr(), value.length(), pos));
+    EXPECT_EQ(value.length(), pos);
+    EXPECT_TRUE(obj.is_datetime());
+    EXPECT_EQ(1700000000000000 + idx, obj.get_datetime());
+  }
+}
+
+} // namespace libobcdc
+} // ns oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("DEBUG");
+  OB_LOGGER.set_log_level("DEBUG");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
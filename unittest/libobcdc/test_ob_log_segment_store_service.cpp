@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/oblog/ob_log.h"
+#include <gtest/gtest.h>
+#include "lib/file/file_directory_utils.h"
+#include "lib/time/ob_time_utility.h"
+#include "ob_log_segment_store_service.h"
+#include "ob_log_rocksdb_store_service.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace libobcdc
+{
+
+static std::string build_key(const int64_t idx)
+{
+  char buf[64];
+  snprintf(buf, sizeof(buf), "key:1001_1_%010ld", idx);
+  return std::string(buf);
+}
+
+static bool is_segment_exist(const char *segment_path)
+{
+  bool is_exist = false;
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::is_exists(segment_path, is_exist));
+  return is_exist;
+}
+
+TEST(ObLogSegmentStoreService, test_put_get_del)
+{
+  ObLogSegmentStoreService store;
+  void *cf = NULL;
+  std::string value;
+  int64_t live_size = 0;
+  int64_t num_keys = 0;
+
+  EXPECT_EQ(OB_SUCCESS, store.init("./segment_store_test"));
+  EXPECT_EQ(OB_SUCCESS, store.create_column_family("1001:tenant", cf));
+
+  EXPECT_EQ(OB_SUCCESS, store.put(cf, "k1", ObSlice("value1", 6)));
+  EXPECT_EQ(OB_SUCCESS, store.put(cf, "k2", ObSlice("value2", 6)));
+  EXPECT_EQ(OB_SUCCESS, store.get(cf, "k1", value));
+  EXPECT_EQ("value1", value);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, store.get(cf, "k3", value));
+
+  // overwrite
+  EXPECT_EQ(OB_SUCCESS, store.put(cf, "k1", ObSlice("new_value1", 10)));
+  EXPECT_EQ(OB_SUCCESS, store.get(cf, "k1", value));
+  EXPECT_EQ("new_value1", value);
+  EXPECT_EQ(OB_SUCCESS, store.get_mem_usage(cf, live_size, num_keys));
+  EXPECT_EQ(16, live_size);
+  EXPECT_EQ(2, num_keys);
+
+  EXPECT_EQ(OB_SUCCESS, store.del(cf, "k1"));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, store.get(cf, "k1", value));
+  EXPECT_EQ(OB_SUCCESS, store.del(cf, "k1"));
+  EXPECT_EQ(OB_SUCCESS, store.get(cf, "k2", value));
+  EXPECT_EQ("value2", value);
+
+  // default column family
+  EXPECT_EQ(OB_SUCCESS, store.put("k1", ObSlice("value1", 6)));
+  EXPECT_EQ(OB_SUCCESS, store.get("k1", value));
+  EXPECT_EQ("value1", value);
+
+  EXPECT_EQ(OB_SUCCESS, store.drop_column_family(cf));
+  EXPECT_EQ(OB_SUCCESS, store.destory_column_family(cf));
+  store.destroy();
+}
+
+TEST(ObLogSegmentStoreService, test_batch_write_and_del_range)
+{
+  ObLogSegmentStoreService store;
+  void *cf = NULL;
+  std::vector<std::string> keys;
+  std::vector<ObSlice> values;
+  std::string value;
+  int64_t live_size = 0;
+  int64_t num_keys = 0;
+  const char *data = "0123456789";
+
+  EXPECT_EQ(OB_SUCCESS, store.init("./segment_store_test"));
+  EXPECT_EQ(OB_SUCCESS, store.create_column_family("1001:tenant", cf));
+
+  for (int64_t idx = 0; idx < 100; idx++) {
+    keys.push_back(build_key(idx));
+    values.push_back(ObSlice(data, idx % 10 + 1));
+  }
+  EXPECT_EQ(OB_SUCCESS, store.batch_write(cf, keys, values));
+
+  for (int64_t idx = 0; idx < 100; idx++) {
+    EXPECT_EQ(OB_SUCCESS, store.get(cf, keys[idx], value));
+    EXPECT_EQ(std::string(data, idx % 10 + 1), value);
+  }
+
+  // delete [10, 90)
+  EXPECT_EQ(OB_SUCCESS, store.del_range(cf, build_key(10), build_key(90)));
+  EXPECT_EQ(OB_SUCCESS, store.get_mem_usage(cf, live_size, num_keys));
+  EXPECT_EQ(20, num_keys);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, store.get(cf, build_key(10), value));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, store.get(cf, build_key(89), value));
+  EXPECT_EQ(OB_SUCCESS, store.get(cf, build_key(9), value));
+  EXPECT_EQ(OB_SUCCESS, store.get(cf, build_key(90), value));
+
+  EXPECT_EQ(OB_SUCCESS, store.drop_column_family(cf));
+  EXPECT_EQ(OB_SUCCESS, store.destory_column_family(cf));
+  store.destroy();
+}
+
+TEST(ObLogSegmentStoreService, test_segment_reclaim)
+{
+  ObLogSegmentStoreService store;
+  void *cf = NULL;
+  const int64_t SEGMENT_SIZE = 1024;
+  const int64_t VALUE_SIZE = 256;
+  char data[VALUE_SIZE];
+  std::string value;
+
+  memset(data, 'a', VALUE_SIZE);
+  EXPECT_EQ(OB_SUCCESS, store.init("./segment_store_test", SEGMENT_SIZE));
+  // column family 0 is the default column family
+  EXPECT_EQ(OB_SUCCESS, store.create_column_family("1001:tenant", cf));
+
+  // 4 values per segment, segment 0 and 1 are sealed after 10 values
+  for (int64_t idx = 0; idx < 10; idx++) {
+    EXPECT_EQ(OB_SUCCESS, store.put(cf, build_key(idx), ObSlice(data, VALUE_SIZE)));
+  }
+  EXPECT_TRUE(is_segment_exist("./segment_store_test/cf_1/0.seg"));
+  EXPECT_TRUE(is_segment_exist("./segment_store_test/cf_1/1.seg"));
+  EXPECT_TRUE(is_segment_exist("./segment_store_test/cf_1/2.seg"));
+
+  // segment 0 is removed after all values in it are deleted
+  EXPECT_EQ(OB_SUCCESS, store.del_range(cf, build_key(0), build_key(3)));
+  EXPECT_TRUE(is_segment_exist("./segment_store_test/cf_1/0.seg"));
+  EXPECT_EQ(OB_SUCCESS, store.del(cf, build_key(3)));
+  EXPECT_FALSE(is_segment_exist("./segment_store_test/cf_1/0.seg"));
+
+  // value larger than segment occupies a whole segment
+  char large_data[SEGMENT_SIZE * 2];
+  memset(large_data, 'b', sizeof(large_data));
+  EXPECT_EQ(OB_SUCCESS, store.put(cf, "large", ObSlice(large_data, sizeof(large_data))));
+  EXPECT_EQ(OB_SUCCESS, store.get(cf, "large", value));
+  EXPECT_EQ(std::string(large_data, sizeof(large_data)), value);
+  EXPECT_TRUE(is_segment_exist("./segment_store_test/cf_1/3.seg"));
+  EXPECT_EQ(OB_SUCCESS, store.put(cf, build_key(10), ObSlice(data, VALUE_SIZE)));
+  EXPECT_TRUE(is_segment_exist("./segment_store_test/cf_1/4.seg"));
+  EXPECT_EQ(OB_SUCCESS, store.del(cf, "large"));
+  EXPECT_FALSE(is_segment_exist("./segment_store_test/cf_1/3.seg"));
+
+  // active segment is kept until it is sealed
+  EXPECT_EQ(OB_SUCCESS, store.del(cf, build_key(10)));
+  EXPECT_TRUE(is_segment_exist("./segment_store_test/cf_1/4.seg"));
+
+  // all segments are removed after drop
+  EXPECT_EQ(OB_SUCCESS, store.drop_column_family(cf));
+  EXPECT_FALSE(is_segment_exist("./segment_store_test/cf_1/1.seg"));
+  EXPECT_FALSE(is_segment_exist("./segment_store_test/cf_1/2.seg"));
+  EXPECT_FALSE(is_segment_exist("./segment_store_test/cf_1/4.seg"));
+  EXPECT_EQ(OB_SUCCESS, store.destory_column_family(cf));
+  store.destroy();
+}
+
+// write, read and delete redo of large transactions with both store services
+static void bench_store_service(IObStoreService &store, const char *name)
+{
+  const int64_t TRANS_COUNT = 20;
+  const int64_t REDO_COUNT_PER_TRANS = 1000;
+  const int64_t REDO_SIZE = 16 << 10;
+  char *data = new char[REDO_SIZE];
+  void *cf = NULL;
+  std::string value;
+  int64_t write_time = 0;
+  int64_t read_time = 0;
+  int64_t del_time = 0;
+
+  memset(data, 'r', REDO_SIZE);
+  EXPECT_EQ(OB_SUCCESS, store.create_column_family("1001:tenant", cf));
+
+  for (int64_t trans_idx = 0; trans_idx < TRANS_COUNT; trans_idx++) {
+    const int64_t begin = trans_idx * REDO_COUNT_PER_TRANS;
+    const int64_t end = begin + REDO_COUNT_PER_TRANS;
+    int64_t start_ts = ObTimeUtility::current_time();
+
+    for (int64_t idx = begin; idx < end; idx++) {
+      EXPECT_EQ(OB_SUCCESS, store.put(cf, build_key(idx), ObSlice(data, REDO_SIZE)));
+    }
+    write_time += ObTimeUtility::current_time() - start_ts;
+
+    start_ts = ObTimeUtility::current_time();
+    for (int64_t idx = begin; idx < end; idx++) {
+      EXPECT_EQ(OB_SUCCESS, store.get(cf, build_key(idx), value));
+    }
+    read_time += ObTimeUtility::current_time() - start_ts;
+
+    start_ts = ObTimeUtility::current_time();
+    EXPECT_EQ(OB_SUCCESS, store.del_range(cf, build_key(begin), build_key(end)));
+    del_time += ObTimeUtility::current_time() - start_ts;
+  }
+
+  const double total_size_mb = static_cast<double>(TRANS_COUNT * REDO_COUNT_PER_TRANS * REDO_SIZE) / (1 << 20);
+  fprintf(stdout, "[%s] write=%.2fMB/s read=%.2fMB/s del_range=%.3fms/trans\n", name,
+      total_size_mb * 1000000 / static_cast<double>(MAX(write_time, 1)),
+      total_size_mb * 1000000 / static_cast<double>(MAX(read_time, 1)),
+      static_cast<double>(del_time) / 1000 / TRANS_COUNT);
+
+  EXPECT_EQ(OB_SUCCESS, store.drop_column_family(cf));
+  EXPECT_EQ(OB_SUCCESS, store.destory_column_family(cf));
+  delete [] data;
+}
+
+// writes about 320MB to each store, run it manually with --gtest_also_run_disabled_tests
+TEST(ObLogSegmentStoreService, DISABLED_bench_compare_with_rocksdb)
+{
+  ObLogSegmentStoreService segment_store;
+  RocksDbStoreService rocksdb_store;
+
+  EXPECT_EQ(OB_SUCCESS, segment_store.init("./segment_store_bench"));
+  bench_store_service(segment_store, "SEGMENT");
+  segment_store.destroy();
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::delete_directory_rec("./segment_store_bench"));
+
+  EXPECT_EQ(OB_SUCCESS, rocksdb_store.init("./rocksdb_store_bench"));
+  bench_store_service(rocksdb_store, "ROCKSDB");
+  rocksdb_store.destroy();
+  EXPECT_EQ(OB_SUCCESS, FileDirectoryUtils::delete_directory_rec("./rocksdb_store_bench"));
+}
+
+} // namespace libobcdc
+} // ns oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -239,6 +239,107 @@ TEST_F(TestLogCache, test_flashback)
   buf = NULL;
 }
 
+TEST_F(TestLogCache, test_read_ahead)
+{
+  log_storage.is_inited_ = true;
+  log_storage.logical_block_size_ = PALF_BLOCK_SIZE;
+  const int64_t flashback_version = 0;
+  int64_t palf_id = 1;
+  LogColdCache cold_cache;
+  cold_cache.init(palf_id, &palf_env_impl, &log_storage);
+  const int64_t read_ahead_size = 16 * CACHE_LINE_SIZE;
+  // extend to complete cache lines after the read end
+  {
+    LSN read_lsn(CACHE_LINE_SIZE);
+    int64_t read_size = 10 * 1024;
+    int64_t read_ahead_bytes = 0;
+    LSN limit_lsn(PALF_BLOCK_SIZE);
+    cold_cache.extend_read_ahead_(read_lsn + read_size, read_ahead_size, limit_lsn, MAX_LOG_BUFFER_SIZE,
+                                  read_lsn, read_size, read_ahead_bytes);
+    EXPECT_EQ(read_ahead_size, read_size);
+    EXPECT_EQ(read_ahead_size - 10 * 1024, read_ahead_bytes);
+  }
+
+  // never read beyond the readable limit, and the incomplete cache line is ignored
+  {
+    LSN read_lsn(CACHE_LINE_SIZE);
+    int64_t read_size = 10 * 1024;
+    int64_t read_ahead_bytes = 0;
+    LSN limit_lsn(3 * CACHE_LINE_SIZE + 100);
+    cold_cache.extend_read_ahead_(read_lsn + read_size, read_ahead_size, limit_lsn, MAX_LOG_BUFFER_SIZE,
+                                  read_lsn, read_size, read_ahead_bytes);
+    EXPECT_EQ(2 * CACHE_LINE_SIZE, read_size);
+    EXPECT_EQ(2 * CACHE_LINE_SIZE - 10 * 1024, read_ahead_bytes);
+  }
+
+  // the last cache line in the block can be read ahead
+  {
+    LSN read_lsn(PALF_BLOCK_SIZE - LAST_CACHE_LINE_SIZE - CACHE_LINE_SIZE);
+    int64_t read_size = CACHE_LINE_SIZE;
+    int64_t read_ahead_bytes = 0;
+    LSN limit_lsn(PALF_BLOCK_SIZE);
+    cold_cache.extend_read_ahead_(read_lsn + read_size, read_ahead_size, limit_lsn, MAX_LOG_BUFFER_SIZE,
+                                  read_lsn, read_size, read_ahead_bytes);
+    EXPECT_EQ(CACHE_LINE_SIZE + LAST_CACHE_LINE_SIZE, read_size);
+    EXPECT_EQ(LAST_CACHE_LINE_SIZE, read_ahead_bytes);
+  }
+
+  // read buf limits read-ahead, and no read-ahead when it's turned off
+  {
+    LSN read_lsn(0);
+    int64_t read_size = 10 * 1024;
+    int64_t read_ahead_bytes = 0;
+    LSN limit_lsn(PALF_BLOCK_SIZE);
+    cold_cache.extend_read_ahead_(read_lsn + read_size, read_ahead_size, limit_lsn, 2 * CACHE_LINE_SIZE,
+                                  read_lsn, read_size, read_ahead_bytes);
+    EXPECT_EQ(2 * CACHE_LINE_SIZE, read_size);
+    read_size = 10 * 1024;
+    cold_cache.extend_read_ahead_(read_lsn + read_size, 0, limit_lsn, MAX_LOG_BUFFER_SIZE,
+                                  read_lsn, read_size, read_ahead_bytes);
+    EXPECT_EQ(10 * 1024, read_size);
+    EXPECT_EQ(0, read_ahead_bytes);
+  }
+
+  // readers following the window share it
+  {
+    LogIteratorInfo opener(true);
+    LogIteratorInfo follower(false);
+    cold_cache.read_ahead_window_.update(flashback_version, LSN(0), LSN(4 * CACHE_LINE_SIZE), &opener);
+    EXPECT_TRUE(cold_cache.read_ahead_window_.contains(flashback_version, LSN(CACHE_LINE_SIZE)));
+    EXPECT_FALSE(cold_cache.read_ahead_window_.contains(flashback_version, LSN(4 * CACHE_LINE_SIZE)));
+    EXPECT_TRUE(cold_cache.read_ahead_window_.is_following(flashback_version, LSN(4 * CACHE_LINE_SIZE), &follower));
+    EXPECT_FALSE(cold_cache.read_ahead_window_.is_following(flashback_version + 1, LSN(CACHE_LINE_SIZE), &follower));
+    // a window which falls behind doesn't replace the current one
+    cold_cache.read_ahead_window_.update(flashback_version, LSN(0), LSN(2 * CACHE_LINE_SIZE), &follower);
+    EXPECT_TRUE(cold_cache.read_ahead_window_.contains(flashback_version, LSN(3 * CACHE_LINE_SIZE)));
+  }
+
+  // the opener doesn't follow the end of its own window
+  {
+    LogIteratorInfo lone_reader(false);
+    LogIteratorInfo other_reader(false);
+    cold_cache.read_ahead_window_.reset();
+    cold_cache.read_ahead_window_.update(flashback_version, LSN(0), LSN(4 * CACHE_LINE_SIZE), &lone_reader);
+    EXPECT_TRUE(cold_cache.read_ahead_window_.is_following(flashback_version, LSN(CACHE_LINE_SIZE), &lone_reader));
+    EXPECT_FALSE(cold_cache.read_ahead_window_.is_following(flashback_version, LSN(4 * CACHE_LINE_SIZE), &lone_reader));
+    EXPECT_TRUE(cold_cache.read_ahead_window_.is_following(flashback_version, LSN(4 * CACHE_LINE_SIZE), &other_reader));
+    // once another reader moves the window forward, the lone reader follows it again
+    cold_cache.read_ahead_window_.update(flashback_version, LSN(4 * CACHE_LINE_SIZE), LSN(8 * CACHE_LINE_SIZE), &other_reader);
+    EXPECT_TRUE(cold_cache.read_ahead_window_.is_following(flashback_version, LSN(8 * CACHE_LINE_SIZE), &lone_reader));
+    EXPECT_FALSE(cold_cache.read_ahead_window_.is_following(flashback_version, LSN(8 * CACHE_LINE_SIZE), &other_reader));
+  }
+
+  // iterator detects sequential reads
+  {
+    LogIteratorInfo iterator_info;
+    EXPECT_FALSE(iterator_info.is_sequential_read(LSN(0)));
+    iterator_info.set_last_read_range(LSN(0), CACHE_LINE_SIZE);
+    EXPECT_TRUE(iterator_info.is_sequential_read(LSN(1024)));
+    EXPECT_TRUE(iterator_info.is_sequential_read(LSN(CACHE_LINE_SIZE)));
+    EXPECT_FALSE(iterator_info.is_sequential_read(LSN(2 * CACHE_LINE_SIZE)));
+  }
+}
+
 } // end namespace unittest
 } // end namespace oceanbase
 
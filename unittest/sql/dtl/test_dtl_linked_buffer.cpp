@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "sql/dtl/ob_dtl_linked_buffer.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+using namespace oceanbase::sql::dtl;
+
+// local channel compacts PX_VECTOR buffers into a new buffer with shallow_copy before
+// it decides whether the buffer goes to interm result manager, so the header copy
+// must keep everything that decision depends on.
+TEST(TestDtlLinkedBuffer, shallow_copy_keeps_interm_result)
+{
+  char src_data[64];
+  char dst_data[64];
+  ObDtlLinkedBuffer src(src_data, sizeof(src_data));
+  ObDtlLinkedBuffer dst(dst_data, sizeof(dst_data));
+  src.set_data_msg(true);
+  src.set_msg_type(ObDtlMsgType::PX_VECTOR);
+  src.set_use_interm_result(true);
+  src.set_dfo_id(1);
+  src.set_sqc_id(2);
+  ASSERT_EQ(OB_SUCCESS, dst.shallow_copy(src));
+  dst.set_buf(dst_data);
+  dst.set_size(sizeof(dst_data));
+  ASSERT_TRUE(dst.is_data_msg());
+  ASSERT_TRUE(dst.use_interm_result());
+  ASSERT_EQ(ObDtlMsgType::PX_VECTOR, dst.msg_type());
+  ASSERT_EQ(1, dst.get_dfo_id());
+  ASSERT_EQ(2, dst.get_sqc_id());
+  ASSERT_EQ(dst_data, dst.buf());
+
+  // buffers that do not use interm result stay on the channel path
+  ObDtlLinkedBuffer plain_src(src_data, sizeof(src_data));
+  ObDtlLinkedBuffer plain_dst(dst_data, sizeof(dst_data));
+  plain_src.set_data_msg(true);
+  plain_src.set_msg_type(ObDtlMsgType::PX_VECTOR);
+  ASSERT_EQ(OB_SUCCESS, plain_dst.shallow_copy(plain_src));
+  ASSERT_FALSE(plain_dst.use_interm_result());
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
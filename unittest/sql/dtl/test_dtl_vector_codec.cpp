@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "sql/dtl/ob_dtl_vector_codec.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+using namespace oceanbase::sql::dtl;
+
+class TestDtlVectorCodec : public ::testing::Test
+{
+public:
+  // build a fixed vector buffer: col 0 int64 ascending, col 1 int32 constant, col 2 16 bytes
+  char *build_fixed_vector(const int32_t row_cnt, int64_t &size)
+  {
+    const int32_t col_cnt = 3;
+    const int32_t fixed_lens[col_cnt] = { 8, 4, 16 };
+    const int64_t nulls_size = ObBitVector::memory_size(row_cnt);
+    size = ObDtlVectors::HEAD_SIZE + col_cnt * sizeof(VectorInfo);
+    for (int64_t i = 0; i < col_cnt; ++i) {
+      size += nulls_size + fixed_lens[i] * row_cnt;
+    }
+    char *buf = static_cast<char *>(alloc_.alloc(size));
+    MEMSET(buf, 0, size);
+    *reinterpret_cast<int32_t *>(buf) = ObDtlVectorsBuffer::MAGIC;
+    *reinterpret_cast<int32_t *>(buf + sizeof(int32_t)) = col_cnt;
+    *reinterpret_cast<int32_t *>(buf + sizeof(int32_t) * 2) = row_cnt;
+    VectorInfo *infos = reinterpret_cast<VectorInfo *>(buf + ObDtlVectors::HEAD_SIZE);
+    int64_t offset = ObDtlVectors::HEAD_SIZE + col_cnt * sizeof(VectorInfo);
+    for (int64_t i = 0; i < col_cnt; ++i) {
+      infos[i].format_ = VEC_FIXED;
+      infos[i].fixed_len_ = fixed_lens[i];
+      infos[i].nulls_offset_ = offset;
+      ObBitVector *nulls = to_bit_vector(buf + offset);
+      for (int64_t j = 0; j < row_cnt; j += 7) {
+        nulls->set(j);
+      }
+      offset += nulls_size;
+      infos[i].offsets_offset_ = offset;
+      infos[i].data_offset_ = offset;
+      for (int64_t j = 0; j < row_cnt; ++j) {
+        if (0 == i) {
+          reinterpret_cast<int64_t *>(buf + offset)[j] = 1000 + j;
+        } else if (1 == i) {
+          reinterpret_cast<int32_t *>(buf + offset)[j] = 42;
+        } else {
+          MEMSET(buf + offset + j * fixed_lens[i], static_cast<char>(j), fixed_lens[i]);
+        }
+      }
+      offset += fixed_lens[i] * row_cnt;
+    }
+    return buf;
+  }
+protected:
+  ObArenaAllocator alloc_;
+};
+
+TEST_F(TestDtlVectorCodec, round_trip)
+{
+  const int32_t row_cnts[] = { 1, 15, 16, 1000, 4096 };
+  for (int64_t k = 0; k < ARRAYSIZEOF(row_cnts); ++k) {
+    int64_t size = 0;
+    char *src = build_fixed_vector(row_cnts[k], size);
+    const int64_t buf_len = ObDtlVectorCodec::get_max_encoded_size(size);
+    char *encoded = static_cast<char *>(alloc_.alloc(buf_len));
+    int64_t pos = 0;
+    ASSERT_EQ(OB_SUCCESS, ObDtlVectorCodec::encode(src, encoded, buf_len, pos, alloc_));
+    ASSERT_TRUE(ObDtlVectorCodec::is_encoded(encoded));
+    ASSERT_EQ(size, ObDtlVectorCodec::decode_size(encoded));
+    if (row_cnts[k] >= ObDtlVectorCodec::MIN_ENCODE_ROW_CNT) {
+      ASSERT_LT(pos, size);
+    }
+    char *decoded = static_cast<char *>(alloc_.alloc(size));
+    ASSERT_EQ(OB_SUCCESS, ObDtlVectorCodec::decode(encoded, pos, decoded, size));
+    ASSERT_EQ(0, MEMCMP(src, decoded, size));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
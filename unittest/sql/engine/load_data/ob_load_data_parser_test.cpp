@@ -305,6 +305,66 @@ TEST_F(TestParser, general_parser_escape)
 
 }
 
+TEST_F(TestParser, general_parser_structural_scan)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = ",";
+  file_struct.field_enclosed_str_ = "\"";
+  file_struct.field_enclosed_char_ = '"';
+
+  const int64_t column_num = 4;
+  const int64_t row_num = 100000;
+  const std::string long_field(37, 'x');
+  std::string data;
+  for (int64_t i = 0; i < row_num; i++) {
+    // plain field longer than a simd block, enclosed field with field term, line term and enclosed char,
+    // multi-byte field and escaped field
+    data.append(long_field).append(std::to_string(i)).append(",");
+    data.append("\"a,b \"\"c\"\"\nd\",");
+    data.append("\xe4\xb8\xad\xe6\x96\x87" "abc,");
+    data.append("tab\\tend\n");
+  }
+  std::vector<char> escape_buf(data.size());
+
+  ObCSVGeneralParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, column_num, CS_TYPE_UTF8MB4_BIN));
+
+  int64_t row_idx = 0;
+  auto check_line = [&](ObIArray<ObCSVGeneralParser::FieldValue> &arr) -> int {
+    int ret = OB_SUCCESS;
+    std::string expect_field0 = long_field + std::to_string(row_idx);
+    ObString fields[column_num];
+    for (int64_t i = 0; i < column_num; i++) {
+      fields[i].assign_ptr(arr.at(i).ptr_, arr.at(i).len_);
+    }
+    if (fields[0] != ObString(static_cast<int32_t>(expect_field0.length()), expect_field0.c_str())
+        || fields[1] != ObString("a,b \"c\"\nd")
+        || fields[2] != ObString("\xe4\xb8\xad\xe6\x96\x87" "abc")
+        || fields[3] != ObString("tab\tend")) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected fields", K(ret), K(row_idx), K(arr));
+    }
+    row_idx++;
+    return ret;
+  };
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 256> error_msgs;
+  const char *ptr = data.c_str();
+  const char *end = data.c_str() + data.length();
+  int64_t nrows = INT64_MAX;
+  int64_t start_time = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, (parser.scan<decltype(check_line), true>(ptr, end, nrows,
+                                    escape_buf.data(), escape_buf.data() + escape_buf.size(),
+                                    check_line, error_msgs, true)));
+  int64_t time_dur = MAX(ObTimeUtility::current_time() - start_time, 1);
+  ASSERT_EQ(0, error_msgs.count());
+  ASSERT_EQ(row_num, nrows);
+  ASSERT_EQ(row_num, row_idx);
+  ASSERT_EQ(end, ptr);
+  fprintf(stdout, "## structural_scan:%d\tbytes:%ld\tspeed:%ldM/s\n",
+          parser.get_opt_params().is_structural_scan_, static_cast<int64_t>(data.length()),
+          static_cast<int64_t>(data.length()) * USECS_PER_SEC / time_dur >> 20);
+}
+
 int main(int argc, char **argv)
 {
   init_sql_factories();
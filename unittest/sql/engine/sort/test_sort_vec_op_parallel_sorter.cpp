@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+#include "lib/allocator/page_arena.h"
+#include "lib/random/ob_random.h"
+#include "sql/engine/sort/ob_sort_vec_op_parallel_sorter.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+struct TestSortRow
+{
+  int64_t key_;
+};
+
+// comparator with the members used by ObSortVecOpParallelSorter, rows with negative key
+// fail the compare.
+class TestSortCompare
+{
+public:
+  explicit TestSortCompare(ObIAllocator &allocator) :
+    ret_(OB_SUCCESS), cmp_sk_exprs_(nullptr), sk_row_meta_(nullptr), addon_row_meta_(nullptr),
+    cmp_sort_collations_(nullptr), exec_ctx_(nullptr), encode_sk_state_(0), cmp_count_(0)
+  {
+    UNUSED(allocator);
+  }
+  int init(const void *cmp_sk_exprs, const void *sk_row_meta, const void *addon_row_meta,
+           const void *cmp_sort_collations, void *exec_ctx, bool enable_encode_sortkey)
+  {
+    UNUSEDx(cmp_sk_exprs, sk_row_meta, addon_row_meta, cmp_sort_collations, exec_ctx,
+            enable_encode_sortkey);
+    return OB_SUCCESS;
+  }
+  void disable_check_status() {}
+  bool operator()(const TestSortRow *l, const TestSortRow *r)
+  {
+    cmp_count_++;
+    if (l->key_ < 0 || r->key_ < 0) {
+      ret_ = OB_ERR_UNEXPECTED;
+    }
+    return l->key_ < r->key_;
+  }
+
+public:
+  int ret_;
+  const void *cmp_sk_exprs_;
+  const void *sk_row_meta_;
+  const void *addon_row_meta_;
+  const void *cmp_sort_collations_;
+  void *exec_ctx_;
+  int encode_sk_state_;
+  int64_t cmp_count_;
+};
+
+typedef ObSortVecOpParallelSorter<TestSortCompare, TestSortRow> TestSorter;
+
+class TestSortVecOpParallelSorter : public ::testing::Test
+{
+public:
+  TestSortVecOpParallelSorter() : allocator_("TestParaSort") {}
+  virtual void TearDown() override { allocator_.reset(); }
+
+  void build_rows(const int64_t row_cnt, const int64_t max_key)
+  {
+    rows_.clear();
+    row_ptrs_.clear();
+    rows_.resize(row_cnt);
+    for (int64_t i = 0; i < row_cnt; i++) {
+      rows_[i].key_ = ObRandom::rand(0, max_key);
+    }
+    for (int64_t i = 0; i < row_cnt; i++) {
+      row_ptrs_.push_back(&rows_[i]);
+    }
+  }
+  int do_sort(const int64_t degree)
+  {
+    int ret = OB_SUCCESS;
+    TestSorter sorter(allocator_);
+    TestSortCompare comp(allocator_);
+    ObSortVecOpParallelWorkers workers;
+    std::vector<TestSortRow *> merged_rows(row_ptrs_.size());
+    if (OB_FAIL(sorter.init(degree, comp))) {
+    } else {
+      ret = sorter.sort(&row_ptrs_[0], row_ptrs_.size(), &merged_rows[0], comp, workers);
+    }
+    return ret;
+  }
+  void check_sorted()
+  {
+    std::vector<int64_t> expect_keys;
+    for (int64_t i = 0; i < rows_.size(); i++) {
+      expect_keys.push_back(rows_[i].key_);
+    }
+    std::sort(expect_keys.begin(), expect_keys.end());
+    ASSERT_EQ(expect_keys.size(), row_ptrs_.size());
+    for (int64_t i = 0; i < row_ptrs_.size(); i++) {
+      ASSERT_EQ(expect_keys[i], row_ptrs_[i]->key_) << "idx " << i;
+    }
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  std::vector<TestSortRow> rows_;
+  std::vector<TestSortRow *> row_ptrs_;
+};
+
+TEST_F(TestSortVecOpParallelSorter, test_get_run_cnt)
+{
+  EXPECT_EQ(0, TestSorter::get_run_cnt(8, TestSorter::MIN_ROWS_PER_RUN - 1));
+  EXPECT_EQ(1, TestSorter::get_run_cnt(8, TestSorter::MIN_ROWS_PER_RUN));
+  EXPECT_EQ(8, TestSorter::get_run_cnt(8, TestSorter::MIN_ROWS_PER_RUN * 100));
+  EXPECT_EQ(TestSorter::MAX_SORT_THREAD_CNT,
+            TestSorter::get_run_cnt(1000, TestSorter::MIN_ROWS_PER_RUN * 1000));
+}
+
+// no thread is acquired outside of tenant context, all runs are sorted by the caller thread
+// and merged by the loser tree.
+TEST_F(TestSortVecOpParallelSorter, test_sort_and_merge)
+{
+  const int64_t degrees[] = {2, 3, 7, 16};
+  for (int64_t i = 0; i < ARRAYSIZEOF(degrees); i++) {
+    // many duplicated keys
+    build_rows(10000, 100);
+    ASSERT_EQ(OB_SUCCESS, do_sort(degrees[i]));
+    check_sorted();
+    // mostly distinct keys
+    build_rows(10001, 1L << 40);
+    ASSERT_EQ(OB_SUCCESS, do_sort(degrees[i]));
+    check_sorted();
+  }
+  // one row per run
+  build_rows(16, 1000);
+  ASSERT_EQ(OB_SUCCESS, do_sort(16));
+  check_sorted();
+}
+
+TEST_F(TestSortVecOpParallelSorter, test_invalid_argument)
+{
+  TestSorter sorter(allocator_);
+  TestSortCompare comp(allocator_);
+  ObSortVecOpParallelWorkers workers;
+  TestSortRow *merged_rows[4];
+  EXPECT_EQ(OB_INVALID_ARGUMENT, sorter.init(1, comp));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, sorter.init(TestSorter::MAX_SORT_THREAD_CNT + 1, comp));
+  build_rows(4, 100);
+  EXPECT_EQ(OB_NOT_INIT, sorter.sort(&row_ptrs_[0], 4, merged_rows, comp, workers));
+  ASSERT_EQ(OB_SUCCESS, sorter.init(8, comp));
+  // fewer rows than runs
+  EXPECT_EQ(OB_INVALID_ARGUMENT, sorter.sort(&row_ptrs_[0], 4, merged_rows, comp, workers));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, sorter.sort(&row_ptrs_[0], 4, nullptr, comp, workers));
+}
+
+TEST_F(TestSortVecOpParallelSorter, test_compare_failed)
+{
+  build_rows(10000, 1000);
+  // the failed row is in the last run, which is sorted with a per run comparator
+  rows_[9999].key_ = -1;
+  EXPECT_EQ(OB_ERR_UNEXPECTED, do_sort(4));
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -689,6 +689,72 @@ TEST_F(TestCSDecoder, test_decimal_int_decoder)
   ASSERT_EQ(OB_SUCCESS, check_get_row_count(header, micro_block_desc, row_cnt_without_null, col_cnt, false));
 }
 
+// perf only, run with --gtest_also_run_disabled_tests
+TEST_F(TestCSDecoder, DISABLED_test_integer_decode_vector_perf)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 2;
+  const int64_t row_cnt = 1000;
+  const int64_t loop_cnt = 10000;
+  // value range of 1/2/4/8 bytes store width
+  const int64_t value_ranges[] = {UINT8_MAX - 1, UINT16_MAX - 1, UINT32_MAX - 1, INT64_MAX - 1};
+  ObObjType col_types[col_cnt] = {ObIntType, ObIntType};
+
+  for (int64_t range_idx = 0; range_idx < ARRAYSIZEOF(value_ranges); range_idx++) {
+    for (int64_t has_null = 0; has_null < 2; has_null++) {
+      reuse();
+      ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+      ctx_.column_encodings_[1] = ObCSColumnHeader::Type::INTEGER;
+      ObMicroBlockCSEncoder encoder;
+      ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+      ObDatumRow row_arr[row_cnt];
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+        row_arr[i].storage_datums_[0].set_int(i);
+        if (has_null && 0 == i % 17) {
+          row_arr[i].storage_datums_[1].set_null();
+        } else {
+          row_arr[i].storage_datums_[1].set_int((i * 2654435761L) % value_ranges[range_idx]);
+        }
+        ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+      }
+      ObMicroBlockDesc micro_block_desc;
+      ObMicroBlockHeader *header = nullptr;
+      ASSERT_EQ(OB_SUCCESS, build_micro_block_desc(encoder, micro_block_desc, header));
+      ObMicroBlockData full_transformed_data;
+      ObMicroBlockCSDecoder decoder;
+      ASSERT_EQ(OB_SUCCESS, init_cs_decoder(header, micro_block_desc, full_transformed_data, decoder));
+
+      ObArenaAllocator frame_allocator;
+      sql::ObExecContext exec_context(allocator_);
+      sql::ObEvalCtx eval_ctx(exec_context);
+      sql::ObExpr col_expr;
+      const char *ptr_arr[row_cnt];
+      uint32_t len_arr[row_cnt];
+      int32_t row_ids[row_cnt];
+      for (int32_t i = 0; i < row_cnt; ++i) {
+        row_ids[i] = i;
+      }
+      ASSERT_EQ(OB_SUCCESS, VectorDecodeTestUtil::generate_column_output_expr(
+          row_cnt, col_descs_.at(1).col_type_, VEC_FIXED, eval_ctx, col_expr, frame_allocator));
+      ObVectorDecodeCtx vector_ctx(ptr_arr, len_arr, row_ids, row_cnt, 0, col_expr.get_vector_header(eval_ctx));
+      ASSERT_EQ(OB_SUCCESS, decoder.get_col_data(1, vector_ctx));
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        ASSERT_TRUE(VectorDecodeTestUtil::verify_vector_and_datum_match(
+            *vector_ctx.get_vector(), i, row_arr[i].storage_datums_[1]));
+      }
+
+      const int64_t start_us = ObTimeUtility::current_time();
+      for (int64_t i = 0; i < loop_cnt; ++i) {
+        ASSERT_EQ(OB_SUCCESS, decoder.get_col_data(1, vector_ctx));
+      }
+      const int64_t cost_us = ObTimeUtility::current_time() - start_us;
+      const double ns_per_row = cost_us * 1000.0 / (loop_cnt * row_cnt);
+      LOG_INFO("decode integer vector", "store_width", 1 << range_idx, K(has_null), K(ns_per_row));
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(TestDecoder, TestCSDecoder, Combine(Bool(), Bool()));
 
 }  // namespace blocksstable
@@ -185,6 +185,13 @@ TEST_F(TestIntegerPdFilter, test_integer_decoder_uint_type)
       int64_t res_arr_le[4] = {1, 100, 100, 100};
       integer_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_LE, 4, 1, res_arr_le);
     }
+
+    // check BT
+    {
+      uint64_t ref_arr[8] = {100, 150, 150, 250, 0, 99, 199, 199};
+      int64_t res_arr[4] = {51, 50, 0, 1};
+      integer_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_BT, 4, 2, res_arr);
+    }
   }
 }
 
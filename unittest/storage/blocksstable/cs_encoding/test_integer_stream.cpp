@@ -820,6 +820,61 @@ TEST_F(TestIntegerStream, test_rle)
   }
 }
 
+TEST_F(TestIntegerStream, test_tiered_codec_selection)
+{
+  const int64_t size = 4096;
+  ObCSEncodingOpt encoding_opt;
+  ObArenaAllocator allocator;
+  const ObCompressorType compress_type = ObCompressorType::ZSTD_1_3_8_COMPRESSOR;
+  uint64_t *data = reinterpret_cast<uint64_t *>(allocator_.alloc(sizeof(uint64_t) * size));
+
+  // monotonic increasing stream only tries delta and pfor encodings
+  {
+    ObIntegerStreamEncoderCtx ctx;
+    ctx.meta_.set_8_byte_width();
+    ctx.build_stream_encoder_info(false, false, &encoding_opt, nullptr, -1, compress_type, &allocator);
+    for (int64_t i = 0; i < size; i++) {
+      data[i] = 1000000 + i * 3 + (i % 5);
+    }
+    ObIntegerStream::EncodingType candidates[ObIntegerStream::EncodingType::MAX_TYPE];
+    int32_t candidate_count = 0;
+    ObIntegerStreamEncoder encoder;
+    encoder.ctx_ = &ctx;
+    ASSERT_TRUE(encoder.is_sample_monotonic_inc<uint64_t>(data, size));
+    encoder.build_candidate_codec_list<uint64_t>(true, candidates, candidate_count);
+    ASSERT_EQ(5, candidate_count);
+    ASSERT_EQ(ObIntegerStream::EncodingType::DOUBLE_DELTA_ZIGZAG_RLE, candidates[0]);
+
+    ObMicroBufferWriter writer;
+    ASSERT_EQ(OB_SUCCESS, writer.init(OB_DEFAULT_MACRO_BLOCK_SIZE, OB_DEFAULT_MACRO_BLOCK_SIZE));
+    ASSERT_EQ(OB_SUCCESS, encoder.encode(ctx, data, size, writer));
+    const uint8_t type = ctx.meta_.get_encoding_type();
+    ASSERT_NE(ObIntegerStream::EncodingType::XOR_FIXED_PFOR, type);
+    ASSERT_NE(ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS, type);
+    ASSERT_NE(ObIntegerStream::EncodingType::RAW, type);
+  }
+
+  // floating stream only tries xor and pfor encodings
+  {
+    ObIntegerStreamEncoderCtx ctx;
+    ctx.meta_.set_8_byte_width();
+    ctx.build_stream_encoder_info(false, false, &encoding_opt, nullptr, -1, compress_type, &allocator);
+    ctx.info_.is_floating_ = true;
+    for (int64_t i = 0; i < size; i++) {
+      double value = 100.0 + (i % 16) * 0.5;
+      MEMCPY(&data[i], &value, sizeof(double));
+    }
+    ObMicroBufferWriter writer;
+    ObIntegerStreamEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, writer.init(OB_DEFAULT_MACRO_BLOCK_SIZE, OB_DEFAULT_MACRO_BLOCK_SIZE));
+    ASSERT_EQ(OB_SUCCESS, encoder.encode(ctx, data, size, writer));
+    const uint8_t type = ctx.meta_.get_encoding_type();
+    ASSERT_TRUE(ObIntegerStream::EncodingType::XOR_FIXED_PFOR == type
+                || ObIntegerStream::EncodingType::SIMD_FIXEDPFOR == type
+                || ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS == type);
+  }
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
 
@@ -25,6 +25,7 @@
 #include "storage/tablet/ob_tablet.h"
 #include "storage/tablet/ob_tablet_table_store.h"
 #include "storage/compaction/ob_partition_merge_policy.h"
+#include "storage/compaction/ob_compaction_dag_ranker.h"
 #include "storage/meta_mem/ob_tenant_meta_mem_mgr.h"
 #include "mtlenv/mock_tenant_module_env.h"
 #include "storage/tablet/ob_tablet_create_delete_helper.h"
@@ -1269,6 +1270,36 @@ TEST_F(TestCompactionPolicy, check_minor_merge_policy_with_large_minor3)
   ASSERT_EQ(350, result.scn_range_.end_scn_.get_val_for_tx());
 }
 
+TEST_F(TestCompactionPolicy, estimate_read_amp_benefit)
+{
+  const int64_t query_cnt = 1000;
+  const int64_t write_size = 64 * 1024L * 1024L; // 64MB
+
+  // cold tablet or nothing to reduce
+  ASSERT_EQ(0UL, ObCompactionEstimator::estimate_read_amp_benefit(0, 0, 10, 9, write_size));
+  ASSERT_EQ(0UL, ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 1, 1, write_size));
+  ASSERT_EQ(0UL, ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 10, 0, write_size));
+
+  // high read amplification: 10 tables compacted into 1, low: 3 tables compacted into 1
+  const uint64_t high_amp_benefit = ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 10, 9, write_size);
+  const uint64_t low_amp_benefit = ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 3, 2, write_size);
+  ASSERT_EQ(static_cast<uint64_t>(query_cnt * 9 / 64), high_amp_benefit);
+  ASSERT_EQ(static_cast<uint64_t>(query_cnt * 2 / 64), low_amp_benefit);
+  ASSERT_GT(high_amp_benefit, low_amp_benefit);
+
+  // reduced table cnt can't exceed table_cnt - 1
+  ASSERT_EQ(high_amp_benefit, ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 10, 20, write_size));
+
+  // hotter tablet and exist row checks give more benefit
+  ASSERT_GT(ObCompactionEstimator::estimate_read_amp_benefit(query_cnt * 10, 0, 3, 2, write_size), low_amp_benefit);
+  ASSERT_GT(ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, query_cnt * 10, 3, 2, write_size), low_amp_benefit);
+
+  // the more data to write, the less benefit per MB, write size is at least counted as 1MB
+  ASSERT_LT(ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 10, 9, write_size * 4), high_amp_benefit);
+  ASSERT_EQ(ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 10, 9, 1024),
+            ObCompactionEstimator::estimate_read_amp_benefit(query_cnt, 0, 10, 9, 1024L * 1024L));
+}
+
 } //unittest
 } //oceanbase
 
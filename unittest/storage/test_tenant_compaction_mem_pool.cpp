@@ -349,6 +349,56 @@ TEST_F(TestTenantCompactionMemPool, monitor_buffer_test)
   ASSERT_TRUE(0 != mem_ctx.get_total_mem_peak());
 }
 
+TEST_F(TestTenantCompactionMemPool, mem_broker_test)
+{
+  ObTenantCompactionMemPool *mem_pool = MTL(ObTenantCompactionMemPool *);
+  ASSERT_TRUE(NULL != mem_pool);
+  ObCompactionMemBroker &mem_broker = mem_pool->get_mem_broker();
+  const int64_t mem_limit = mem_broker.get_mem_limit();
+  ASSERT_EQ(0, mem_broker.get_used_mem());
+
+  // the first merge is always admitted, even if it is larger than the budget
+  EXPECT_TRUE(mem_broker.can_admit(mem_limit + 1, false/*force*/));
+  EXPECT_EQ(0, mem_broker.get_used_mem());
+  EXPECT_TRUE(mem_broker.try_admit(mem_limit + 1, false/*force*/));
+  EXPECT_TRUE(mem_broker.is_over_budget());
+  EXPECT_FALSE(mem_broker.can_admit(1, false/*force*/));
+  EXPECT_TRUE(mem_broker.can_admit(1, true/*force*/));
+  EXPECT_EQ(mem_limit + 1, mem_broker.get_used_mem());
+  EXPECT_FALSE(mem_broker.try_admit(1, false/*force*/));
+  EXPECT_TRUE(mem_broker.try_admit(1, true/*force*/));
+  mem_broker.release(mem_limit + 2);
+  EXPECT_EQ(0, mem_broker.get_used_mem());
+
+  // borrowed memory blocks the admission until it is returned
+  const int64_t half_limit = mem_limit / 2;
+  EXPECT_TRUE(mem_broker.try_admit(half_limit, false/*force*/));
+  mem_broker.borrow(half_limit);
+  EXPECT_FALSE(mem_broker.try_admit(half_limit, false/*force*/));
+  mem_broker.release(half_limit);
+  EXPECT_TRUE(mem_broker.try_admit(half_limit, false/*force*/));
+  mem_broker.release(half_limit * 2);
+  EXPECT_EQ(0, mem_broker.get_used_mem());
+
+  // memory context borrows the part beyond the admitted memory and returns it when destroyed
+  {
+    ObArenaAllocator inner_arena;
+    ObTabletMergeDagParam param;
+    param.merge_type_ = compaction::MINOR_MERGE;
+    ObCompactionMemoryContext mem_ctx(param, inner_arena);
+    mem_ctx.set_admitted_mem(0);
+    ObCompactionBufferWriter buffer_writer("test");
+    buffer_writer.ref_mem_ctx_ = &mem_ctx;
+    buffer_writer.ensure_space(ObCompactionBufferChunk::DEFAULT_BLOCK_SIZE);
+    mem_ctx.mem_click();
+    EXPECT_TRUE(mem_ctx.get_borrowed_mem() > 0);
+    EXPECT_EQ(mem_ctx.get_borrowed_mem(), mem_broker.get_used_mem());
+    buffer_writer.reset();
+    mem_ctx.destroy();
+    EXPECT_EQ(0, mem_broker.get_used_mem());
+  }
+}
+
 
 } // namespace unittest
 } // namespace oceanbase